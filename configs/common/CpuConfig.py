@@ -59,3 +59,75 @@ def config_etrace(cpu_cls, cpu_list, options):
     else:
         fatal("%s does not support data dependency tracing. Use a CPU model of"
               " type or inherited from DerivO3CPU.", cpu_cls)
+
+def config_lvp(cpu_list, options):
+    """Apply the load value prediction options of options, e.g. those of
+    spec_se.py, to the CPUs which have a value predictor."""
+    for cpu in cpu_list:
+        if isinstance(cpu, m5.objects.BaseMinorCPU):
+            cpu.num_lvpt_entries = str(options.num_lvpt_entries)
+            cpu.num_lct_entries = str(options.num_lct_entries)
+            cpu.num_cvt_entries = str(options.num_cvt_entries)
+            cpu.lvpt_assoc = options.lvpt_assoc
+            cpu.lct_assoc = options.lct_assoc
+            cpu.cvt_assoc = options.cvt_assoc
+            cpu.lct_bits_per_entry = options.lct_bits_per_entry
+            cpu.lvpu_policy = options.lvpu_policy
+            cpu.valuePred = getattr(m5.objects, options.value_pred_type)()
+            cpu.lvpu_selective_replay = options.lvpu_selective_replay
+            cpu.lvpt_max_vec_bytes = options.lvpt_max_vec_bytes
+        elif isinstance(cpu, m5.objects.BaseO3CPU) and \
+                options.lvpu_policy in ("none", "no_constants"):
+            # O3 has no constant bypass, so it only follows the predicting
+            # policies, with confidence counters sized like the Minor LCT
+            cpu.valuePred = getattr(m5.objects, options.value_pred_type)()
+            cpu.lvpConfidenceTableSize = options.num_lct_entries
+            cpu.lvpConfidenceBits = options.lct_bits_per_entry
+
+def config_lvp_trace(cpu_cls, cpu_list, options):
+    if not issubclass(cpu_cls, m5.objects.BaseMinorCPU):
+        fatal("%s has no LVPU to trace. Use a CPU model inherited from "
+              "BaseMinorCPU.", cpu_cls)
+    for i, cpu in enumerate(cpu_list):
+        # Each CPU gets its own trace, numbered when there are several
+        trace_file = options.lvp_trace
+        if len(cpu_list) > 1:
+            trace_file = "cpu%d.%s" % (i, trace_file)
+        cpu.lvpTraceRecorder = m5.objects.LVPTraceRecorder(
+            manager = cpu, trace_file = trace_file)
+
+def config_load_profiler(cpu_list, options):
+    for i, cpu in enumerate(cpu_list):
+        report_file = options.load_profile
+        if len(cpu_list) > 1:
+            report_file = "cpu%d.%s" % (i, report_file)
+        cpu.loadProfiler = m5.objects.LoadProfiler(
+            manager = cpu, report_file = report_file)
+
+def config_cache_warmer(cpu_list):
+    for cpu in cpu_list:
+        # The non-caching CPU reads memory through backdoors instead
+        if not isinstance(cpu, m5.objects.BaseAtomicSimpleCPU) or \
+                isinstance(cpu, m5.objects.BaseNonCachingSimpleCPU):
+            fatal("Cache warming needs an atomic CPU to run before the "
+                  "switch, not %s.", type(cpu))
+        if not hasattr(cpu, "icache") and not hasattr(cpu, "dcache"):
+            fatal("Cache warming needs %s to have L1 caches.", cpu)
+        # Warm the caches with the requests the CPU sends while they are
+        # bypassed
+        cpu.cacheWarmer = m5.objects.CacheWarmer(manager = cpu,
+            icache = getattr(cpu, "icache", m5.params.NULL),
+            dcache = getattr(cpu, "dcache", m5.params.NULL))
+
+def config_lvpu_warmer(cpu_cls, cpu_list, switch_cpu_list):
+    if not issubclass(cpu_cls, m5.objects.BaseMinorCPU):
+        fatal("%s has no LVPU to warm. Use a CPU model inherited from "
+              "BaseMinorCPU.", cpu_cls)
+    for cpu, switch_cpu in zip(cpu_list, switch_cpu_list):
+        if not isinstance(cpu, m5.objects.BaseSimpleCPU):
+            fatal("LVPU warming needs a simple CPU to run before the "
+                  "switch, not %s.", type(cpu))
+        # Train the switched out CPU's LVPU with the loads and stores the
+        # simple CPU retires
+        cpu.lvpuWarmer = m5.objects.LVPUWarmer(manager = cpu,
+                                               cpu = switch_cpu)
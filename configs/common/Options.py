@@ -249,6 +249,42 @@ def addCommonOptions(parser):
         "--elastic-trace-en", action="store_true",
         help="""Enable capture of data dependency and instruction
                       fetch traces using elastic trace probe.""")
+    parser.add_argument(
+        "--parallel", action="store_true",
+        help="""Simulate each core and its private caches on its own
+                      host thread, synchronising them every quantum.  The
+                      quantum is derived from the latencies of the links
+                      between the cores and the shared memory system.""")
+    parser.add_argument(
+        "--eventq-calendar", type=int, default=0, metavar="BUCKETS",
+        help="""Index the event queues with calendars of BUCKETS (a
+                      power of two) buckets, which speeds up simulations
+                      keeping many events pending.""")
+    parser.add_argument(
+        "--host-profile", action="store", type=str, metavar="FILE",
+        help="""Measure the host time spent processing the events of each
+                      SimObject, and report it to FILE in the output
+                      directory whenever the stats are dumped.""")
+    parser.add_argument(
+        "--cache-warm", action="store_true",
+        help="""Functionally warm the caches while fast forwarding or
+                      between samples, running the atomic CPUs with the
+                      caches bypassed.""")
+    parser.add_argument(
+        "--lvpu-warm", action="store_true",
+        help="""Train the LVPU of the Minor CPU switched to with the loads
+                      and stores retired while fast forwarding.""")
+    parser.add_argument(
+        "--lvp-trace", action="store", type=str, metavar="FILE",
+        help="""Record the loads and stores the LVPU of the Minor CPU sees,
+                      with their values, to a protobuf trace in the output
+                      directory for LVPTraceReplayer.""")
+    parser.add_argument(
+        "--load-profile", action="store", type=str, metavar="FILE",
+        help="""Profile the value and address locality, and dependence
+                      stalls, of each load retired by the CPUs, reporting
+                      the top loads to FILE in the output directory at each
+                      stats dump.""")
     # Trace file paths input to trace probe in a capture simulation and input
     # to Trace CPU in a replay simulation
     parser.add_argument("--inst-trace-file", action="store", type=str,
@@ -393,6 +429,29 @@ def addCommonOptions(parser):
         "--at-instruction", action="store_true", default=False,
         help="""Treat value of --checkpoint-restore or --take-checkpoint as a
                 number of instructions.""")
+    parser.add_argument(
+        "--sample-period", action="store", type=int, default=None,
+        help="""Sample the workload, simulating a window of instructions
+                in detail every <N> instructions and fast forwarding
+                through the rest.""")
+    parser.add_argument(
+        "--sample-simpoints", action="store", type=str, default=None,
+        help="""<simpoint file,weight file,interval-length,warmup-length>
+                Sample the workload at the SimPoint simulation points,
+                simulating each interval and its warmup in detail.""")
+    parser.add_argument(
+        "--sample-window", action="store", type=int, default=1000,
+        help="Instructions measured in each sample")
+    parser.add_argument(
+        "--sample-warmup", action="store", type=int, default=2000,
+        help="Detailed instructions run before each sample is measured")
+    parser.add_argument(
+        "--sample-max", action="store", type=int, default=0,
+        help="Stop after this many samples")
+    parser.add_argument(
+        "--sample-error", action="store", type=float, default=0.0,
+        help="""Stop sampling once the 95%% confidence interval of the CPI
+                is within this fraction of the mean, e.g. 0.03""")
     parser.add_argument("--spec-input", default="ref",
                         choices=["ref", "test", "train", "smred", "mdred",
                                  "lgred"],
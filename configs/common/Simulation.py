@@ -76,10 +76,12 @@ def setCPUClass(options):
         if options.restore_with_cpu != options.cpu_type:
             CPUClass = TmpClass
             TmpClass, test_mem_mode = getCPUClass(options.restore_with_cpu)
-    elif options.fast_forward:
+    elif options.fast_forward or isSampling(options):
         CPUClass = TmpClass
         TmpClass = AtomicSimpleCPU
-        test_mem_mode = 'atomic'
+        # Caches being functionally warmed are bypassed
+        test_mem_mode = 'atomic_noncaching' if options.cache_warm \
+            else 'atomic'
 
     # Ruby only supports atomic accesses in noncaching mode
     if test_mem_mode == 'atomic' and options.ruby:
@@ -88,6 +90,41 @@ def setCPUClass(options):
 
     return (TmpClass, test_mem_mode, CPUClass)
 
+def isSampling(options):
+    return options.sample_period or options.sample_simpoints
+
+def sampleWorkload(options, testsys, switch_cpu_list):
+    """Sample the workload, switching between the atomic CPUs, which warm
+    the caches, and the detailed ones.  Returns the event the simulation
+    exited on if the workload ended before sampling did"""
+    from m5.sampling import Sampler, read_simpoints
+
+    if not options.caches and not options.l2cache:
+        warn("Sampling without caches, only the detailed warmup warms "
+             "the CPUs' state")
+
+    if options.sample_simpoints:
+        simpoint_file, weight_file, interval_length, warmup_length = \
+            options.sample_simpoints.split(",", 3)
+        interval_length = int(interval_length)
+        sampler = Sampler(testsys, switch_cpu_list,
+                          window=interval_length,
+                          warmup=int(warmup_length),
+                          regions=read_simpoints(simpoint_file, weight_file,
+                                                 interval_length),
+                          max_samples=options.sample_max,
+                          warm_caches=options.cache_warm)
+    else:
+        sampler = Sampler(testsys, switch_cpu_list,
+                          window=options.sample_window,
+                          warmup=options.sample_warmup,
+                          period=options.sample_period,
+                          max_samples=options.sample_max,
+                          target_error=options.sample_error,
+                          warm_caches=options.cache_warm)
+
+    return sampler.run()
+
 def setMemClass(options):
     """Returns a memory controller class."""
 
@@ -444,6 +481,14 @@ def run(options, root, testsys, cpu_class):
     if options.repeat_switch and options.take_checkpoints:
         fatal("Can't specify both --repeat-switch and --take-checkpoints")
 
+    if isSampling(options) and (options.standard_switch or
+                                options.repeat_switch or
+                                options.fast_forward or
+                                options.take_checkpoints or
+                                options.take_simpoint_checkpoints):
+        fatal("Sampling can't be combined with other CPU switching or "
+              "checkpointing")
+
     # Setup global stat filtering.
     stat_root_simobjs = []
     for stat_root_str in options.stats_root:
@@ -490,11 +535,34 @@ def run(options, root, testsys, cpu_class):
                     IndirectBPClass()
             switch_cpus[i].createThreads()
 
+        # Apply the load value prediction options of scripts which have
+        # them to the switch CPUs
+        if hasattr(options, "lvpu_policy"):
+            CpuConfig.config_lvp(switch_cpus, options)
+
         # If elastic tracing is enabled attach the elastic trace probe
         # to the switch CPUs
         if options.elastic_trace_en:
             CpuConfig.config_etrace(cpu_class, switch_cpus, options)
 
+        # If cache warming is enabled attach the warmer probe to the CPUs
+        # run before the switch
+        if options.cache_warm:
+            CpuConfig.config_cache_warmer(testsys.cpu)
+
+        # If LVPU warming is enabled attach the warmer probe to the CPUs
+        # run before the switch
+        if options.lvpu_warm:
+            CpuConfig.config_lvpu_warmer(cpu_class, testsys.cpu, switch_cpus)
+
+        # If LVP tracing is enabled attach the recorder to the switch CPUs
+        if options.lvp_trace:
+            CpuConfig.config_lvp_trace(cpu_class, switch_cpus, options)
+
+        # Only profile the loads of the CPUs switched to
+        if options.load_profile:
+            CpuConfig.config_load_profiler(switch_cpus, options)
+
         testsys.switch_cpus = switch_cpus
         switch_cpu_list = [(testsys.cpu[i], switch_cpus[i]) for i in range(np)]
 
@@ -523,6 +591,9 @@ def run(options, root, testsys, cpu_class):
             if options.checker:
                 repeat_switch_cpus[i].addCheckerCpu()
 
+        if hasattr(options, "lvpu_policy"):
+            CpuConfig.config_lvp(repeat_switch_cpus, options)
+
         testsys.repeat_switch_cpus = repeat_switch_cpus
 
         if cpu_class:
@@ -577,6 +648,9 @@ def run(options, root, testsys, cpu_class):
                 switch_cpus[i].addCheckerCpu()
                 switch_cpus_1[i].addCheckerCpu()
 
+        if hasattr(options, "lvpu_policy"):
+            CpuConfig.config_lvp(switch_cpus_1, options)
+
         testsys.switch_cpus = switch_cpus
         testsys.switch_cpus_1 = switch_cpus_1
         switch_cpu_list = [
@@ -612,6 +686,22 @@ def run(options, root, testsys, cpu_class):
     checkpoint_dir = None
     if options.checkpoint_restore:
         cpt_starttick, checkpoint_dir = findCptDir(options, cptdir, testsys)
+    # Simulate each core, and the caches and devices under it, on its own
+    # host thread
+    if options.parallel:
+        if options.ruby:
+            fatal("Parallel simulation needs the classic memory system")
+        from m5 import partition
+        cpu_lists = [getattr(testsys, name) for name in
+                     ('cpu', 'switch_cpus', 'switch_cpus_1',
+                      'repeat_switch_cpus') if hasattr(testsys, name)]
+        partition.partition_cores(root, cpu_lists)
+
+    if options.eventq_calendar:
+        root.eventq_calendar_buckets = options.eventq_calendar
+    if options.host_profile:
+        root.host_profile = options.host_profile
+
     root.apply_config(options.param)
     m5.instantiate(checkpoint_dir)
 
@@ -657,7 +747,7 @@ def run(options, root, testsys, cpu_class):
         fatal("Bad maxtick (%d) specified: " \
               "Checkpoint starts starts from tick: %d", maxtick, cpt_starttick)
 
-    if options.standard_switch or cpu_class:
+    if (options.standard_switch or cpu_class) and not isSampling(options):
         if options.standard_switch:
             print("Switch at instruction count:%s" %
                     str(testsys.cpu[0].max_insts_any_thread))
@@ -714,6 +804,13 @@ def run(options, root, testsys, cpu_class):
     elif options.restore_simpoint_checkpoint:
         restoreSimpointCheckpoint()
 
+    elif isSampling(options):
+        exit_event = sampleWorkload(options, testsys, switch_cpu_list)
+        if exit_event is None:
+            print('Exiting @ tick %i because sampling is complete' %
+                  m5.curTick())
+            return
+
     else:
         if options.fast_forward:
             m5.stats.reset()
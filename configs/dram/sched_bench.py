@@ -0,0 +1,146 @@
+# Host performance benchmark of the memory controller scheduler
+#
+# Drives a number of interleaved DRAM channels with traffic generators
+# that issue more requests than the channels can serve, so the read and
+# write queues of the controllers stay full.  With deep queues the time
+# taken by each scheduling decision dominates the simulation, so the host
+# time reported at the end reflects the cost of the scheduler.
+#
+# Examples:
+#
+#   build/X86/gem5.opt configs/dram/sched_bench.py
+#
+#   build/X86/gem5.opt configs/dram/sched_bench.py --mem-channels 8 \
+#       --buffer-size 256 --mem-sched fcfs --mode LINEAR
+#
+# The stats of the controllers, e.g. their row hit rates and bus
+# utilisation, are in m5out/stats.txt as usual, and should not change
+# with the host performance of the scheduler.
+
+import argparse
+import time
+
+import m5
+from m5.objects import *
+from m5.util import addToPath, convert, fatal
+
+addToPath('../')
+
+from common import ObjectList
+from common import MemConfig
+
+parser = argparse.ArgumentParser()
+
+parser.add_argument("--mem-type", default="DDR4_2400_8x8",
+                    choices=ObjectList.mem_list.get_names(),
+                    help="type of memory to use")
+
+parser.add_argument("--mem-channels", type=int, default=4,
+                    help="number of interleaved memory channels")
+
+parser.add_argument("--mem-ranks", "-r", type=int, default=2,
+                    help="number of ranks per channel")
+
+parser.add_argument("--mem-sched", default="frfcfs",
+                    choices=["fcfs", "frfcfs"],
+                    help="memory scheduling policy")
+
+parser.add_argument("--buffer-size", type=int, default=128,
+                    help="entries of each controller's read and write "
+                    "queues")
+
+parser.add_argument("--generators", type=int, default=4,
+                    help="number of traffic generators")
+
+parser.add_argument("--mode", default="RANDOM",
+                    choices=["RANDOM", "LINEAR"],
+                    help="address pattern of the generators")
+
+parser.add_argument("--rd_perc", type=int, default=70,
+                    help="percentage of read requests")
+
+parser.add_argument("--load", type=float, default=2.0,
+                    help="offered load, relative to the peak bandwidth "
+                    "of the channels")
+
+parser.add_argument("--duration", default="1ms",
+                    help="simulated time to run the generators for")
+
+args = parser.parse_args()
+
+system = System(membus=SystemXBar(width=64))
+system.clk_domain = SrcClockDomain(clock='2.0GHz',
+                                   voltage_domain=VoltageDomain(voltage='1V'))
+
+mem_range = AddrRange('1GB')
+system.mem_ranges = [mem_range]
+
+# do not worry about reserving space for the backing store
+system.mmap_using_noreserve = True
+
+args.mem_channels_intlv = 256
+args.external_memory_system = 0
+args.tlm_memory = 0
+args.elastic_trace_en = 0
+MemConfig.config_mem(args, system)
+
+for ctrl in system.mem_ctrls:
+    if not isinstance(ctrl, m5.objects.MemCtrl) or \
+       not isinstance(ctrl.dram, m5.objects.DRAMInterface):
+        fatal("This script assumes MemCtrl controllers of DRAM")
+
+    # there is no point slowing things down by saving any data
+    ctrl.dram.null = True
+    ctrl.dram.read_buffer_size = args.buffer_size
+    ctrl.dram.write_buffer_size = args.buffer_size
+    ctrl.mem_sched_policy = args.mem_sched
+
+dram = system.mem_ctrls[0].dram
+burst_size = int((dram.devices_per_rank.value *
+                  dram.device_bus_width.value *
+                  dram.burst_length.value) / 8)
+
+# the period between requests of each generator, in ticks, for the
+# generators together to offer the load asked for
+burst_ticks = getattr(dram.tBURST_MIN, 'value', dram.tBURST.value) * \
+    1000000000000
+itt = int(burst_ticks * args.generators /
+          (args.mem_channels * args.load))
+
+system.tgens = [ PyTrafficGen() for i in range(args.generators) ]
+for tgen in system.tgens:
+    tgen.port = system.membus.cpu_side_ports
+
+# connect the system port even if it is not used in this example
+system.system_port = system.membus.cpu_side_ports
+
+root = Root(full_system=False, system=system)
+root.system.mem_mode = 'timing'
+
+m5.instantiate()
+
+duration = m5.ticks.fromSeconds(convert.toLatency(args.duration))
+
+def trace(tgen):
+    if args.mode == "RANDOM":
+        yield tgen.createRandom(duration, 0, mem_range.end, burst_size,
+                                itt, itt, args.rd_perc, 0)
+    else:
+        yield tgen.createLinear(duration, 0, mem_range.end, burst_size,
+                                itt, itt, args.rd_perc, 0)
+    yield tgen.createExit(0)
+
+for tgen in system.tgens:
+    tgen.start(trace(tgen))
+
+start = time.time()
+event = m5.simulate()
+host_seconds = time.time() - start
+
+print("Scheduler benchmark: %d channels, %d ranks, %s, %d entry queues, "
+      "%d generators at %d ticks" %
+      (args.mem_channels, args.mem_ranks, args.mem_sched, args.buffer_size,
+       args.generators, itt))
+print("Exited @ tick %i because %s" % (m5.curTick(), event.getCause()))
+print("Host seconds: %.2f, simulated ticks per host second: %.0f" %
+      (host_seconds, m5.curTick() / host_seconds))
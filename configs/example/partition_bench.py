@@ -0,0 +1,100 @@
+# Host performance benchmark of partitioned parallel simulation
+#
+# Simulates a number of traffic generator cores, each with a private L1,
+# sharing an L2 and memory.  With --parallel, each core and its L1 is
+# simulated by a host thread of its own (see m5.partition), otherwise the
+# whole system is simulated by one thread.  Running the same configuration
+# both ways gives the speedup of the partitioning.
+#
+# Examples:
+#
+#   build/NULL/gem5.opt configs/example/partition_bench.py --cores 8
+#
+#   build/NULL/gem5.opt configs/example/partition_bench.py --cores 8 \
+#       --parallel
+#
+# The quantum is the shortest latency of the channels joining the
+# partitions, here the L2XBar's, so the speedup grows with the work done
+# by each core between quantum barriers.
+
+import argparse
+import time
+
+import m5
+from m5 import partition
+from m5.objects import *
+from m5.util import convert
+
+parser = argparse.ArgumentParser()
+
+parser.add_argument("--cores", type=int, default=8,
+                    help="number of cores")
+
+parser.add_argument("--parallel", action="store_true",
+                    help="simulate each core on its own host thread")
+
+parser.add_argument("--duration", default="1ms",
+                    help="simulated time to run the cores for")
+
+parser.add_argument("--period", default="1ns",
+                    help="time between the requests of each core")
+
+args = parser.parse_args()
+
+system = System(cache_line_size=64, mem_ranges=[AddrRange('256MB')])
+system.clk_domain = SrcClockDomain(clock='2.0GHz',
+                                   voltage_domain=VoltageDomain(voltage='1V'))
+
+system.membus = SystemXBar()
+system.system_port = system.membus.cpu_side_ports
+system.physmem = SimpleMemory(range=system.mem_ranges[0])
+system.physmem.port = system.membus.mem_side_ports
+
+system.l2bus = L2XBar()
+system.l2 = Cache(size='1MB', assoc=16, tag_latency=10, data_latency=10,
+                  response_latency=10, mshrs=32, tgts_per_mshr=12)
+system.l2bus.mem_side_ports = system.l2.cpu_side
+system.l2.mem_side = system.membus.cpu_side_ports
+
+# Each core reads a region of its own at a fixed rate.  Random
+# generators would share the global random number generator between the
+# host threads
+system.cpu = [PyTrafficGen() for i in range(args.cores)]
+for cpu in system.cpu:
+    cpu.l1 = Cache(size='32kB', assoc=4, tag_latency=2, data_latency=2,
+                   response_latency=2, mshrs=4, tgts_per_mshr=8)
+    cpu.port = cpu.l1.cpu_side
+    cpu.l1.mem_side = system.l2bus.cpu_side_ports
+
+root = Root(full_system=False, system=system)
+root.system.mem_mode = 'timing'
+
+num_partitions = 1
+if args.parallel:
+    num_partitions = partition.partition_cores(root, [system.cpu])
+
+m5.instantiate()
+
+duration = m5.ticks.fromSeconds(convert.toLatency(args.duration))
+region_size = 0x100000
+period = m5.ticks.fromSeconds(convert.toLatency(args.period))
+
+def trace(cpu, i):
+    start_addr = i * region_size
+    yield cpu.createLinear(duration, start_addr, start_addr + region_size,
+                           system.cache_line_size.value, period, period,
+                           100, 0)
+    yield cpu.createExit(0)
+
+for i, cpu in enumerate(system.cpu):
+    cpu.start(trace(cpu, i))
+
+start = time.time()
+event = m5.simulate()
+host_seconds = time.time() - start
+
+print("Partition benchmark: %d cores on %d event queues" %
+      (args.cores, num_partitions))
+print("Exited @ tick %i because %s" % (m5.curTick(), event.getCause()))
+print("Host seconds: %.2f, simulated ticks per host second: %.0f" %
+      (host_seconds, m5.curTick() / host_seconds))
@@ -0,0 +1,78 @@
+# LVPU configuration sweep over a recorded LVP trace
+#
+# Replays a trace written by spec_se.py --lvp-trace through one LVPU per
+# configuration, without simulating a CPU.  Table options take a comma
+# separated list of values and every combination is replayed, each by a
+# replayer of its own.  The stats of all of them are dumped at the end.
+#
+# Example:
+#
+#   build/ECE565-ARM/gem5.opt configs/spec/lvpu_replay.py \
+#       --trace m5out/lvp_trace.pb.gz \
+#       --num_lvpt_entries 512,1024,2048 --lct_bits_per_entry 1,2
+
+import argparse
+import itertools
+
+import m5
+from m5.objects import *
+
+# Options swept over, named as in spec_se.py and the LVPTraceReplayer
+# parameters
+SWEPT_OPTIONS = ["num_lvpt_entries", "num_lct_entries", "num_cvt_entries",
+                 "lvpt_assoc", "lct_assoc", "cvt_assoc",
+                 "lct_bits_per_entry", "lvpu_policy", "value_pred_type"]
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--trace", required=True,
+                    help="LVP trace recorded by spec_se.py --lvp-trace")
+parser.add_argument("--max_records", type=int, default=0,
+                    help="Loads and stores to replay, 0 for the whole trace")
+parser.add_argument("--lvpt_max_vec_bytes", type=int, default=16,
+                    help="Must match the recording CPU")
+parser.add_argument("--num_lvpt_entries", default="1024")
+parser.add_argument("--num_lct_entries", default="1024")
+parser.add_argument("--num_cvt_entries", default="1024")
+parser.add_argument("--lvpt_assoc", default="4")
+parser.add_argument("--lct_assoc", default="4")
+parser.add_argument("--cvt_assoc", default="4")
+parser.add_argument("--lct_bits_per_entry", default="1")
+parser.add_argument("--lvpu_policy", default="none",
+                    help="Comma separated policies, see spec_se.py")
+parser.add_argument("--value_pred_type", default="LastValuePredictor",
+                    help="Comma separated value predictors, see spec_se.py")
+
+args = parser.parse_args()
+
+values = [getattr(args, name).split(",") for name in SWEPT_OPTIONS]
+points = [dict(zip(SWEPT_OPTIONS, point))
+          for point in itertools.product(*values)]
+
+replayers = []
+for point in points:
+    replayers.append(LVPTraceReplayer(
+        trace_file = args.trace,
+        max_records = args.max_records,
+        lvpt_max_vec_bytes = args.lvpt_max_vec_bytes,
+        num_lvpt_entries = point["num_lvpt_entries"],
+        num_lct_entries = point["num_lct_entries"],
+        num_cvt_entries = point["num_cvt_entries"],
+        lvpt_assoc = int(point["lvpt_assoc"]),
+        lct_assoc = int(point["lct_assoc"]),
+        cvt_assoc = int(point["cvt_assoc"]),
+        lct_bits_per_entry = int(point["lct_bits_per_entry"]),
+        lvpu_policy = point["lvpu_policy"],
+        valuePred = getattr(m5.objects, point["value_pred_type"])()))
+
+root = Root(full_system = False, replayer = replayers)
+
+m5.instantiate()
+
+# Each replayer exits the simulation loop once it has replayed the trace
+for replayer in replayers:
+    m5.simulate()
+
+for replayer, point in zip(replayers, points):
+    print("%s: %s" % (replayer.path(), " ".join(
+        "%s=%s" % item for item in sorted(point.items()))))
+m5.stats.dump()
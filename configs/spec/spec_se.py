@@ -129,11 +129,25 @@ if '--ruby' in sys.argv:
 parser.add_argument("-b", "--benchmark", default="",
                  help="The benchmark to be loaded.")
 
-parser.add_argument("--num_lvpt_entries", type=int, default=1000)
-parser.add_argument("--num_lct_entries", type=int, default=1000)
-parser.add_argument("--num_cvt_entries", type=int, default=1000)
+parser.add_argument("--num_lvpt_entries", type=int, default=1024)
+parser.add_argument("--num_lct_entries", type=int, default=1024)
+parser.add_argument("--num_cvt_entries", type=int, default=1024)
+parser.add_argument("--lvpt_assoc", type=int, default=4)
+parser.add_argument("--lct_assoc", type=int, default=4)
+parser.add_argument("--cvt_assoc", type=int, default=4)
 parser.add_argument("--lct_bits_per_entry", type=int, default=1)
-parser.add_argument("--lvpu_hacks", type=str)
+parser.add_argument("--lvpt_max_vec_bytes", type=int, default=16)
+parser.add_argument("--lvpu_policy", "--lvpu_hacks", dest="lvpu_policy",
+                    default="none",
+                    choices=["none", "never_predictable", "constant_only",
+                             "no_constants", "disabled"])
+parser.add_argument("--value_pred_type", default="LastValuePredictor",
+                    choices=["LastValuePredictor", "StrideValuePredictor",
+                             "FCMValuePredictor", "VTAGEValuePredictor"],
+                    help="Value predictor used by the LVPU")
+parser.add_argument("--lvpu_selective_replay", action="store_true",
+                    help="Replay the consumers of mispredicted load values"
+                         " instead of flushing the pipeline")
 
 args = parser.parse_args()
 
@@ -177,6 +191,7 @@ multiprocesses.append(process)
 (CPUClass, test_mem_mode, FutureClass) = Simulation.setCPUClass(args)
 CPUClass.numThreads = numThreads
 
+
 # Check -- do not allow SMT with multiple CPUs
 if args.smt and args.num_cpus > 1:
     fatal("You cannot use SMT with multiple CPUs!")
@@ -206,11 +221,24 @@ system.cpu_clk_domain = SrcClockDomain(clock = args.cpu_clock,
                                        voltage_domain =
                                        system.cpu_voltage_domain)
 
+# Apply the load value prediction options.  Simulation.run() applies them
+# to the CPUs it switches to after fast forwarding or restoring a checkpoint
+CpuConfig.config_lvp(system.cpu, args)
+
 # If elastic tracing is enabled, then configure the cpu and attach the elastic
 # trace probe
 if args.elastic_trace_en:
     CpuConfig.config_etrace(CPUClass, system.cpu, args)
 
+# Record an LVP trace of the Minor CPUs.  When fast forwarding they are only
+# created by Simulation.run(), which attaches the recorder itself
+if args.lvp_trace and not FutureClass:
+    CpuConfig.config_lvp_trace(CPUClass, system.cpu, args)
+
+# Likewise profile the loads of the CPUs that will be measured
+if args.load_profile and not FutureClass:
+    CpuConfig.config_load_profiler(system.cpu, args)
+
 # All cpus belong to a common cpu_clk_domain, therefore running at a common
 # frequency.
 for cpu in system.cpu:
@@ -258,11 +286,6 @@ for i in range(np):
 
     system.cpu[i].createThreads()
 
-    system.cpu[i].num_lvpt_entries = args.num_lvpt_entries
-    system.cpu[i].num_lct_entries = args.num_lct_entries
-    system.cpu[i].num_cvt_entries = args.num_cvt_entries
-    system.cpu[i].lct_bits_per_entry = args.lct_bits_per_entry
-    system.cpu[i].lvpu_hacks = args.lvpu_hacks
     
 
 if args.ruby:
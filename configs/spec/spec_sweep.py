@@ -0,0 +1,297 @@
+#!/usr/bin/env python3
+#
+# Design space sweep driver for spec_se.py
+#
+# Runs every point of a parameter grid for each benchmark as a separate
+# gem5 process, several at a time, each in its own output directory.
+# Points that already finished are skipped, so an interrupted sweep can be
+# restarted and a grid extended without rerunning anything.  The selected
+# stats of every point are collected into one CSV and one JSON table.
+#
+# Examples:
+#
+#   configs/spec/spec_sweep.py -b sjeng lbm \
+#       --param num_lvpt_entries=1024,2048 --param lct_bits_per_entry=1,2
+#
+#   configs/spec/spec_sweep.py -b sjeng --grid-file grid.json -j 16
+#
+# A grid file holds either one grid, {"name": [values, ...], ...}, or a
+# list of them.  Each grid is expanded to the cartesian product of its
+# values and the points of all grids are swept.  Parameter names are
+# spec_se.py options without the leading dashes.  A value of true passes
+# a flag option without a value.
+
+import argparse
+import concurrent.futures
+import csv
+import itertools
+import json
+import os
+import re
+import subprocess
+import sys
+import time
+
+# Name of the file recording a finished point in its output directory
+POINT_FILE = "sweep_point.json"
+
+# The configurations lvpu_test.cmd runs, used when no grid is given
+DEFAULT_GRIDS = [
+    {"lvpu_policy": ["never_predictable"], "lct_bits_per_entry": [1]},
+    {"lvpu_policy": ["none"], "lct_bits_per_entry": [1],
+     "num_lvpt_entries": [1024], "num_lct_entries": [1024],
+     "num_cvt_entries": [256]},
+    {"lvpu_policy": ["none"], "lct_bits_per_entry": [1, 2],
+     "num_lvpt_entries": [2048], "num_lct_entries": [2048],
+     "num_cvt_entries": [1024]},
+]
+
+DEFAULT_BASE_ARGS = ("--cpu-type=MinorCPU --caches --l2cache "
+                     "--l1d_size=64kB --l1i_size=16kB --maxinsts=10000000")
+
+DEFAULT_STATS = ["ipc", "cpi", "lvpu", "simInsts", "simSeconds"]
+
+
+def parse_value(value):
+    """Values from the command line are kept as strings unless they are
+    flags, so sizes like 64kB pass through unchanged"""
+    if value.lower() == "true":
+        return True
+    if value.lower() == "false":
+        return False
+    return value
+
+
+def expand_grid(grid):
+    names = sorted(grid)
+    values = [v if isinstance(v, list) else [v] for v in
+              (grid[name] for name in names)]
+    for combination in itertools.product(*values):
+        yield dict(zip(names, combination))
+
+
+def load_grids(args):
+    grids = []
+    if args.grid_file:
+        with open(args.grid_file) as grid_file:
+            loaded = json.load(grid_file)
+        grids.extend(loaded if isinstance(loaded, list) else [loaded])
+    if args.param:
+        grid = {}
+        for param in args.param:
+            name, sep, values = param.partition("=")
+            if not sep:
+                sys.exit("--param %s is not of the form name=v1,v2" % param)
+            grid[name.lstrip("-")] = [parse_value(v) for v in
+                                      values.split(",")]
+        grids.append(grid)
+    return grids or DEFAULT_GRIDS
+
+
+def point_name(benchmark, point):
+    """Output directory of a point, relative to the sweep directory"""
+    parts = ["%s-%s" % (name, value) for name, value in sorted(point.items())]
+    name = "_".join(parts) or "default"
+    return os.path.join(benchmark, re.sub(r"[^A-Za-z0-9_.=-]", "", name))
+
+
+def point_args(point):
+    args = []
+    for name, value in sorted(point.items()):
+        if value is True:
+            args.append("--%s" % name)
+        elif value is not False:
+            args.append("--%s=%s" % (name, value))
+    return args
+
+
+def parse_stats(stats_path, patterns):
+    """Stats of the first dump in stats_path whose names match one of
+    patterns"""
+    regex = re.compile("|".join(patterns))
+    stats = {}
+    with open(stats_path) as stats_file:
+        for line in stats_file:
+            if line.startswith("---------- End Simulation Statistics"):
+                break
+            fields = line.split()
+            if len(fields) < 2 or fields[0].startswith("-"):
+                continue
+            name = fields[0]
+            if not regex.search(name):
+                continue
+            try:
+                stats[name] = float(fields[1])
+            except ValueError:
+                stats[name] = fields[1]
+    return stats
+
+
+def stats_complete(stats_path):
+    if not os.path.exists(stats_path):
+        return False
+    with open(stats_path) as stats_file:
+        return any(line.startswith("---------- End Simulation Statistics")
+                   for line in stats_file)
+
+
+def run_point(args, benchmark, point, outdir):
+    """Run one point and record it as finished if gem5 exited cleanly"""
+    os.makedirs(outdir, exist_ok=True)
+    command = ([args.gem5, "-d", outdir, args.config, "-b", benchmark] +
+               args.base_args.split() + point_args(point))
+
+    start = time.time()
+    with open(os.path.join(outdir, "simout"), "w") as simout, \
+            open(os.path.join(outdir, "simerr"), "w") as simerr:
+        returncode = subprocess.call(command, stdout=simout, stderr=simerr)
+    wall_time = time.time() - start
+
+    stats_path = os.path.join(outdir, "stats.txt")
+    record = {
+        "benchmark": benchmark,
+        "params": point,
+        "command": command,
+        "returncode": returncode,
+        "wall_time": wall_time,
+    }
+    if returncode != 0 or not stats_complete(stats_path):
+        record["status"] = "failed"
+        return record
+
+    record["status"] = "done"
+    record["stats"] = parse_stats(stats_path, args.stat)
+    with open(os.path.join(outdir, POINT_FILE), "w") as point_file:
+        json.dump(record, point_file, indent=2)
+    return record
+
+
+def write_tables(args, records):
+    param_names = sorted({name for r in records for name in r["params"]})
+    stat_names = sorted({name for r in records
+                         for name in r.get("stats", {})})
+
+    with open(args.json, "w") as json_file:
+        json.dump(records, json_file, indent=2)
+
+    with open(args.csv, "w", newline="") as csv_file:
+        writer = csv.writer(csv_file)
+        writer.writerow(["benchmark", "status", "wall_time"] +
+                        param_names + stat_names)
+        for r in records:
+            writer.writerow(
+                [r["benchmark"], r["status"], "%.1f" % r["wall_time"]] +
+                [r["params"].get(name, "") for name in param_names] +
+                [r.get("stats", {}).get(name, "") for name in stat_names])
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Run a parameter sweep of spec_se.py in parallel")
+    parser.add_argument("-b", "--benchmarks", nargs="+", required=True,
+                        help="Benchmarks to run every point for")
+    parser.add_argument("--param", action="append", default=[],
+                        metavar="NAME=V1,V2,...",
+                        help="Sweep a spec_se.py option over the given "
+                        "values.  Repeat for a grid over several options")
+    parser.add_argument("--grid-file",
+                        help="JSON grid, or list of grids, to sweep")
+    parser.add_argument("--base-args", default=DEFAULT_BASE_ARGS,
+                        help="spec_se.py options shared by every point "
+                        "(default: %(default)s)")
+    parser.add_argument("--gem5", default="build/ECE565-ARM/gem5.opt",
+                        help="gem5 binary (default: %(default)s)")
+    parser.add_argument("--config", default="configs/spec/spec_se.py",
+                        help="gem5 config script (default: %(default)s)")
+    parser.add_argument("-j", "--jobs", type=int, default=os.cpu_count(),
+                        help="Simulations run at once (default: number of "
+                        "cores)")
+    parser.add_argument("-d", "--outdir", default="sweep_out",
+                        help="Directory holding an output directory per "
+                        "point (default: %(default)s)")
+    parser.add_argument("--stat", action="append",
+                        help="Regular expression selecting stats to "
+                        "collect.  Repeat for several (default: %s)" %
+                        " ".join(DEFAULT_STATS))
+    parser.add_argument("--csv", help="Results table (default: "
+                        "OUTDIR/results.csv)")
+    parser.add_argument("--json", help="Results table (default: "
+                        "OUTDIR/results.json)")
+    parser.add_argument("--force", action="store_true",
+                        help="Rerun points that already finished")
+    parser.add_argument("-n", "--dry-run", action="store_true",
+                        help="Print the commands of points to run and exit")
+    args = parser.parse_args()
+
+    args.stat = args.stat or DEFAULT_STATS
+    args.outdir = os.path.abspath(args.outdir)
+    args.csv = args.csv or os.path.join(args.outdir, "results.csv")
+    args.json = args.json or os.path.join(args.outdir, "results.json")
+
+    points = []
+    seen = set()
+    for grid in load_grids(args):
+        for point in expand_grid(grid):
+            for benchmark in args.benchmarks:
+                name = point_name(benchmark, point)
+                if name not in seen:
+                    seen.add(name)
+                    points.append((benchmark, point,
+                                   os.path.join(args.outdir, name)))
+
+    records = []
+    pending = []
+    for benchmark, point, outdir in points:
+        point_path = os.path.join(outdir, POINT_FILE)
+        if not args.force and os.path.exists(point_path):
+            with open(point_path) as point_file:
+                records.append(json.load(point_file))
+        else:
+            pending.append((benchmark, point, outdir))
+
+    print("%d points, %d already finished, %d to run with %d jobs" %
+          (len(points), len(records), len(pending), args.jobs))
+
+    if args.dry_run:
+        for benchmark, point, outdir in pending:
+            print(" ".join([args.gem5, "-d", outdir, args.config, "-b",
+                            benchmark] + args.base_args.split() +
+                           point_args(point)))
+        return
+
+    # Longest first keeps the sweep close to its longest single run.
+    # Points that were run before but failed have a known time
+    def expected_time(pending_point):
+        try:
+            with open(os.path.join(pending_point[2], "wall_time")) as f:
+                return float(f.read())
+        except (OSError, ValueError):
+            return float("inf")
+    pending.sort(key=expected_time, reverse=True)
+
+    failed = 0
+    with concurrent.futures.ThreadPoolExecutor(max_workers=args.jobs) as pool:
+        futures = {pool.submit(run_point, args, *p): p for p in pending}
+        for done, future in enumerate(
+                concurrent.futures.as_completed(futures), 1):
+            record = future.result()
+            outdir = futures[future][2]
+            with open(os.path.join(outdir, "wall_time"), "w") as f:
+                f.write("%.1f\n" % record["wall_time"])
+            if record["status"] != "done":
+                failed += 1
+            print("[%d/%d] %s %s in %.0fs" %
+                  (done, len(pending), os.path.relpath(outdir, args.outdir),
+                   record["status"], record["wall_time"]))
+            records.append(record)
+
+    records.sort(key=lambda r: point_name(r["benchmark"], r["params"]))
+    write_tables(args, records)
+    print("Results written to %s and %s" % (args.csv, args.json))
+    if failed:
+        sys.exit("%d points failed, see simerr in their output directories"
+                 % failed)
+
+
+if __name__ == "__main__":
+    main()
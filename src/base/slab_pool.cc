@@ -0,0 +1,178 @@
+#include "base/slab_pool.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+const std::size_t numClasses = SlabPool::maxPooledSize / SlabPool::granule;
+const std::size_t blocksPerSlab = 64;
+
+struct FreeBlock
+{
+    FreeBlock *next;
+};
+
+std::atomic<unsigned> numPools(0);
+
+} // anonymous namespace
+
+struct SlabPool::ThreadPool
+{
+    /** Freed blocks of each size class */
+    FreeBlock *freeLists[numClasses] = {};
+
+    /** The part of the latest slab of each class yet to be handed out */
+    char *slabNext[numClasses] = {};
+    std::size_t slabLeft[numClasses] = {};
+
+    Counter allocations = 0;
+    Counter reuses = 0;
+};
+
+namespace
+{
+
+/** The thread pools of the running threads in each pool, for the totals,
+ *  and the counts of those that have exited */
+struct PoolThreads
+{
+    std::vector<const SlabPool::ThreadPool *> running;
+    Counter exitedAllocations = 0;
+    Counter exitedReuses = 0;
+};
+
+std::mutex poolsMutex;
+
+PoolThreads &
+poolThreads(unsigned index)
+{
+    // Never destroyed, as threads may exit after static destructors
+    static PoolThreads *pools = new PoolThreads[SlabPool::maxPools];
+    return pools[index];
+}
+
+/** The thread pools of one thread, created on its first allocation from
+ *  each pool */
+struct ThreadPools
+{
+    SlabPool::ThreadPool *pools[SlabPool::maxPools] = {};
+
+    ~ThreadPools()
+    {
+        std::lock_guard<std::mutex> lock(poolsMutex);
+        for (unsigned i = 0; i < SlabPool::maxPools; ++i) {
+            if (!pools[i])
+                continue;
+            PoolThreads &threads = poolThreads(i);
+            threads.running.erase(std::find(threads.running.begin(),
+                                            threads.running.end(),
+                                            pools[i]));
+            threads.exitedAllocations += pools[i]->allocations;
+            threads.exitedReuses += pools[i]->reuses;
+            // The slabs stay allocated, as other threads may hold blocks
+            delete pools[i];
+        }
+    }
+};
+
+thread_local ThreadPools threadPools;
+
+} // anonymous namespace
+
+SlabPool::SlabPool()
+    : index(numPools++)
+{
+    fatal_if(index >= maxPools, "Only %d slab pools are supported",
+             maxPools);
+}
+
+SlabPool::ThreadPool &
+SlabPool::threadPool()
+{
+    ThreadPool *&pool = threadPools.pools[index];
+    if (!pool) {
+        pool = new ThreadPool;
+        std::lock_guard<std::mutex> lock(poolsMutex);
+        poolThreads(index).running.push_back(pool);
+    }
+    return *pool;
+}
+
+void *
+SlabPool::allocate(std::size_t size)
+{
+    if (size > maxPooledSize)
+        return ::operator new(size);
+
+    ThreadPool &pool = threadPool();
+    unsigned size_class = divCeil(size, granule) - 1;
+    pool.allocations++;
+
+    FreeBlock *block = pool.freeLists[size_class];
+    if (block) {
+        pool.freeLists[size_class] = block->next;
+        pool.reuses++;
+        return block;
+    }
+
+    std::size_t block_size = (size_class + 1) * granule;
+    if (pool.slabLeft[size_class] == 0) {
+        pool.slabNext[size_class] = static_cast<char *>(
+            ::operator new(block_size * blocksPerSlab));
+        pool.slabLeft[size_class] = blocksPerSlab;
+    }
+    void *fresh = pool.slabNext[size_class];
+    pool.slabNext[size_class] += block_size;
+    pool.slabLeft[size_class]--;
+    return fresh;
+}
+
+void
+SlabPool::deallocate(void *block, std::size_t size)
+{
+    if (size > maxPooledSize) {
+        ::operator delete(block);
+        return;
+    }
+
+    ThreadPool &pool = threadPool();
+    unsigned size_class = divCeil(size, granule) - 1;
+    FreeBlock *freed = static_cast<FreeBlock *>(block);
+    freed->next = pool.freeLists[size_class];
+    pool.freeLists[size_class] = freed;
+}
+
+Counter
+SlabPool::allocations() const
+{
+    std::lock_guard<std::mutex> lock(poolsMutex);
+    const PoolThreads &threads = poolThreads(index);
+    Counter total = threads.exitedAllocations;
+    for (const ThreadPool *pool : threads.running)
+        total += pool->allocations;
+    return total;
+}
+
+Counter
+SlabPool::reuses() const
+{
+    std::lock_guard<std::mutex> lock(poolsMutex);
+    const PoolThreads &threads = poolThreads(index);
+    Counter total = threads.exitedReuses;
+    for (const ThreadPool *pool : threads.running)
+        total += pool->reuses;
+    return total;
+}
+
+} // namespace gem5
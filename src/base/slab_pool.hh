@@ -0,0 +1,70 @@
+/**
+ * @file
+ * Declaration of a pool of small heap blocks, for objects created and
+ * deleted at high rates.
+ */
+
+#ifndef __BASE_SLAB_POOL_HH__
+#define __BASE_SLAB_POOL_HH__
+
+#include <cstddef>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * Storage for objects that are allocated and freed at high rates, such
+ * as events, packets and requests.  Blocks are carved from slabs in 16
+ * byte size classes.  Freed blocks are kept on free lists and reused,
+ * rather than going back to the heap, so a simulation in its steady state
+ * doesn't allocate for these objects.  Blocks larger than maxPooledSize
+ * come from the heap.
+ *
+ * Each host thread has its own slabs and free lists in each pool.  A
+ * block freed by another thread than the one that allocated it, e.g. a
+ * packet sent across a partition of the simulated system, joins the
+ * freeing thread's free lists.  Slabs are never returned to the heap, and
+ * pools are meant to live for the whole simulation.
+ */
+class SlabPool
+{
+  public:
+    /** The size classes are multiples of granule bytes */
+    static constexpr std::size_t granule = 16;
+    static constexpr std::size_t maxPooledSize = 512;
+
+    /** The most pools there can be */
+    static constexpr unsigned maxPools = 8;
+
+    SlabPool();
+
+    /** Pools are shared by all threads, so they can't be copied */
+    SlabPool(const SlabPool &) = delete;
+    SlabPool &operator=(const SlabPool &) = delete;
+
+    /** Allocate a block of at least size bytes */
+    void *allocate(std::size_t size);
+
+    /** Free a block allocated from this pool with the same size */
+    void deallocate(void *block, std::size_t size);
+
+    /** Blocks allocated by all threads, and those reused from free lists */
+    Counter allocations() const;
+    Counter reuses() const;
+
+    /** The slabs and free lists of one thread in one pool */
+    struct ThreadPool;
+
+  private:
+    /** The calling thread's slabs and free lists in this pool */
+    ThreadPool &threadPool();
+
+    /** Index of this pool in each thread's pools */
+    const unsigned index;
+};
+
+} // namespace gem5
+
+#endif // __BASE_SLAB_POOL_HH__
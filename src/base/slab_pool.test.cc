@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <thread>
+
+#include "base/slab_pool.hh"
+
+using namespace gem5;
+
+/** A freed block is reused for the next allocation of its size class */
+TEST(SlabPoolTest, Reuse)
+{
+    SlabPool pool;
+    void *first = pool.allocate(40);
+    pool.deallocate(first, 40);
+
+    ASSERT_EQ(pool.allocate(48), first);
+    ASSERT_EQ(pool.allocations(), 2);
+    ASSERT_EQ(pool.reuses(), 1);
+
+    // Another size class has its own free list
+    void *other = pool.allocate(64);
+    ASSERT_NE(other, first);
+    ASSERT_EQ(pool.reuses(), 1);
+}
+
+/** Blocks of a class are carved apart from each other */
+TEST(SlabPoolTest, Distinct)
+{
+    SlabPool pool;
+    char *first = static_cast<char *>(pool.allocate(SlabPool::granule));
+    char *second = static_cast<char *>(pool.allocate(SlabPool::granule));
+    ASSERT_GE(std::abs(second - first), (std::ptrdiff_t)SlabPool::granule);
+}
+
+/** Large blocks come from the heap, and aren't counted */
+TEST(SlabPoolTest, Large)
+{
+    SlabPool pool;
+    void *block = pool.allocate(SlabPool::maxPooledSize + 1);
+    pool.deallocate(block, SlabPool::maxPooledSize + 1);
+    ASSERT_EQ(pool.allocations(), 0);
+}
+
+/** The counts of threads that have exited are kept, and blocks freed by
+ *  another thread are reused by that thread */
+TEST(SlabPoolTest, Threads)
+{
+    SlabPool pool;
+    void *block = pool.allocate(32);
+    std::thread([&]() {
+        pool.deallocate(block, 32);
+        ASSERT_EQ(pool.allocate(32), block);
+    }).join();
+
+    ASSERT_EQ(pool.allocations(), 2);
+    ASSERT_EQ(pool.reuses(), 1);
+}
@@ -0,0 +1,283 @@
+#include "base/stats/columnar.hh"
+
+#include <ostream>
+
+#include "base/logging.hh"
+#include "base/stats/info.hh"
+#include "base/stats/units.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+namespace
+{
+
+const char magic[8] = { 'g', 'e', 'm', '5', 'c', 'o', 'l', '\0' };
+
+const char *const distFields[] = {
+    "samples", "sum", "squares", "min_val", "max_val", "underflow",
+    "overflow", "min", "max", "bucket_size",
+};
+
+} // anonymous namespace
+
+Columnar::Columnar(const std::string &file_name, bool desc)
+    : file(simout.create(file_name, true, true)),
+      enableDescriptions(desc), columns(0), dumpCount(0)
+{
+    if (!valid())
+        fatal("Unable to open statistics file %s for writing\n", file_name);
+}
+
+Columnar::~Columnar()
+{
+    simout.close(file);
+}
+
+void
+Columnar::dumpRecorded()
+{
+    assert(recorded());
+
+    begin();
+    for (Info *info : stats) {
+        info->prepare();
+        info->visit(*this);
+    }
+    end();
+}
+
+void
+Columnar::begin()
+{
+    row.clear();
+}
+
+void
+Columnar::end()
+{
+    if (dumpCount == 0) {
+        columns = row.size();
+        writeSchema();
+    }
+    panic_if(row.size() != columns, "The stats dumped to %s have changed "
+             "since the first dump", file->name());
+
+    std::ostream &os = *file->stream();
+    uint64_t tick = curTick();
+    os.write(reinterpret_cast<const char *>(&tick), sizeof(tick));
+    os.write(reinterpret_cast<const char *>(row.data()),
+             row.size() * sizeof(double));
+    os.flush();
+
+    dumpCount++;
+}
+
+bool
+Columnar::valid() const
+{
+    return file && file->stream()->good();
+}
+
+void
+Columnar::beginGroup(const char *name)
+{
+    if (path.empty())
+        path.push(name);
+    else
+        path.push(path.top() + "." + name);
+}
+
+void
+Columnar::endGroup()
+{
+    assert(!path.empty());
+    path.pop();
+}
+
+bool
+Columnar::addStat(const Info &info, const char *kind,
+                  std::vector<std::string> &&labels)
+{
+    if (!info.flags.isSet(display))
+        return false;
+
+    if (dumpCount == 0) {
+        Schema entry;
+        entry.name = path.empty() ? info.name : path.top() + "." + info.name;
+        entry.kind = kind;
+        entry.unit = info.unit->getUnitString();
+        if (enableDescriptions)
+            entry.desc = info.desc;
+        entry.labels = std::move(labels);
+        schema.push_back(std::move(entry));
+
+        // Outputs only see the stats as const, but dumping them again
+        // needs to prepare them
+        stats.push_back(const_cast<Info *>(&info));
+    }
+
+    return true;
+}
+
+std::vector<std::string>
+Columnar::vectorLabels(const std::vector<std::string> &subnames,
+                       size_type size)
+{
+    std::vector<std::string> labels(size);
+    for (size_type i = 0; i < size; ++i) {
+        if (i < subnames.size() && !subnames[i].empty())
+            labels[i] = subnames[i];
+        else
+            labels[i] = std::to_string(i);
+    }
+    return labels;
+}
+
+void
+Columnar::distLabels(const std::string &prefix, const DistData &data,
+                     std::vector<std::string> &labels)
+{
+    for (const char *field : distFields)
+        labels.push_back(prefix + field);
+    for (size_type i = 0; i < data.cvec.size(); ++i)
+        labels.push_back(prefix + std::to_string(i));
+}
+
+void
+Columnar::appendDist(const DistData &data)
+{
+    row.insert(row.end(), {
+        (double)data.samples, (double)data.sum, (double)data.squares,
+        (double)data.min_val, (double)data.max_val, (double)data.underflow,
+        (double)data.overflow, (double)data.min, (double)data.max,
+        (double)data.bucket_size,
+    });
+    row.insert(row.end(), data.cvec.begin(), data.cvec.end());
+}
+
+void
+Columnar::visit(const ScalarInfo &info)
+{
+    if (addStat(info, "scalar", dumpCount ? std::vector<std::string>() :
+                std::vector<std::string>(1))) {
+        row.push_back(info.result());
+    }
+}
+
+void
+Columnar::visit(const VectorInfo &info)
+{
+    const char *kind =
+        dynamic_cast<const FormulaInfo *>(&info) ? "formula" : "vector";
+    if (addStat(info, kind, dumpCount ? std::vector<std::string>() :
+                vectorLabels(info.subnames, info.size()))) {
+        const VResult &result = info.result();
+        row.insert(row.end(), result.begin(), result.end());
+    }
+}
+
+void
+Columnar::visit(const DistInfo &info)
+{
+    std::vector<std::string> labels;
+    if (dumpCount == 0)
+        distLabels("", info.data, labels);
+    if (addStat(info, "dist", std::move(labels)))
+        appendDist(info.data);
+}
+
+void
+Columnar::visit(const VectorDistInfo &info)
+{
+    std::vector<std::string> labels;
+    if (dumpCount == 0) {
+        std::vector<std::string> subnames =
+            vectorLabels(info.subnames, info.size());
+        for (size_type i = 0; i < info.size(); ++i)
+            distLabels(subnames[i] + ".", info.data[i], labels);
+    }
+    if (addStat(info, "vector_dist", std::move(labels))) {
+        for (const auto &data : info.data)
+            appendDist(data);
+    }
+}
+
+void
+Columnar::visit(const Vector2dInfo &info)
+{
+    std::vector<std::string> labels;
+    if (dumpCount == 0) {
+        std::vector<std::string> x_labels =
+            vectorLabels(info.subnames, info.x);
+        std::vector<std::string> y_labels =
+            vectorLabels(info.y_subnames, info.y);
+        for (const auto &x_label : x_labels) {
+            for (const auto &y_label : y_labels)
+                labels.push_back(x_label + "." + y_label);
+        }
+    }
+    if (addStat(info, "vector2d", std::move(labels)))
+        row.insert(row.end(), info.cvec.begin(), info.cvec.end());
+}
+
+void
+Columnar::visit(const FormulaInfo &info)
+{
+    visit((const VectorInfo &)info);
+}
+
+void
+Columnar::visit(const SparseHistInfo &info)
+{
+    warn_once("Columnar stat files don't support sparse histograms.\n");
+}
+
+void
+Columnar::writeString(const std::string &str)
+{
+    uint32_t length = str.size();
+    file->stream()->write(reinterpret_cast<const char *>(&length),
+                          sizeof(length));
+    file->stream()->write(str.data(), length);
+}
+
+void
+Columnar::writeSchema()
+{
+    std::ostream &os = *file->stream();
+    os.write(magic, sizeof(magic));
+    os.write(reinterpret_cast<const char *>(&version), sizeof(version));
+
+    uint32_t num_stats = schema.size();
+    os.write(reinterpret_cast<const char *>(&num_stats), sizeof(num_stats));
+    for (const auto &entry : schema) {
+        writeString(entry.name);
+        writeString(entry.kind);
+        writeString(entry.unit);
+        writeString(entry.desc);
+
+        uint32_t num_columns = entry.labels.size();
+        os.write(reinterpret_cast<const char *>(&num_columns),
+                 sizeof(num_columns));
+        for (const auto &label : entry.labels)
+            writeString(label);
+    }
+
+    // The schema isn't needed once written
+    schema.clear();
+    schema.shrink_to_fit();
+}
+
+std::unique_ptr<Output>
+initColumnar(const std::string &filename, bool desc)
+{
+    return std::unique_ptr<Output>(new Columnar(filename, desc));
+}
+
+} // namespace statistics
+} // namespace gem5
@@ -0,0 +1,133 @@
+/**
+ * @file
+ * Binary stats output which writes the names of the stats once and then
+ * a row of raw values for each dump.
+ */
+
+#ifndef __BASE_STATS_COLUMNAR_HH__
+#define __BASE_STATS_COLUMNAR_HH__
+
+#include <cstdint>
+#include <memory>
+#include <stack>
+#include <string>
+#include <vector>
+
+#include "base/output.hh"
+#include "base/stats/output.hh"
+#include "base/stats/types.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+/**
+ * Stats output for frequent dumps.  The first dump writes a schema, the
+ * name, kind, unit and description of each stat and the labels of its
+ * columns.  Each dump then appends a row with the tick and the value of
+ * every column as doubles, in host byte order, without formatting them.
+ * m5.stats.columnar reads the file back as a column per stat.
+ *
+ * The stats dumped the first time are recorded, so later dumps can
+ * prepare and visit them directly, rather than walking the stat groups.
+ * Every row holds all of them, even if only some were asked for.
+ * Distributions are dumped as their raw counters and buckets.  Sparse
+ * histograms, whose columns change from dump to dump, are left out.
+ *
+ * The file starts with the magic "gem5col", a NUL and a 32 bit version.
+ * Strings are a 32 bit length followed by the characters.
+ * The schema is the number of stats and then, for each stat, its name,
+ * kind, unit and description, its number of columns and their labels.
+ * The rows follow, each a 64 bit tick and a double per column.
+ */
+class Columnar : public Output
+{
+  public:
+    static constexpr uint32_t version = 1;
+
+    Columnar(const std::string &file, bool desc);
+    ~Columnar();
+
+    Columnar() = delete;
+    Columnar(const Columnar &other) = delete;
+
+    /** Whether the stats to dump have been recorded by a first dump */
+    bool recorded() const { return !stats.empty(); }
+
+    /** Dump the recorded stats, preparing them first */
+    void dumpRecorded();
+
+  public: // Output interface
+    void begin() override;
+    void end() override;
+    bool valid() const override;
+
+    void beginGroup(const char *name) override;
+    void endGroup() override;
+
+    void visit(const ScalarInfo &info) override;
+    void visit(const VectorInfo &info) override;
+    void visit(const DistInfo &info) override;
+    void visit(const VectorDistInfo &info) override;
+    void visit(const Vector2dInfo &info) override;
+    void visit(const FormulaInfo &info) override;
+    void visit(const SparseHistInfo &info) override;
+
+  protected:
+    /**
+     * Add a stat to the schema, if this is the first dump.
+     *
+     * @return Whether the stat is to be dumped.
+     */
+    bool addStat(const Info &info, const char *kind,
+                 std::vector<std::string> &&labels);
+
+    /** The labels of a vector's columns, its subnames or indices */
+    static std::vector<std::string> vectorLabels(
+        const std::vector<std::string> &subnames, size_type size);
+
+    /** The labels of the columns of a distribution, after prefix */
+    static void distLabels(const std::string &prefix, const DistData &data,
+                           std::vector<std::string> &labels);
+
+    /** Append the counters and buckets of a distribution to the row */
+    void appendDist(const DistData &data);
+
+    void writeString(const std::string &str);
+    void writeSchema();
+
+  protected:
+    OutputStream *file;
+    const bool enableDescriptions;
+
+    std::stack<std::string> path;
+
+    struct Schema
+    {
+        std::string name;
+        const char *kind;
+        std::string unit;
+        std::string desc;
+        std::vector<std::string> labels;
+    };
+    std::vector<Schema> schema;
+
+    /** The stats recorded for later dumps, in the order of the schema */
+    std::vector<Info *> stats;
+
+    /** The values of the current dump */
+    std::vector<double> row;
+    std::size_t columns;
+
+    unsigned dumpCount;
+};
+
+std::unique_ptr<Output> initColumnar(const std::string &filename,
+                                     bool desc = true);
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_COLUMNAR_HH__
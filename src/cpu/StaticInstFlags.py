@@ -59,6 +59,8 @@ class StaticInstFlags(Enum):
         'IsStoreConditional',   # Store conditional instruction.
         'IsInstPrefetch',   # Instruction-cache prefetch.
         'IsDataPrefetch',   # Data-cache prefetch.
+        'IsBaseUpdate',     # Memory reference that also writes the updated
+                            # address back to its base register.
 
         'IsControl',        # Control transfer instruction.
         'IsDirectControl',  # PC relative control transfer.
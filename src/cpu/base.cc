@@ -349,6 +349,9 @@ BaseCPU::regProbePoints()
     ppRetiredStores = pmuProbePoint("RetiredStores");
     ppRetiredBranches = pmuProbePoint("RetiredBranches");
 
+    ppRetiredMemRefs = new ProbePointArg<RetiredMemRef>(getProbeManager(),
+                                                        "RetiredMemRefs");
+
     ppSleeping = new ProbePointArg<bool>(this->getProbeManager(),
                                          "Sleeping");
 }
@@ -469,6 +469,44 @@ class BaseCPU : public ClockedObject
      */
     virtual void probeInstCommit(const StaticInstPtr &inst, Addr pc);
 
+    /** A load, store or atomic retired by the CPU, see ppRetiredMemRefs */
+    struct RetiredMemRef
+    {
+        ThreadContext *tc;
+        StaticInstPtr inst;
+        const PCStateBase *pc;
+        /** Start and size of the access.  size is 0 if the instruction
+         *  didn't access memory, e.g. it had a false predicate */
+        Addr addr;
+        unsigned size;
+    };
+
+    /** An instruction held up waiting for a load's result, for CPU models
+     *  that report their load dependence stalls */
+    struct LoadDependenceStall
+    {
+        ThreadContext *tc;
+        /** PC of the load producing the awaited result */
+        Addr loadPC;
+        /** Cycles from when the load first held up the instruction's
+         *  issue to when it issued */
+        Cycles cycles;
+    };
+
+    /**
+     * Helper method to trigger the retired memory reference probe for a
+     * committed load, store or atomic.  CPU models should call this
+     * after the instruction has written its destinations, so listeners
+     * can read the loaded values from the thread context.
+     */
+    void
+    probeRetiredMemRef(ThreadContext *tc, const StaticInstPtr &inst,
+        const PCStateBase &pc, Addr addr, unsigned size)
+    {
+        if (ppRetiredMemRefs->hasListeners())
+            ppRetiredMemRefs->notify(RetiredMemRef{tc, inst, &pc, addr, size});
+    }
+
    protected:
     /**
      * Helper method to instantiate probe points belonging to this
@@ -498,6 +536,9 @@ class BaseCPU : public ClockedObject
     /** Retired branches (any type) */
     probing::PMUUPtr ppRetiredBranches;
 
+    /** Retired memory references, with their address and size */
+    ProbePointArg<RetiredMemRef> *ppRetiredMemRefs;
+
     /** CPU cycle counter even if any thread Context is suspended*/
     probing::PMUUPtr ppAllCycles;
 
@@ -43,7 +43,11 @@ from m5.SimObject import SimObject
 from m5.objects.BaseCPU import BaseCPU
 from m5.objects.DummyChecker import DummyChecker
 from m5.objects.BranchPredictor import *
+from m5.objects.ValuePredictor import *
+from m5.objects.IndexingPolicies import *
+from m5.objects.ReplacementPolicies import *
 from m5.objects.TimingExpr import TimingExpr
+from m5.objects.Probe import ProbeListenerObject
 
 from m5.objects.FuncUnit import OpClass
 
@@ -184,6 +188,14 @@ class MinorDefaultFUPool(MinorFUPool):
 
 class ThreadPolicy(Enum): vals = ['SingleThreaded', 'RoundRobin', 'Random']
 
+class LVPUPolicy(ScopedEnum): vals = [
+    'none', 'never_predictable', 'constant_only', 'no_constants', 'disabled']
+
+class LVPUHashedSetAssociative(SetAssociative):
+    type = 'LVPUHashedSetAssociative'
+    cxx_class = 'gem5::minor::LVPUHashedSetAssociative'
+    cxx_header = "cpu/minor/lvpu.hh"
+
 class BaseMinorCPU(BaseCPU):
     type = 'BaseMinorCPU'
     cxx_header = "cpu/minor/cpu.hh"
@@ -287,16 +299,70 @@ class BaseMinorCPU(BaseCPU):
     branchPred = Param.BranchPredictor(TournamentBP(
         numThreads = Parent.numThreads), "Branch Predictor")
     
-    num_lvpt_entries = Param.Int(1000, "Number of entries in load value prediction table")
-    
-    num_lct_entries = Param.Int(1000, "Number of entries in load classification table")
-    
-    num_cvt_entries = Param.Int(1000, "Number of entries in constant verification table")
-    
+    num_lvpt_entries = Param.MemorySize("1024",
+        "Number of entries in load value prediction table")
+    lvpt_assoc = Param.Int(4, "Associativity of the load value prediction"
+        " table")
+    lvpt_indexing_policy = Param.BaseIndexingPolicy(
+        LVPUHashedSetAssociative(entry_size = 1,
+        assoc = Parent.lvpt_assoc, size = Parent.num_lvpt_entries),
+        "Indexing policy of the load value prediction table")
+    lvpt_replacement_policy = Param.BaseReplacementPolicy(LRURP(),
+        "Replacement policy of the load value prediction table")
+
+    num_lct_entries = Param.MemorySize("1024",
+        "Number of entries in load classification table")
+    lct_assoc = Param.Int(4, "Associativity of the load classification"
+        " table")
+    lct_indexing_policy = Param.BaseIndexingPolicy(
+        LVPUHashedSetAssociative(entry_size = 1,
+        assoc = Parent.lct_assoc, size = Parent.num_lct_entries),
+        "Indexing policy of the load classification table")
+    lct_replacement_policy = Param.BaseReplacementPolicy(LRURP(),
+        "Replacement policy of the load classification table")
+
+    num_cvt_entries = Param.MemorySize("1024",
+        "Number of entries in constant verification table")
+    cvt_assoc = Param.Int(4, "Associativity of the constant verification"
+        " table")
+    cvt_indexing_policy = Param.BaseIndexingPolicy(
+        LVPUHashedSetAssociative(entry_size = 1,
+        assoc = Parent.cvt_assoc, size = Parent.num_cvt_entries),
+        "Indexing policy of the constant verification table")
+    cvt_replacement_policy = Param.BaseReplacementPolicy(LRURP(),
+        "Replacement policy of the constant verification table")
+    lvpt_max_vec_bytes = Param.Unsigned(16, "Bytes of a vector register"
+        " destination held in the LVPT, the rest of the register is"
+        " predicted to be zero")
+    cvt_block_size = Param.Unsigned(64, "Granularity in bytes of the"
+        " address index used to invalidate CVT entries on stores")
+
     lct_bits_per_entry = Param.Int(1, "Number of bits in load classification saturating counter")
 
-    lvpu_hacks = Param.String("Hacks for Load value prediction unit")
+    valuePred = Param.ValuePredictor(LastValuePredictor(),
+        "Value predictor supplying the values of predictable loads")
+
+    lvpu_policy = Param.LVPUPolicy('none',
+        "Load value prediction unit features to enable: 'none' predicts"
+        " values and bypasses memory for constants, 'never_predictable'"
+        " only trains the tables, 'constant_only' only bypasses memory for"
+        " constants, 'no_constants' only predicts values and 'disabled'"
+        " turns the unit off")
+    lvpu_selective_replay = Param.Bool(False,
+        "On a load value misprediction, re-execute only the in-flight"
+        " instructions that consumed the mispredicted value rather than"
+        " flushing the pipeline")
 
     def addCheckerCpu(self):
         print("Checker not yet supported by MinorCPU")
         exit(1)
+
+class LVPUWarmer(ProbeListenerObject):
+    """Trains the LVPU of a switched out Minor CPU with the loads and
+    stores retired by a simple CPU (manager), e.g. during an atomic fast
+    forward"""
+    type = 'LVPUWarmer'
+    cxx_header = "cpu/minor/lvpu_warmer.hh"
+    cxx_class = 'gem5::minor::LVPUWarmer'
+
+    cpu = Param.BaseMinorCPU("Minor CPU whose LVPU is warmed")
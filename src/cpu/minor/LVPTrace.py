@@ -0,0 +1,74 @@
+from m5.params import *
+from m5.proxy import *
+from m5.SimObject import SimObject
+from m5.objects.BaseMinorCPU import LVPUHashedSetAssociative
+from m5.objects.Probe import ProbeListenerObject
+from m5.objects.ReplacementPolicies import *
+from m5.objects.ValuePredictor import *
+
+class LVPTraceRecorder(ProbeListenerObject):
+    """Records the loads and stores the LVPU of a Minor CPU (manager) sees,
+    with the values loaded, for LVPTraceReplayer"""
+    type = 'LVPTraceRecorder'
+    cxx_header = "cpu/minor/lvp_trace.hh"
+    cxx_class = 'gem5::minor::LVPTraceRecorder'
+
+    trace_file = Param.String("lvp_trace.pb.gz", "Protobuf trace file,"
+        " created in the output directory.  Compressed if it ends in .gz")
+
+class LVPTraceReplayer(SimObject):
+    """Trains an LVPU with a trace recorded by an LVPTraceRecorder and
+    exits the simulation loop.  The LVPU parameters are those of
+    BaseMinorCPU"""
+    type = 'LVPTraceReplayer'
+    cxx_header = "cpu/minor/lvp_trace.hh"
+    cxx_class = 'gem5::minor::LVPTraceReplayer'
+
+    trace_file = Param.String("Protobuf trace file to replay")
+    max_records = Param.UInt64(0, "Number of loads and stores to replay,"
+        " 0 to replay the whole trace")
+
+    num_lvpt_entries = Param.MemorySize("1024",
+        "Number of entries in load value prediction table")
+    lvpt_assoc = Param.Int(4, "Associativity of the load value prediction"
+        " table")
+    lvpt_indexing_policy = Param.BaseIndexingPolicy(
+        LVPUHashedSetAssociative(entry_size = 1,
+        assoc = Parent.lvpt_assoc, size = Parent.num_lvpt_entries),
+        "Indexing policy of the load value prediction table")
+    lvpt_replacement_policy = Param.BaseReplacementPolicy(LRURP(),
+        "Replacement policy of the load value prediction table")
+
+    num_lct_entries = Param.MemorySize("1024",
+        "Number of entries in load classification table")
+    lct_assoc = Param.Int(4, "Associativity of the load classification"
+        " table")
+    lct_indexing_policy = Param.BaseIndexingPolicy(
+        LVPUHashedSetAssociative(entry_size = 1,
+        assoc = Parent.lct_assoc, size = Parent.num_lct_entries),
+        "Indexing policy of the load classification table")
+    lct_replacement_policy = Param.BaseReplacementPolicy(LRURP(),
+        "Replacement policy of the load classification table")
+
+    num_cvt_entries = Param.MemorySize("1024",
+        "Number of entries in constant verification table")
+    cvt_assoc = Param.Int(4, "Associativity of the constant verification"
+        " table")
+    cvt_indexing_policy = Param.BaseIndexingPolicy(
+        LVPUHashedSetAssociative(entry_size = 1,
+        assoc = Parent.cvt_assoc, size = Parent.num_cvt_entries),
+        "Indexing policy of the constant verification table")
+    cvt_replacement_policy = Param.BaseReplacementPolicy(LRURP(),
+        "Replacement policy of the constant verification table")
+    lvpt_max_vec_bytes = Param.Unsigned(16, "Bytes of a vector register"
+        " destination held in the LVPT.  Must match the recording CPU")
+    cvt_block_size = Param.Unsigned(64, "Granularity in bytes of the"
+        " address index used to invalidate CVT entries on stores")
+
+    lct_bits_per_entry = Param.Int(1, "Number of bits in load classification saturating counter")
+
+    valuePred = Param.ValuePredictor(LastValuePredictor(),
+        "Value predictor supplying the values of predictable loads")
+
+    lvpu_policy = Param.LVPUPolicy('none',
+        "Load value prediction unit features to enable, see BaseMinorCPU")
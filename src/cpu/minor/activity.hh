@@ -45,6 +45,10 @@
 #ifndef __CPU_MINOR_ACTIVITY_HH__
 #define __CPU_MINOR_ACTIVITY_HH__
 
+#include <cstdint>
+#include <limits>
+
+#include "base/types.hh"
 #include "cpu/activity.hh"
 
 namespace gem5
@@ -54,6 +58,10 @@ GEM5_DEPRECATED_NAMESPACE(Minor, minor);
 namespace minor
 {
 
+/** nextWakeCycle of a pipeline stage with nothing to do until it is woken
+ *  by an event, e.g. a memory response or input from another stage */
+constexpr Cycles NoWakeCycle(std::numeric_limits<uint64_t>::max());
+
 /** ActivityRecorder with a Ticked interface */
 class MinorActivityRecorder : public ActivityRecorder
 {
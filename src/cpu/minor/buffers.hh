@@ -502,6 +502,10 @@ class Queue : public Named, public Reservable
 
     const ElemType &front() const { return queue.front(); }
 
+    /** Element index places behind the head, for walking the queue in
+     *  order without popping */
+    ElemType &operator[](unsigned int index) { return queue[index]; }
+
     /** Pop the head item.  Like std::queue::pop */
     void pop() { queue.pop_front(); }
 
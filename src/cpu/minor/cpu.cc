@@ -50,7 +50,9 @@ namespace gem5
 MinorCPU::MinorCPU(const BaseMinorCPUParams &params) :
     BaseCPU(params),
     threadPolicy(params.threadPolicy),
-    stats(this)
+    stats(this),
+    dynInstPool(this, "dynInstPool"),
+    lsqRequestPool(this, "lsqRequestPool")
 {
     /* This is only written for one thread at the moment */
     minor::MinorThread *thread;
@@ -113,6 +115,13 @@ MinorCPU::regStats()
     pipeline->regStats();
 }
 
+void
+MinorCPU::regProbePoints()
+{
+    BaseCPU::regProbePoints();
+    pipeline->regProbePoints();
+}
+
 void
 MinorCPU::serializeThread(CheckpointOut &cp, ThreadID thread_id) const
 {
@@ -129,6 +138,7 @@ void
 MinorCPU::serialize(CheckpointOut &cp) const
 {
     pipeline->serialize(cp);
+    pipeline->lvpu.serializeSection(cp, "lvpu");
     BaseCPU::serialize(cp);
 }
 
@@ -136,6 +146,7 @@ void
 MinorCPU::unserialize(CheckpointIn &cp)
 {
     pipeline->unserialize(cp);
+    pipeline->lvpu.unserializeSection(cp, "lvpu");
     BaseCPU::unserialize(cp);
 }
 
@@ -246,6 +257,22 @@ MinorCPU::takeOverFrom(BaseCPU *old_cpu)
     DPRINTF(MinorCPU, "MinorCPU takeOverFrom\n");
 
     BaseCPU::takeOverFrom(old_cpu);
+
+    /* Carry the LVPU tables over from another Minor CPU.  Other CPUs only
+     *  report their stores to the LVPU through an LVPUWarmer, without one
+     *  any constants it held from before it was switched out may now be
+     *  stale */
+    MinorCPU *old_minor_cpu = dynamic_cast<MinorCPU *>(old_cpu);
+    if (old_minor_cpu)
+        pipeline->lvpu.takeOverFrom(old_minor_cpu->pipeline->lvpu);
+    else if (!pipeline->lvpu.warmed_by(old_cpu))
+        pipeline->lvpu.invalidate_constants();
+}
+
+minor::LVPU &
+MinorCPU::getLVPU()
+{
+    return pipeline->lvpu;
 }
 
 void
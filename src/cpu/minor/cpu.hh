@@ -48,6 +48,7 @@
 #include "base/random.hh"
 #include "cpu/base.hh"
 #include "cpu/minor/activity.hh"
+#include "cpu/minor/pool.hh"
 #include "cpu/minor/stats.hh"
 #include "cpu/simple_thread.hh"
 #include "enums/ThreadPolicy.hh"
@@ -63,6 +64,7 @@ namespace minor
 /** Forward declared to break the cyclic inclusion dependencies between
  *  pipeline and cpu */
 class Pipeline;
+class LVPU;
 
 /** Minor will use the SimpleThread state for now */
 typedef SimpleThread MinorThread;
@@ -139,8 +141,14 @@ class MinorCPU : public BaseCPU
     /** Processor-specific statistics */
     minor::MinorStats stats;
 
+    /** Free lists for the MinorDynInsts made by Fetch2/Decode and the
+     *  requests made by the LSQ.  They must outlive the pipeline */
+    minor::BlockPool dynInstPool;
+    minor::BlockPool lsqRequestPool;
+
     /** Stats interface from SimObject (by way of BaseCPU) */
     void regStats() override;
+    void regProbePoints() override;
 
     /** Simple inst count interface from BaseCPU */
     Counter totalInsts() const override;
@@ -165,6 +173,10 @@ class MinorCPU : public BaseCPU
     void switchOut() override;
     void takeOverFrom(BaseCPU *old_cpu) override;
 
+    /** The load value prediction unit, for warming it while another CPU
+     *  runs */
+    minor::LVPU &getLVPU();
+
     /** Thread activation interface from BaseCPU. */
     void activateContext(ThreadID thread_id) override;
     void suspendContext(ThreadID thread_id) override;
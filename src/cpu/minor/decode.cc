@@ -187,7 +187,8 @@ Decode::evaluate()
                                 decode_info.microopPC->microPC());
 
                     output_inst =
-                        new MinorDynInst(static_micro_inst, inst->id);
+                        new (cpu.dynInstPool) MinorDynInst(
+                            static_micro_inst, inst->id);
                     set(output_inst->pc, decode_info.microopPC);
                     output_inst->fault = NoFault;
 
@@ -286,10 +287,12 @@ Decode::evaluate()
 
     /* If we still have input to process and somewhere to put it,
      *  mark stage as active */
+    nextWake = NoWakeCycle;
     for (ThreadID i = 0; i < cpu.numThreads; i++)
     {
         if (getInput(i) && nextStageReserve[i].canReserve()) {
             cpu.activityRecorder->activateStage(Pipeline::DecodeStageId);
+            nextWake = cpu.curCycle() + Cycles(1);
             break;
         }
     }
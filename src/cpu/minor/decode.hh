@@ -138,6 +138,10 @@ class Decode : public Named
     /** Use the current threading policy to determine the next thread to
      *  decode from. */
     ThreadID getScheduledThread();
+    /** Cycle this stage next needs to be evaluated in, see
+     *  nextWakeCycle.  Set by evaluate */
+    Cycles nextWake = NoWakeCycle;
+
   public:
     Decode(const std::string &name,
         MinorCPU &cpu_,
@@ -150,6 +154,10 @@ class Decode : public Named
     /** Pass on input/buffer data to the output if you can */
     void evaluate();
 
+    /** The next cycle in which this stage has work of its own to do, or
+     *  NoWakeCycle if it is waiting to be woken by an event */
+    Cycles nextWakeCycle() const { return nextWake; }
+
     void minorTrace() const;
 
     /** Is this stage drained?  For Decoed, draining is initiated by
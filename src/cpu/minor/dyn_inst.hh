@@ -46,7 +46,9 @@
 #ifndef __CPU_MINOR_DYN_INST_HH__
 #define __CPU_MINOR_DYN_INST_HH__
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 #include "arch/generic/isa.hh"
 #include "base/named.hh"
@@ -54,6 +56,8 @@
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
 #include "cpu/minor/buffers.hh"
+#include "cpu/minor/pool.hh"
+#include "cpu/pred/value_pred.hh"
 #include "cpu/static_inst.hh"
 #include "cpu/timing_expr.hh"
 #include "sim/faults.hh"
@@ -160,7 +164,7 @@ std::ostream &operator <<(std::ostream &os, const MinorDynInst &inst);
  *  MinorDynInst implements the BubbleIF interface
  *  Has two separate notions of sequence number for pre/post-micro-op
  *  decomposition: fetchSeqNum and execSeqNum */
-class MinorDynInst : public RefCounted
+class MinorDynInst : public RefCounted, public PoolAllocated
 {
   private:
     /** A prototypical bubble instruction.  You must call MinorDynInst::init
@@ -203,6 +207,29 @@ class MinorDynInst : public RefCounted
     /** This instruction was classified as a constant, so memory access was not initiated */
     bool constant_mem_bypass = false;
 
+    /** The LVPU wrote predicted_values to this load's destination
+     *  registers and released them in the scoreboard when the load issued.
+     *  There is one value per value slot, see LVPU::value_slots */
+    bool value_predicted = false;
+    std::vector<RegVal> predicted_values;
+
+    /** The value predictor's lookups for this load when it issued, which
+     *  it is trained with when the load's values return, whether or not
+     *  they were predictable enough to be written */
+    std::vector<value_prediction::ValuePredictor::Prediction>
+        value_predictions;
+
+    /** execSeqNums of the unverified value predicted loads from which
+     *  this inst's sources were computed.  Only tracked for LVPU
+     *  selective replay */
+    std::vector<InstSeqNum> predictedLoadDependences;
+
+    /** PC of the in-flight load whose result first held up this inst's
+     *  issue, MaxAddr if none has, and the cycle it started doing so.
+     *  Reported through Execute's LoadDependenceStalls probe point */
+    Addr stallingLoadPC = MaxAddr;
+    Cycles stallingLoadCycle = Cycles(0);
+
     /** Translation fault in case of a mem ref */
     Fault translationFault;
 
@@ -262,6 +289,15 @@ class MinorDynInst : public RefCounted
     /** Is this a real mem ref instruction */
     bool isMemRef() const { return isInst() && staticInst->isMemRef(); }
 
+    /** Were this inst's sources computed from the given predicted load */
+    bool
+    dependsOnPredictedLoad(InstSeqNum load_seq_num) const
+    {
+        return std::find(predictedLoadDependences.begin(),
+            predictedLoadDependences.end(), load_seq_num) !=
+            predictedLoadDependences.end();
+    }
+
     /** Is this an instruction that can be executed `for free' and
      *  needn't spend time in an FU */
     bool isNoCostInst() const;
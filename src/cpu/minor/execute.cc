@@ -37,6 +37,7 @@
 
 #include "cpu/minor/execute.hh"
 
+#include <algorithm>
 #include <functional>
 
 #include "cpu/minor/cpu.hh"
@@ -84,6 +85,7 @@ Execute::Execute(const std::string &name_,
     setTraceTimeOnCommit(params.executeSetTraceTimeOnCommit),
     setTraceTimeOnIssue(params.executeSetTraceTimeOnIssue),
     allowEarlyMemIssue(params.executeAllowEarlyMemoryIssue),
+    lvpuSelectiveReplay(params.lvpu_selective_replay),
     noCostFUIndex(fuDescriptions.funcUnits.size() + 1),
     lvpu(lvpu_),
     lsq(name_ + ".lsq", name_ + ".dcache_port",
@@ -188,7 +190,8 @@ Execute::Execute(const std::string &name_,
         const auto &regClasses = cpu.threads[tid]->getIsaPtr()->regClasses();
 
         /* Scoreboards */
-        scoreboard.emplace_back(name_ + ".scoreboard" + tid_str, regClasses);
+        scoreboard.emplace_back(name_ + ".scoreboard" + tid_str, regClasses,
+            lvpuSelectiveReplay);
 
         /* In-flight instruction records */
         executeInfo[tid].inFlightInsts =  new Queue<QueuedInst,
@@ -389,31 +392,77 @@ Execute::handleMemResponse(MinorDynInstPtr inst,
         fault = inst->staticInst->completeAcc(packet, &context,
             inst->traceData);
 
+        if (fault == NoFault && (is_load || is_store || is_atomic)) {
+            cpu.probeRetiredMemRef(thread, inst->staticInst, *inst->pc,
+                packet->req->getVaddr(), packet->getSize());
+        }
+
+        // Stores, and the loads the LVPU trains on, are reported in
+        // commit order for LVP traces
+        bool record_mem_ref = fault == NoFault &&
+            ppLVPUMemRefs->hasListeners();
+        if (record_mem_ref && (is_store || is_atomic)) {
+            notifyLVPUMemRef(false, 0, packet->req->getVaddr(),
+                packet->getSize(), nullptr, true, false);
+        }
+
+        Addr pc = LVPU::load_key(*inst->pc);
+        bool lvpu_load = is_load and fault == NoFault and
+            (lvpu->enabled() or record_mem_ref) and
+            !inst->constant_mem_bypass and
+            lvpu->value_slots(inst->staticInst) != 0;
+
+        std::vector<RegVal> returned_values;
+        bool representable = true;
+        if (lvpu_load) {
+            representable = lvpu->read_dests(inst->staticInst,
+                context.thread, returned_values);
+        }
+        if (lvpu_load && record_mem_ref && !is_atomic) {
+            notifyLVPUMemRef(true, pc, packet->req->getVaddr(),
+                packet->getSize(), &returned_values, representable,
+                LVPU::has_base_update_dests(inst->staticInst));
+        }
+
+        // Compare prediction with values returned from memory.  Reissue if mispredicted
+        if (lvpu_load and lvpu->enabled()) {
+            // Micro-op loads aren't seen by Fetch2, allocate them here
+            if (inst->staticInst->isMicroop() &&
+                lvpu->find_entry(pc) == nullptr) {
+                lvpu->add_entry(pc);
+            }
 
-        // Compare prediction with value returned from memory.  Reissue if mispredicted
-        const RegId &reg = inst->staticInst->destRegIdx(0);
-        Addr pc = inst->pc->instAddr();
-        if (is_load and !reg.is(VecRegClass) and !inst->constant_mem_bypass) {
-            RegVal returned_value = context.thread.getReg(reg);
-            bool prediction_made = lvpu->is_predictable(pc); // Get value now because is_predictable might change during prediction_results
-            LVPU::PredictionResults results = lvpu->prediction_results(pc, returned_value);
+            LVPU::PredictionResults results = lvpu->prediction_results(pc,
+                inst->value_predictions, returned_values, representable);
             if (results.entry_upgraded) {
                 //Add entry to CVT if is upgraded to constant
                 DPRINTF(LVPU, "Entry upgraded to constant: pc: %s\n", pc);
                 Addr mem_addr = packet->req->getVaddr();
-                lvpu->add_cvt_entry(pc, mem_addr);
+                lvpu->add_cvt_entry(pc, mem_addr, packet->getSize());
             }
-            if (prediction_made) {
+            if (inst->value_predicted) {
                 lvpu->stats.num_predictions++;
-                if (results.misprediction) {
-                    DPRINTF(LVPU, "Load value misprediction, updating PC. inst: %s\n", *inst);
+                if (!representable ||
+                    inst->predicted_values != returned_values) {
                     lvpu->stats.incorrect_predictions++;
-                    // Set PC to one after mispredicted load to reissue all in-flight instructions
-                    std::unique_ptr<PCStateBase> next_pc(inst->pc->clone());
-                    inst->staticInst->advancePC(*next_pc);
-                    updateBranchData(thread_id, BranchData::Interrupt, inst,
-                        *next_pc, branch);
-                    // Any loads in the pipeline need to have scoreboard cleared 
+                    lvpu->stats.squashable_insts +=
+                        executeInfo[thread_id].inFlightInsts->
+                            occupiedSpace() - 1;
+
+                    if (lvpuSelectiveReplay && replayValueConsumers(inst)) {
+                        DPRINTF(LVPU, "Load value misprediction, replaying"
+                            " consumers. inst: %s\n", *inst);
+                        lvpu->stats.selective_replays++;
+                    } else {
+                        DPRINTF(LVPU, "Load value misprediction, updating PC. inst: %s\n", *inst);
+                        if (lvpuSelectiveReplay)
+                            lvpu->stats.replay_flush_fallbacks++;
+                        // Set PC to one after mispredicted load to reissue all in-flight instructions
+                        std::unique_ptr<PCStateBase> next_pc(inst->pc->clone());
+                        inst->staticInst->advancePC(*next_pc);
+                        updateBranchData(thread_id, BranchData::Interrupt, inst,
+                            *next_pc, branch);
+                    }
                 } else {
                     DPRINTF(LVPU, "Load value prediction correct. inst: %s\n", *inst);
                     lvpu->stats.correct_predictions++;
@@ -450,6 +499,56 @@ Execute::handleMemResponse(MinorDynInstPtr inst,
     tryToBranch(inst, fault, branch);
 }
 
+bool
+Execute::replayValueConsumers(MinorDynInstPtr inst)
+{
+    ExecuteThreadInfo &ex_info = executeInfo[inst->id.threadId];
+    InstSeqNum load_seq_num = inst->id.execSeqNum;
+    unsigned int num_in_flight = ex_info.inFlightInsts->occupiedSpace();
+
+    assert(ex_info.inFlightInsts->front().inst == inst);
+
+    /* A consumer that is already in the LSQ formed its address from the
+     *  predicted value */
+    for (unsigned int i = 1; i < num_in_flight; i++) {
+        const MinorDynInstPtr &consumer = (*ex_info.inFlightInsts)[i].inst;
+
+        if (consumer->inLSQ &&
+            consumer->dependsOnPredictedLoad(load_seq_num))
+        {
+            DPRINTF(LVPU, "Consumer: %s already issued to memory, can't"
+                " replay\n", *consumer);
+            return false;
+        }
+    }
+
+    /* Consumers are only executed when they commit, which is after this
+     *  load has written its real value, so replaying them is just a matter
+     *  of charging the time of another pass through their FUs */
+    Cycles now = cpu.curCycle();
+    for (unsigned int i = 1; i < num_in_flight; i++) {
+        const MinorDynInstPtr &consumer = (*ex_info.inFlightInsts)[i].inst;
+
+        if (!consumer->dependsOnPredictedLoad(load_seq_num) ||
+            consumer->id.streamSeqNum != ex_info.streamSeqNum)
+        {
+            continue;
+        }
+
+        Cycles replay_latency = (consumer->fuIndex < numFuncUnits ?
+            funcUnits[consumer->fuIndex]->description.opLat : Cycles(0));
+
+        consumer->minimumCommitCycle = std::max(consumer->minimumCommitCycle,
+            now + replay_latency);
+        lvpu->stats.replayed_insts++;
+
+        DPRINTF(LVPU, "Replaying inst: %s, can commit at cycle: %d\n",
+            *consumer, consumer->minimumCommitCycle);
+    }
+
+    return true;
+}
+
 bool
 Execute::isInterrupted(ThreadID thread_id) const
 {
@@ -713,16 +812,28 @@ Execute::issue(ThreadID thread_id)
                     const std::vector<bool> *cant_forward_from_fu_indices =
                         &(fu->cantForwardFromFUIndices);
 
+                    Addr blocking_load_pc = MaxAddr;
+
                     if (timing && timing->suppress) {
                         DPRINTF(MinorExecute, "Can't issue inst: %s as extra"
                             " decoding is suppressing it\n",
                             *inst);
                     } else if (!scoreboard[thread_id].canInstIssue(inst,
                         src_latencies, cant_forward_from_fu_indices,
-                        cpu.curCycle(), cpu.getContext(thread_id)))
+                        cpu.curCycle(), cpu.getContext(thread_id),
+                        &blocking_load_pc))
                     {
                         DPRINTF(MinorExecute, "Can't issue inst: %s yet\n",
                             *inst);
+
+                        /* Time the stall from the first cycle a load
+                         *  holds the inst up */
+                        if (blocking_load_pc != MaxAddr &&
+                            inst->stallingLoadPC == MaxAddr)
+                        {
+                            inst->stallingLoadPC = blocking_load_pc;
+                            inst->stallingLoadCycle = cpu.curCycle();
+                        }
                     } else {
                         /* Can insert the instruction into this FU */
                         DPRINTF(MinorExecute, "Issuing inst: %s"
@@ -816,8 +927,15 @@ Execute::issue(ThreadID thread_id)
                 fu_index++;
             } while (fu_index != numFuncUnits && !issued);
 
-            if (!issued)
+            if (!issued) {
                 DPRINTF(MinorExecute, "Didn't issue inst: %s\n", *inst);
+            } else if (inst->stallingLoadPC != MaxAddr &&
+                ppLoadDependenceStalls->hasListeners())
+            {
+                ppLoadDependenceStalls->notify(BaseCPU::LoadDependenceStall{
+                    cpu.getContext(thread_id), inst->stallingLoadPC,
+                    Cycles(cpu.curCycle() - inst->stallingLoadCycle)});
+            }
         }
 
         if (issued) {
@@ -978,18 +1096,66 @@ Execute::commitInst(MinorDynInstPtr inst, bool early_memory_issue,
         bool completed_mem_inst = executeMemRefInst(inst, branch, predicate_passed, fault);
 
 
-        if (inst->staticInst->isLoad() and (lvpu->is_predictable(inst->pc->instAddr()) || inst->constant_mem_bypass)) {
-            // Write to register and free in scoreboard
-            ExecContext context(cpu, *cpu.threads[thread_id], *this, inst);
-            DPRINTF(LVPU,"numDestRegs: %i\n", inst->staticInst->numDestRegs());
-            const RegId &reg = inst->staticInst->destRegIdx(0);
-            
-            scoreboard[thread_id].clearInstDests(inst, inst->isMemRef());
-            RegVal val = lvpu->read_entry(inst->pc->instAddr());
-            context.thread.setReg(reg, val);
-            DPRINTF(LVPU, "Setting reg with LVPT entry.  reg: %s, val: %s\n",
-                reg,
-                val);
+        if (completed_mem_inst && fault == NoFault &&
+            inst->staticInst->isLoad() && lvpu->enabled()) {
+            // Write the predicted or constant values to the registers and
+            // free them in the scoreboard
+            Addr pc = LVPU::load_key(*inst->pc);
+            bool write_reg = false;
+            if (inst->constant_mem_bypass) {
+                // The LSQ only bypasses loads with valid LVPT entries
+                write_reg = lvpu->read_entry(pc, inst->predicted_values);
+                panic_if(!write_reg, "Constant load %s has no LVPT values\n",
+                    *inst);
+            } else {
+                // Every load is looked up, to train the LCT with the
+                // prediction it issued with, but only the predictable ones
+                // have their values written
+                unsigned num_slots = lvpu->value_slots(inst->staticInst);
+                if (num_slots != 0 &&
+                    lvpu->predict_values(pc, num_slots,
+                        inst->value_predictions, inst->predicted_values) &&
+                    lvpu->is_predictable(pc)) {
+                    inst->value_predicted = true;
+                    write_reg = true;
+                }
+            }
+
+            if (write_reg) {
+                ExecContext context(cpu, *cpu.threads[thread_id], *this, inst);
+                DPRINTF(LVPU,"numDestRegs: %i\n", inst->staticInst->numDestRegs());
+
+                // Base register write backs are left for the load itself
+                // to produce
+                for (unsigned int dest_index = 0;
+                    dest_index < inst->staticInst->numDestRegs();
+                    dest_index++) {
+                    if (!LVPU::is_base_update_dest(inst->staticInst, dest_index)) {
+                        scoreboard[thread_id].clearInstDest(inst, dest_index,
+                            inst->isMemRef());
+                    }
+                }
+                if (inst->value_predicted)
+                    scoreboard[thread_id].markupPredictedDests(inst);
+                lvpu->write_dests(inst->staticInst, context.thread,
+                    inst->predicted_values);
+            }
+
+            // Bypassed loads never reach handleMemResponse, so are
+            // reported here, once their values are written, with the bytes
+            // the CVT verified
+            Addr mem_addr;
+            unsigned size;
+            if (inst->constant_mem_bypass &&
+                lvpu->constant_location(pc, mem_addr, size)) {
+                cpu.probeRetiredMemRef(cpu.getContext(thread_id),
+                    inst->staticInst, *inst->pc, mem_addr, size);
+                if (ppLVPUMemRefs->hasListeners()) {
+                    notifyLVPUMemRef(true, pc, mem_addr, size,
+                        &inst->predicted_values, true,
+                        LVPU::has_base_update_dests(inst->staticInst));
+                }
+            }
         }
 
         if (completed_mem_inst && fault != NoFault) {
@@ -1199,6 +1365,11 @@ Execute::commit(ThreadID thread_id, bool only_commit_microops, bool discard,
             discard_inst = inst->id.streamSeqNum !=
                            ex_info.streamSeqNum || discard;
 
+            /* Predicted and constant loads already freed their
+             *  destinations in the scoreboard when they issued */
+            load_prediction_made = inst->value_predicted ||
+                inst->constant_mem_bypass;
+
             DPRINTF(MinorExecute, "Trying to commit mem response: %s\n",
                 *inst);
 
@@ -1210,9 +1381,6 @@ Execute::commit(ThreadID thread_id, bool only_commit_microops, bool discard,
 
                 lsq.popResponse(mem_response);
             } else {
-                //TODO: If load is a constant, don't run handleMemResponse.
-                Addr pc = inst->pc->instAddr();
-                load_prediction_made = lvpu->is_predictable(pc) and !inst->constant_mem_bypass; // Assume if is_predictable == True, than a prediction was made.  Need to track here because the value can change within handleMemResponse
                 if (!inst->constant_mem_bypass) {
                     handleMemResponse(inst, mem_response, branch, fault);
                 } else {
@@ -1348,10 +1516,12 @@ Execute::commit(ThreadID thread_id, bool only_commit_microops, bool discard,
                     }
 
                     /* Move the extraCommitDelay from the instruction
-                     *  into the minimumCommitCycle */
+                     *  into the minimumCommitCycle, which may already
+                     *  hold a value misprediction replay delay */
                     if (inst->extraCommitDelay != Cycles(0)) {
-                        inst->minimumCommitCycle = cpu.curCycle() +
-                            inst->extraCommitDelay;
+                        inst->minimumCommitCycle = std::max(
+                            inst->minimumCommitCycle,
+                            cpu.curCycle() + inst->extraCommitDelay);
                         inst->extraCommitDelay = Cycles(0);
                     }
 
@@ -1451,8 +1621,21 @@ Execute::commit(ThreadID thread_id, bool only_commit_microops, bool discard,
                     " inst: %s committed: %d\n", *inst, committed_inst);
                 lsq.completeMemBarrierInst(inst, committed_inst);
             }
-            if (!load_prediction_made or discard_inst) {
+            if (!load_prediction_made) {
                 scoreboard[thread_id].clearInstDests(inst, inst->isMemRef());
+            } else {
+                /* Only the base register write backs of predicted loads
+                 *  are still in the scoreboard */
+                for (unsigned int dest_index = 0;
+                    dest_index < inst->staticInst->numDestRegs();
+                    dest_index++) {
+                    if (LVPU::is_base_update_dest(inst->staticInst, dest_index)) {
+                        scoreboard[thread_id].clearInstDest(inst, dest_index,
+                            inst->isMemRef());
+                    }
+                }
+                if (inst->value_predicted)
+                    scoreboard[thread_id].clearPredictedDests(inst);
             }
         }
 
@@ -1627,6 +1810,11 @@ Execute::evaluate()
     }
 
     bool head_inst_might_commit = false;
+    Cycles next_cycle = cpu.curCycle() + Cycles(1);
+    /* Earliest cycle a head inst that can't commit next cycle, as it's
+     *  stalled for an extra commit delay or a value misprediction replay,
+     *  can commit in */
+    Cycles head_commit_cycle = NoWakeCycle;
 
     /* Could the head in flight insts be committed */
     for (auto const &info : executeInfo) {
@@ -1637,8 +1825,15 @@ Execute::evaluate()
                 head_inst_might_commit = true;
             } else {
                 FUPipeline *fu = funcUnits[head_inst.inst->fuIndex];
-                if ((fu->stalled &&
-                     fu->front().inst->id == head_inst.inst->id) ||
+                bool at_fu_head = fu->stalled &&
+                    fu->front().inst->id == head_inst.inst->id;
+                if (at_fu_head &&
+                    head_inst.inst->minimumCommitCycle > next_cycle) {
+                    head_commit_cycle = std::min(head_commit_cycle,
+                        head_inst.inst->minimumCommitCycle);
+                } else if (at_fu_head ||
+                     /* Constant loads bypass memory so there is no
+                      *  response to wait for */
                      head_inst.inst->constant_mem_bypass ||
                      lsq.findResponse(head_inst.inst))
                 {
@@ -1670,9 +1865,15 @@ Execute::evaluate()
             " advanceable FUs\n");
     }
 
-    /* Wake up if we need to tick again */
-    if (need_to_tick)
+    /* Wake up if we need to tick again.  Otherwise the pipeline can
+     *  sleep until a stalled head inst can commit, unless an event
+     *  (e.g. a memory response) wakes it first */
+    if (need_to_tick) {
         cpu.wakeupOnEvent(Pipeline::ExecuteStageId);
+        nextWake = next_cycle;
+    } else {
+        nextWake = head_commit_cycle;
+    }
 
     /* Note activity of following buffer */
     if (!branch.isBubble())
@@ -1948,6 +2149,26 @@ Execute::~Execute()
         delete executeInfo[tid].inFlightInsts;
 }
 
+void
+Execute::regProbePoints()
+{
+    ppLVPUMemRefs = new ProbePointArg<LVPU::MemRefRecord>(
+        cpu.getProbeManager(), "LVPUMemRefs");
+    ppLoadDependenceStalls =
+        new ProbePointArg<BaseCPU::LoadDependenceStall>(
+            cpu.getProbeManager(), "LoadDependenceStalls");
+}
+
+void
+Execute::notifyLVPUMemRef(bool is_load, Addr pc, Addr mem_addr,
+    unsigned size, const std::vector<RegVal> *values, bool representable,
+    bool has_base_update_dests)
+{
+    LVPU::MemRefRecord record{is_load, pc, mem_addr, size, values,
+        representable, has_base_update_dests};
+    ppLVPUMemRefs->notify(record);
+}
+
 bool
 Execute::instIsRightStream(MinorDynInstPtr inst)
 {
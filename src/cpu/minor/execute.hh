@@ -56,6 +56,7 @@
 #include "cpu/minor/pipe_data.hh"
 #include "cpu/minor/scoreboard.hh"
 #include "cpu/minor/lvpu.hh"
+#include "sim/probe/probe.hh"
 
 namespace gem5
 {
@@ -116,6 +117,10 @@ class Execute : public Named
      *  of the in flight insts queue if their dependencies are met */
     bool allowEarlyMemIssue;
 
+    /** Recover from load value mispredictions by replaying the in-flight
+     *  consumers of the mispredicted value rather than flushing */
+    bool lvpuSelectiveReplay;
+
     /** The FU index of the non-existent costless FU for instructions
      *  which pass the MinorDynInst::isNoCostInst test */
     unsigned int noCostFUIndex;
@@ -135,6 +140,19 @@ class Execute : public Named
     /** Pointer to load value prediction unit */
     LVPU* lvpu;
 
+  protected:
+    /** Loads and stores seen by the LVPU, in commit order */
+    ProbePointArg<LVPU::MemRefRecord> *ppLVPUMemRefs;
+
+    /** Insts whose issue was held up by an in-flight load's result,
+     *  notified as they issue */
+    ProbePointArg<BaseCPU::LoadDependenceStall> *ppLoadDependenceStalls;
+
+    /** Report a load or store to ppLVPUMemRefs */
+    void notifyLVPUMemRef(bool is_load, Addr pc, Addr mem_addr,
+        unsigned size, const std::vector<RegVal> *values,
+        bool representable, bool has_base_update_dests);
+
   protected:
     /** Stage cycle-by-cycle state */
 
@@ -244,6 +262,13 @@ class Execute : public Named
         LSQ::LSQRequestPtr response, BranchData &branch,
         Fault &fault);
 
+    /** Delay the in-flight consumers of the mispredicted value of the load
+     *  inst, which must be at the head of inFlightInsts, by another pass
+     *  through their FUs.  Returns false, leaving the consumers alone, if
+     *  any of them has already been issued to memory with the wrong
+     *  value and so the pipeline must be flushed */
+    bool replayValueConsumers(MinorDynInstPtr inst);
+
     /** Execute a memory reference instruction.  This calls initiateAcc on
      *  the instruction which will then call writeMem or readMem to issue a
      *  memory access to the LSQ.
@@ -324,6 +349,10 @@ class Execute : public Named
     ThreadID getCommittingThread();
     ThreadID getIssuingThread();
 
+    /** Cycle this stage next needs to be evaluated in, see
+     *  nextWakeCycle.  Set by evaluate */
+    Cycles nextWake = NoWakeCycle;
+
   public:
     Execute(const std::string &name_,
         MinorCPU &cpu_,
@@ -334,6 +363,9 @@ class Execute : public Named
 
     ~Execute();
 
+    /** Register the LVPUMemRefs probe point with the CPU */
+    void regProbePoints();
+
   public:
 
     /** Returns the DcachePort owned by this Execute to pass upwards */
@@ -353,6 +385,10 @@ class Execute : public Named
     /** Pass on input/buffer data to the output if you can */
     void evaluate();
 
+    /** The next cycle in which this stage has work of its own to do, or
+     *  NoWakeCycle if it is waiting to be woken by an event */
+    Cycles nextWakeCycle() const { return nextWake; }
+
     void minorTrace() const;
 
     /** After thread suspension, has Execute been drained of in-flight
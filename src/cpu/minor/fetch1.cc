@@ -700,7 +700,22 @@ Fetch1::evaluate()
     /* Fetch1 has no inputBuffer so the only activity we can have is to
      *  generate a line output (tested just above) or to initiate a memory
      *  fetch which will signal activity when it returns/needs stepping
-     *  between queues */
+     *  between queues.  Stay active while there is another completed
+     *  fetch to process or a thread could start another fetch, rather
+     *  than leaving that to the activity recorder's window */
+    nextWake = NoWakeCycle;
+    bool can_fetch_next = !transfers.empty() &&
+        transfers.front()->isComplete();
+    for (ThreadID tid = 0; tid < cpu.numThreads && !can_fetch_next; tid++) {
+        can_fetch_next = numInFlightFetches() < fetchLimit &&
+            cpu.getContext(tid)->status() == ThreadContext::Active &&
+            fetchInfo[tid].state == FetchRunning &&
+            nextStageReserve[tid].canReserve();
+    }
+    if (can_fetch_next) {
+        cpu.activityRecorder->activateStage(Pipeline::Fetch1StageId);
+        nextWake = cpu.curCycle() + Cycles(1);
+    }
 
 
     /* This looks hackish.  And it is, but there doesn't seem to be a better
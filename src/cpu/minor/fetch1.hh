@@ -183,7 +183,7 @@ class Fetch1 : public Named
             pc(pc_),
             fault(NoFault)
         {
-            request = std::make_shared<Request>();
+            request = Request::make();
         }
 
         ~FetchRequest();
@@ -383,6 +383,10 @@ class Fetch1 : public Named
     virtual bool recvTimingResp(PacketPtr pkt);
     virtual void recvReqRetry();
 
+    /** Cycle this stage next needs to be evaluated in, see
+     *  nextWakeCycle.  Set by evaluate */
+    Cycles nextWake = NoWakeCycle;
+
   public:
     Fetch1(const std::string &name_,
         MinorCPU &cpu_,
@@ -399,6 +403,10 @@ class Fetch1 : public Named
     /** Pass on input/buffer data to the output if you can */
     void evaluate();
 
+    /** The next cycle in which this stage has work of its own to do, or
+     *  NoWakeCycle if it is waiting to be woken by an event */
+    Cycles nextWakeCycle() const { return nextWake; }
+
     /** Initiate fetch1 fetching */
     void wakeupFetch(ThreadID tid);
 
@@ -361,7 +361,8 @@ Fetch2::evaluate()
 
                 /* Make a new instruction and pick up the line, stream,
                  *  prediction, thread ids from the incoming line */
-                dyn_inst = new MinorDynInst(nullStaticInstPtr, line_in->id);
+                dyn_inst = new (cpu.dynInstPool) MinorDynInst(
+                    nullStaticInstPtr, line_in->id);
 
                 /* Fetch and prediction sequence numbers originate here */
                 dyn_inst->id.fetchSeqNum = fetch_info.fetchSeqNum;
@@ -404,7 +405,8 @@ Fetch2::evaluate()
 
                     /* Make a new instruction and pick up the line, stream,
                      *  prediction, thread ids from the incoming line */
-                    dyn_inst = new MinorDynInst(decoded_inst, line_in->id);
+                    dyn_inst = new (cpu.dynInstPool) MinorDynInst(
+                        decoded_inst, line_in->id);
 
                     /* Fetch and prediction sequence numbers originate here */
                     dyn_inst->id.fetchSeqNum = fetch_info.fetchSeqNum;
@@ -438,15 +440,18 @@ Fetch2::evaluate()
                         *fetch_info.pc, *dyn_inst);
 
                     // Search for entry in LVPT
-                    if (decoded_inst->isLoad()) {
-                        int pc = dyn_inst->pc->instAddr();
+                    // Micro-op loads are allocated by Execute as they
+                    // aren't seen until Decode
+                    if (decoded_inst->isLoad() && lvpu->enabled() &&
+                        !decoded_inst->isMacroop()) {
+                        Addr pc = LVPU::load_key(*dyn_inst->pc);
                         DPRINTF(LVPU,
                             "Load detected.  Checking LVPT for %s\n",
                             pc);
-                        if (dyn_inst->staticInst->numDestRegs() != 1) {
+                        if (lvpu->value_slots(dyn_inst->staticInst) == 0) {
                             DPRINTF(LVPU,
-                                "Load does not have 1 destination register. Not adding to LVPT\n");
-                        } else if (lvpu->find_entry(pc) != -1) {
+                                "Load has no destinations the LVPU can predict. Not adding to LVPT\n");
+                        } else if (lvpu->find_entry(pc) != nullptr) {
                             DPRINTF(LVPU,
                                 "PC found in Load Value Prediction Table\n");
                         } else {
@@ -569,10 +574,12 @@ Fetch2::evaluate()
 
     /* If we still have input to process and somewhere to put it,
      *  mark stage as active */
+    nextWake = NoWakeCycle;
     for (ThreadID i = 0; i < cpu.numThreads; i++)
     {
         if (getInput(i) && nextStageReserve[i].canReserve()) {
             cpu.activityRecorder->activateStage(Pipeline::Fetch2StageId);
+            nextWake = cpu.curCycle() + Cycles(1);
             break;
         }
     }
@@ -202,6 +202,10 @@ class Fetch2 : public Named
      *  fetch from. */
     ThreadID getScheduledThread();
 
+    /** Cycle this stage next needs to be evaluated in, see
+     *  nextWakeCycle.  Set by evaluate */
+    Cycles nextWake = NoWakeCycle;
+
   public:
     Fetch2(const std::string &name,
         MinorCPU &cpu_,
@@ -217,6 +221,10 @@ class Fetch2 : public Named
     /** Pass on input/buffer data to the output if you can */
     void evaluate();
 
+    /** The next cycle in which this stage has work of its own to do, or
+     *  NoWakeCycle if it is waiting to be woken by an event */
+    Cycles nextWakeCycle() const { return nextWake; }
+
     void minorTrace() const;
 
 
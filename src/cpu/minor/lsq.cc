@@ -75,7 +75,7 @@ LSQ::LSQRequest::LSQRequest(LSQ &port_, MinorDynInstPtr inst_, bool isLoad_,
     isTranslationDelayed(false),
     state(NotIssued)
 {
-    request = std::make_shared<Request>();
+    request = Request::make();
 }
 
 void
@@ -497,7 +497,7 @@ LSQ::SplitDataRequest::makeFragmentRequests()
             }
         }
 
-        RequestPtr fragment = std::make_shared<Request>();
+        RequestPtr fragment = Request::make();
         bool disabled_fragment = false;
 
         fragment->setContext(request->contextId());
@@ -922,7 +922,8 @@ LSQ::completeMemBarrierInst(MinorDynInstPtr inst,
         if (!inst->inStoreBuffer) {
             /* Insert an entry into the store buffer to tick off barriers
              *  until there are none in flight */
-            storeBuffer.insert(new BarrierDataRequest(*this, inst));
+            storeBuffer.insert(
+                new (cpu.lsqRequestPool) BarrierDataRequest(*this, inst));
         }
     } else {
         /* Clear the barrier anyway if it wasn't actually committed */
@@ -1592,18 +1593,20 @@ LSQ::pushRequest(MinorDynInstPtr inst, bool isLoad, uint8_t *data,
                  uint64_t *res, AtomicOpFunctorPtr amo_op,
                  const std::vector<bool>& byte_enable)
 {
-    bool constant = lvpu->is_constant(inst->pc->instAddr(), addr);
     inst->constant_mem_bypass = false;
-    if (isLoad && constant) {
+    // Loads that write back their base register must still execute
+    if (isLoad && lvpu->bypasses() &&
+        !LVPU::has_base_update_dests(inst->staticInst) &&
+        lvpu->is_constant(LVPU::load_key(*inst->pc), addr)) {
         DPRINTF(LVPU, "pushRequest: Load is constant, skipping memory access\n");
         inst->constant_mem_bypass = true;
         lvpu->stats.memory_bypasses++;
         return NoFault;
     }
 
-    if (!isLoad) {
+    if (!isLoad && lvpu->enabled()) {
         //Update CVT if store address matches any entries
-        std::vector<Addr> removed_entries = lvpu->update_store_addr(addr);
+        std::vector<Addr> removed_entries = lvpu->update_store_addr(addr, size);
     }
 
     assert(inst->translationFault == NoFault || inst->inLSQ);
@@ -1650,10 +1653,10 @@ LSQ::pushRequest(MinorDynInstPtr inst, bool isLoad, uint8_t *data,
     }
 
     if (needs_burst) {
-        request = new SplitDataRequest(
+        request = new (cpu.lsqRequestPool) SplitDataRequest(
             *this, inst, isLoad, request_data, res);
     } else {
-        request = new SingleDataRequest(
+        request = new (cpu.lsqRequestPool) SingleDataRequest(
             *this, inst, isLoad, request_data, res);
     }
 
@@ -1686,7 +1689,8 @@ LSQ::pushRequest(MinorDynInstPtr inst, bool isLoad, uint8_t *data,
 void
 LSQ::pushFailedRequest(MinorDynInstPtr inst)
 {
-    LSQRequestPtr request = new FailedDataRequest(*this, inst);
+    LSQRequestPtr request =
+        new (cpu.lsqRequestPool) FailedDataRequest(*this, inst);
     requests.push(request);
 }
 
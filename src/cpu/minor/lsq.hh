@@ -129,7 +129,8 @@ class LSQ : public Named
      *  system. */
     class LSQRequest :
         public BaseMMU::Translation, /* For TLB lookups */
-        public Packet::SenderState /* For packing into a Packet */
+        public Packet::SenderState, /* For packing into a Packet */
+        public PoolAllocated /* From MinorCPU::lsqRequestPool */
     {
       public:
         /** Owning port */
@@ -0,0 +1,185 @@
+#include "cpu/minor/lvp_trace.hh"
+
+#include <chrono>
+
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "cpu/minor/cpu.hh"
+#include "sim/sim_exit.hh"
+
+namespace gem5
+{
+
+GEM5_DEPRECATED_NAMESPACE(Minor, minor);
+namespace minor
+{
+
+LVPTraceRecorder::LVPTraceRecorder(const LVPTraceRecorderParams &params)
+    : ProbeListenerObject(params),
+      traceStream(nullptr)
+{
+    MinorCPU *cpu = dynamic_cast<MinorCPU *>(params.manager);
+    fatal_if(!cpu, "%s: manager must be a Minor CPU\n", name());
+
+    traceStream = new ProtoOutputStream(simout.resolve(params.trace_file));
+
+    ProtoMessage::LVPTraceHeader header;
+    header.set_obj_id(cpu->name());
+    header.set_max_vec_bytes(cpu->getLVPU().vec_bytes());
+    traceStream->write(header);
+
+    registerExitCallback([this]() { close(); });
+}
+
+void
+LVPTraceRecorder::regProbeListeners()
+{
+    typedef ProbeListenerArg<LVPTraceRecorder, LVPU::MemRefRecord>
+        MemRefListener;
+    listeners.push_back(new MemRefListener(this, "LVPUMemRefs",
+                                           &LVPTraceRecorder::record));
+}
+
+void
+LVPTraceRecorder::record(const LVPU::MemRefRecord &mem_ref)
+{
+    if (!traceStream)
+        return;
+
+    traceRecord.Clear();
+    traceRecord.set_addr(mem_ref.mem_addr);
+    traceRecord.set_size(mem_ref.size);
+    if (mem_ref.is_load) {
+        traceRecord.set_type(ProtoMessage::LVPTraceRecord::LOAD);
+        traceRecord.set_pc(mem_ref.pc);
+        for (RegVal value : *mem_ref.values)
+            traceRecord.add_values(value);
+        if (!mem_ref.representable)
+            traceRecord.set_unrepresentable(true);
+        if (mem_ref.has_base_update_dests)
+            traceRecord.set_rmw_dests(true);
+    } else {
+        traceRecord.set_type(ProtoMessage::LVPTraceRecord::STORE);
+    }
+    traceStream->write(traceRecord);
+}
+
+void
+LVPTraceRecorder::close()
+{
+    delete traceStream;
+    traceStream = nullptr;
+}
+
+LVPTraceReplayer::LVPTraceReplayer(const LVPTraceReplayerParams &params)
+    : SimObject(params),
+      traceFile(params.trace_file),
+      maxRecords(params.max_records),
+      lvpu(name() + ".lvpu", this, BaseISA::RegClasses(),
+          LVPU::Config::from_params(params)),
+      replayEvent([this]{ replay(); }, name()),
+      stats(this)
+{
+    fatal_if(!lvpu.enabled(), "%s: lvpu_policy must not be disabled\n",
+        name());
+}
+
+void
+LVPTraceReplayer::startup()
+{
+    schedule(replayEvent, curTick());
+}
+
+void
+LVPTraceReplayer::replay()
+{
+    ProtoInputStream trace(traceFile);
+
+    ProtoMessage::LVPTraceHeader header;
+    fatal_if(!trace.read(header), "%s: %s is not an LVP trace\n", name(),
+        traceFile);
+    // Vector loads are recorded with as many values as the recording
+    // CPU's LVPT holds, so the replayed LVPT must hold as many
+    fatal_if(header.max_vec_bytes() != lvpu.vec_bytes(),
+        "%s: %s was recorded with lvpt_max_vec_bytes %d, not %d\n",
+        name(), traceFile, header.max_vec_bytes(), lvpu.vec_bytes());
+
+    auto start = std::chrono::steady_clock::now();
+
+    ProtoMessage::LVPTraceRecord record;
+    uint64_t num_records = 0;
+    while ((maxRecords == 0 || num_records < maxRecords) &&
+        trace.read(record)) {
+        if (record.type() == ProtoMessage::LVPTraceRecord::LOAD) {
+            replayLoad(record);
+        } else {
+            stats.stores++;
+            lvpu.update_store_addr(record.addr(), record.size());
+        }
+        num_records++;
+    }
+
+    std::chrono::duration<double> host_seconds =
+        std::chrono::steady_clock::now() - start;
+    inform("%s: replayed %d records of %s from %s in %.2fs\n", name(),
+        num_records, header.obj_id(), traceFile, host_seconds.count());
+
+    exitSimLoop("LVP trace replayed");
+}
+
+void
+LVPTraceReplayer::replayLoad(const ProtoMessage::LVPTraceRecord &record)
+{
+    stats.loads++;
+
+    Addr pc = record.pc();
+    values.assign(record.values().begin(), record.values().end());
+
+    // Fetch2 allocates loads before the LSQ sees them
+    lvpu.add_entry(pc);
+
+    if (lvpu.bypasses() && !record.rmw_dests() &&
+        lvpu.is_constant(pc, record.addr())) {
+        lvpu.stats.memory_bypasses++;
+        // The recording CPU's constants always match memory.  The
+        // replayed LVPU may keep a constant whose load the recording one
+        // replaced or never bypassed
+        lvpu.read_entry(pc, predictedValues);
+        if (record.unrepresentable() || predictedValues != values)
+            stats.constantMismatches++;
+        return;
+    }
+
+    // The replay has no loads in flight, so each load is looked up just
+    // before it trains the predictor
+    bool predicted = lvpu.predict_values(pc, values.size(), predictions,
+        predictedValues) && lvpu.is_predictable(pc);
+
+    LVPU::PredictionResults results = lvpu.prediction_results(pc,
+        predictions, values, !record.unrepresentable());
+    if (results.entry_upgraded)
+        lvpu.add_cvt_entry(pc, record.addr(), record.size());
+
+    if (predicted) {
+        lvpu.stats.num_predictions++;
+        if (record.unrepresentable() || predictedValues != values)
+            lvpu.stats.incorrect_predictions++;
+        else
+            lvpu.stats.correct_predictions++;
+    }
+}
+
+LVPTraceReplayer::ReplayerStats::ReplayerStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(loads, statistics::units::Count::get(),
+               "Number of loads replayed"),
+      ADD_STAT(stores, statistics::units::Count::get(),
+               "Number of stores replayed"),
+      ADD_STAT(constantMismatches, statistics::units::Count::get(),
+               "Number of memory bypasses whose values differ from the"
+               " traced ones")
+{
+}
+
+} // namespace minor
+} // namespace gem5
@@ -0,0 +1,96 @@
+/**
+ * @file
+ * Load value prediction traces, so LVPU configurations can be compared
+ * without rerunning the CPU.  LVPTraceRecorder listens to a Minor CPU's
+ * LVPUMemRefs probe point and writes the loads and stores its LVPU sees,
+ * with the values loaded, to a protobuf stream in commit order.
+ * LVPTraceReplayer trains an LVPU of its own with such a trace, allocating
+ * and bypassing loads as Fetch2 and the LSQ would, and reports the LVPU's
+ * stats.  Only the LVPU's tables are modelled, not the effect of their
+ * predictions on timing.
+ */
+
+#ifndef __CPU_MINOR_LVP_TRACE_HH__
+#define __CPU_MINOR_LVP_TRACE_HH__
+
+#include <string>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "cpu/minor/lvpu.hh"
+#include "params/LVPTraceRecorder.hh"
+#include "params/LVPTraceReplayer.hh"
+#include "proto/lvp_trace.pb.h"
+#include "proto/protoio.hh"
+#include "sim/eventq.hh"
+#include "sim/probe/probe.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+GEM5_DEPRECATED_NAMESPACE(Minor, minor);
+namespace minor
+{
+
+class LVPTraceRecorder : public ProbeListenerObject
+{
+  public:
+    LVPTraceRecorder(const LVPTraceRecorderParams &params);
+
+    void regProbeListeners() override;
+
+    /** Write a record of a load or store */
+    void record(const LVPU::MemRefRecord &mem_ref);
+
+    /** Flush and close the trace, at exit */
+    void close();
+
+  protected:
+    ProtoOutputStream *traceStream;
+
+    /** Reused for every record */
+    ProtoMessage::LVPTraceRecord traceRecord;
+};
+
+class LVPTraceReplayer : public SimObject
+{
+  public:
+    LVPTraceReplayer(const LVPTraceReplayerParams &params);
+
+    void startup() override;
+
+  protected:
+    /** Replay the whole trace and exit the simulation loop */
+    void replay();
+
+    void replayLoad(const ProtoMessage::LVPTraceRecord &record);
+
+    std::string traceFile;
+
+    /** Records to replay, 0 for the whole trace */
+    const uint64_t maxRecords;
+
+    LVPU lvpu;
+
+    EventFunctionWrapper replayEvent;
+
+    /** Reused for every load */
+    std::vector<RegVal> values;
+    std::vector<RegVal> predictedValues;
+    std::vector<value_prediction::ValuePredictor::Prediction> predictions;
+
+    struct ReplayerStats : public statistics::Group
+    {
+        ReplayerStats(statistics::Group *parent);
+
+        statistics::Scalar loads;
+        statistics::Scalar stores;
+        statistics::Scalar constantMismatches;
+    } stats;
+};
+
+} // namespace minor
+} // namespace gem5
+
+#endif // __CPU_MINOR_LVP_TRACE_HH__
@@ -1,18 +1,24 @@
 #include "cpu/minor/lvpu.hh"
 
+#include <algorithm>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 
 #include "base/compiler.hh"
+#include "base/intmath.hh"
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "cpu/minor/exec_context.hh"
 #include "cpu/minor/cpu.hh"
 #include "cpu/minor/execute.hh"
 #include "cpu/minor/pipeline.hh"
+#include "cpu/static_inst.hh"
+#include "cpu/thread_context.hh"
 #include "cpu/utils.hh"
 #include "debug/TEST.hh"
 #include "debug/LVPU.hh"
+#include "mem/cache/prefetch/associative_set_impl.hh"
 
 namespace gem5
 {
@@ -21,75 +27,322 @@ GEM5_DEPRECATED_NAMESPACE(Minor, minor);
 namespace minor
 {
 
+namespace
+{
+
+bool
+policy_trains(LVPUPolicy policy)
+{
+    return policy != LVPUPolicy::disabled;
+}
+
+bool
+policy_predicts(LVPUPolicy policy)
+{
+    return policy == LVPUPolicy::none || policy == LVPUPolicy::no_constants;
+}
+
+bool
+policy_bypasses(LVPUPolicy policy)
+{
+    return policy == LVPUPolicy::none || policy == LVPUPolicy::constant_only;
+}
+
+/** True if every way of the set that addr indexes holds a valid entry */
+template <class Entry>
+bool
+set_full(const AssociativeSet<Entry> &table, Addr addr)
+{
+    for (const Entry *entry : table.getPossibleEntries(addr)) {
+        if (!entry->isValid())
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Find or insert the entry of an address, without the bookkeeping of a
+ * demand insertion.  A full set loses the entry its replacement policy
+ * chooses.
+ */
+template <class Entry>
+Entry *
+restore_entry(AssociativeSet<Entry> &table, Addr addr, bool is_secure)
+{
+    Entry *entry = table.findEntry(addr, is_secure);
+    if (!entry) {
+        entry = table.findVictim(addr);
+        table.insertEntry(addr, is_secure, entry);
+    }
+    return entry;
+}
+
+} // anonymous namespace
+
+uint32_t
+LVPUHashedSetAssociative::extractSet(const Addr pc) const
+{
+    const Addr hash1 = pc >> 1;
+    const Addr hash2 = hash1 >> tagShift;
+    return (hash1 ^ hash2) & setMask;
+}
+
+Addr
+LVPUHashedSetAssociative::extractTag(const Addr addr) const
+{
+    return addr;
+}
+
+void
+LVPU::lvpt_entry::invalidate()
+{
+    TaggedEntry::invalidate();
+    value_valid = false;
+    values.clear();
+}
+
+void
+LVPU::lct_entry::invalidate()
+{
+    TaggedEntry::invalidate();
+    classification.reset();
+}
+
+void
+LVPU::cvt_entry::invalidate()
+{
+    TaggedEntry::invalidate();
+    mem_addr = MaxAddr;
+    size = 0;
+}
+
 LVPU::LVPU(std::string name_,
-    MinorCPU &cpu_,
-    int num_lvpt_entries_,
-    int num_lct_entries_,
-    int num_cvt_entries_,
-    int bits_per_entry_,
-    std::string hacks_) :
+    statistics::Group *stats_parent,
+    const BaseISA::RegClasses &reg_classes_,
+    const Config &config) :
     Named(name_),
-    num_lvpt_entries(num_lvpt_entries_),
-    num_lct_entries(num_lct_entries_),
-    num_cvt_entries(num_cvt_entries_),
-    bits_per_entry(bits_per_entry_),
-    hacks(hacks_),
-    stats(&cpu_)
+    stats(stats_parent),
+    num_lct_entries(config.num_lct_entries),
+    bits_per_entry(config.lct_bits_per_entry),
+    num_lvpt_entries(config.num_lvpt_entries),
+    num_cvt_entries(config.num_cvt_entries),
+    cvt_block_size(config.cvt_block_size),
+    max_vec_bytes(config.lvpt_max_vec_bytes),
+    reg_classes(reg_classes_),
+    train(policy_trains(config.lvpu_policy)),
+    predict(policy_predicts(config.lvpu_policy)),
+    bypass(policy_bypasses(config.lvpu_policy)),
+    lvpt_table(config.lvpt_assoc, config.num_lvpt_entries,
+        config.lvpt_indexing_policy, config.lvpt_replacement_policy),
+    lc_table(config.lct_assoc, config.num_lct_entries,
+        config.lct_indexing_policy, config.lct_replacement_policy,
+        lct_entry(SatCounter8(config.lct_bits_per_entry))),
+    cv_table(config.cvt_assoc, config.num_cvt_entries,
+        config.cvt_indexing_policy, config.cvt_replacement_policy),
+    value_pred(config.valuePred)
 {
-    DPRINTF(LVPU, "LVPT created. num_lvpt_entries: %s, num_lct_entries: %s, num_cvt_entries: %s, lct_bits_per_entry: %s\n",
+    fatal_if(!value_pred, "%s: valuePred must be set\n", name_);
+
+    fatal_if(bits_per_entry < 1 || bits_per_entry > 8,
+        "%s: lct_bits_per_entry must be between 1 and 8 (%d)\n",
+        name_, bits_per_entry);
+    fatal_if(!isPowerOf2(cvt_block_size),
+        "%s: cvt_block_size must be a power of 2 (%d)\n",
+        name_, cvt_block_size);
+    fatal_if(max_vec_bytes % sizeof(RegVal) != 0,
+        "%s: lvpt_max_vec_bytes must be a multiple of %d (%d)\n",
+        name_, sizeof(RegVal), max_vec_bytes);
+
+    DPRINTF(LVPU, "LVPT created. num_lvpt_entries: %s, num_lct_entries: %s, num_cvt_entries: %s, lct_bits_per_entry: %s, train: %d, predict: %d, bypass: %d\n",
         num_lvpt_entries,
         num_lct_entries,
         num_cvt_entries,
-        bits_per_entry);
+        bits_per_entry,
+        train, predict, bypass);
+}
+
+Addr
+LVPU::load_key(const PCStateBase &pc)
+{
+    return pc.instAddr() ^ (pc.microPC() * 0x9e3779b97f4a7c15ULL);
+}
+
+Addr
+LVPU::slot_key(Addr pc, unsigned slot)
+{
+    // Slot 0 keeps the load key so single register loads train the
+    // predictor under their own PC
+    return pc ^ (slot * 0xc2b2ae3d27d4eb4fULL);
+}
+
+bool
+LVPU::is_base_update_dest(const StaticInstPtr &si, unsigned dest_index)
+{
+    if (!si->isBaseUpdate())
+        return false;
+
+    // The base is the destination that is also a source
+    const RegId &dest = si->destRegIdx(dest_index);
+    for (int src_index = 0; src_index < si->numSrcRegs(); src_index++) {
+        if (si->srcRegIdx(src_index) == dest)
+            return true;
+    }
+    return false;
+}
+
+bool
+LVPU::has_base_update_dests(const StaticInstPtr &si)
+{
+    for (int dest_index = 0; dest_index < si->numDestRegs(); dest_index++) {
+        if (is_base_update_dest(si, dest_index))
+            return true;
+    }
+    return false;
 }
 
-int LVPU::find_entry(Addr pc)
+unsigned
+LVPU::value_slots(const StaticInstPtr &si) const
 {
-    for (int i = 0; i < lvpt_table.size(); i++) {
-        if (pc == lvpt_table[i].pc) {
-            DPRINTF(LVPU,
-                "find_entry: Found entry PC: %s, valid: %s, value: %s\n",
-                pc,
-                lvpt_table[i].valid,
-                lvpt_table[i].value);
-            return i;
+    unsigned num_slots = 0;
+    for (int dest_index = 0; dest_index < si->numDestRegs(); dest_index++) {
+        const RegId &dest = si->destRegIdx(dest_index);
+        if (dest.is(InvalidRegClass) || is_base_update_dest(si, dest_index))
+            continue;
+
+        switch (dest.classValue()) {
+          case IntRegClass:
+          case FloatRegClass:
+          case VecElemClass:
+          case CCRegClass:
+            num_slots++;
+            break;
+          case VecRegClass:
+            num_slots += divCeil(std::min<size_t>(max_vec_bytes,
+                reg_classes.at(VecRegClass).regBytes()), sizeof(RegVal));
+            break;
+          default:
+            // Predicate and misc registers aren't predicted
+            return 0;
+        }
+    }
+    return num_slots;
+}
+
+bool
+LVPU::read_dests(const StaticInstPtr &si, ThreadContext &thread,
+    std::vector<RegVal> &values) const
+{
+    bool representable = true;
+    values.clear();
+    for (int dest_index = 0; dest_index < si->numDestRegs(); dest_index++) {
+        const RegId &dest = si->destRegIdx(dest_index);
+        if (dest.is(InvalidRegClass) || is_base_update_dest(si, dest_index))
+            continue;
+
+        if (!dest.is(VecRegClass)) {
+            values.push_back(thread.getReg(dest));
+            continue;
+        }
+
+        size_t reg_bytes = reg_classes.at(VecRegClass).regBytes();
+        size_t held_bytes = std::min<size_t>(max_vec_bytes, reg_bytes);
+        std::vector<uint8_t> reg(reg_bytes);
+        thread.getReg(dest, reg.data());
+
+        for (size_t offset = 0; offset < held_bytes;
+            offset += sizeof(RegVal)) {
+            RegVal value = 0;
+            std::memcpy(&value, &reg[offset],
+                std::min(sizeof(RegVal), held_bytes - offset));
+            values.push_back(value);
+        }
+        representable = representable &&
+            std::all_of(reg.begin() + held_bytes, reg.end(),
+                [](uint8_t byte) { return byte == 0; });
+    }
+    return representable;
+}
+
+void
+LVPU::write_dests(const StaticInstPtr &si, ThreadContext &thread,
+    const std::vector<RegVal> &values) const
+{
+    auto value = values.begin();
+    for (int dest_index = 0; dest_index < si->numDestRegs(); dest_index++) {
+        const RegId &dest = si->destRegIdx(dest_index);
+        if (dest.is(InvalidRegClass) || is_base_update_dest(si, dest_index))
+            continue;
+
+        if (!dest.is(VecRegClass)) {
+            assert(value != values.end());
+            thread.setReg(dest, *value++);
+            DPRINTF(LVPU, "write_dests: reg: %s, value: %#x\n",
+                dest, *(value - 1));
+            continue;
+        }
+
+        size_t reg_bytes = reg_classes.at(VecRegClass).regBytes();
+        size_t held_bytes = std::min<size_t>(max_vec_bytes, reg_bytes);
+        std::vector<uint8_t> reg(reg_bytes, 0);
+
+        for (size_t offset = 0; offset < held_bytes;
+            offset += sizeof(RegVal)) {
+            assert(value != values.end());
+            std::memcpy(&reg[offset], &*value++,
+                std::min(sizeof(RegVal), held_bytes - offset));
         }
+        thread.setReg(dest, reg.data());
+        DPRINTF(LVPU, "write_dests: reg: %s, %d bytes\n", dest, held_bytes);
+    }
+}
+
+LVPU::lvpt_entry *
+LVPU::find_entry(Addr pc)
+{
+    lvpt_entry *entry = lvpt_table.findEntry(pc, is_secure);
+    if (entry) {
+        DPRINTF(LVPU,
+            "find_entry: Found entry PC: %s, valid: %s, values: %d\n",
+            pc,
+            entry->value_valid,
+            entry->values.size());
+        return entry;
     }
     DPRINTF(LVPU,
         "find_entry: No entry found.  PC: %s\n",
         pc);
-    return -1;
+    return nullptr;
 }
 
 void LVPU::add_entry(Addr pc) {
-    //TODO: Limit number of entries to num_entries
-    //TODO: Figure out when to remove entries.  Based on classification?
-    if (find_entry(pc) == -1) {
-        struct lvpt_entry e = {pc, false, 0};
-        lvpt_table.push_back(e);
+    if (find_entry(pc) == nullptr) {
+        if (set_full(lvpt_table, pc)) {
+            stats.lvpt_replacements++;
+        }
+        lvpt_entry *victim = lvpt_table.findVictim(pc);
+        lvpt_table.insertEntry(pc, is_secure, victim);
         DPRINTF(LVPU,
-            "add_entry: Adding entry to LVPT. PC: %s, Number of entries: %s\n",
-            pc,
-            lvpt_table.size());
+            "add_entry: Adding entry to LVPT. PC: %s\n",
+            pc);
         add_lct_entry(pc);
     } else {
         DPRINTF(LVPU,
-            "add_entry: Entry already found in LVPT. PC: %s, Number of entries: %s\n",
-            pc,
-            lvpt_table.size());
+            "add_entry: Entry already found in LVPT. PC: %s\n",
+            pc);
     }
     return;
 }
 
-void LVPU::update_entry(Addr pc, RegVal value) {
-    int entry_index = find_entry(pc);
-    if (entry_index != -1) {
-        lvpt_table[entry_index].value = value;
-        lvpt_table[entry_index].valid = true;
+void LVPU::update_entry(Addr pc, const std::vector<RegVal> &values) {
+    lvpt_entry *entry = find_entry(pc);
+    if (entry) {
+        lvpt_table.accessEntry(entry);
+        entry->values = values;
+        entry->value_valid = true;
         DPRINTF(LVPU,
-            "update_entry: Updated entry. PC: %s, Value: %s\n",
+            "update_entry: Updated entry. PC: %s, Value[0]: %s\n",
             pc,
-            value);
+            values.empty() ? 0 : values[0]);
     } else {
         DPRINTF(LVPU,
             "update_entry: Tried to update an entry that doesn't exist. PC: %s\n",
@@ -99,9 +352,9 @@ void LVPU::update_entry(Addr pc, RegVal value) {
 
 bool LVPU::valid_entry(Addr pc) {
     bool valid = false;
-    int entry_index = find_entry(pc);
-    if (entry_index != -1) {
-        valid = lvpt_table[entry_index].valid;
+    lvpt_entry *entry = find_entry(pc);
+    if (entry) {
+        valid = entry->value_valid;
         DPRINTF(LVPU,
             "valid_entry: entry found. pc: %s, valid: %s\n",
             pc,
@@ -114,21 +367,22 @@ bool LVPU::valid_entry(Addr pc) {
     return valid;
 }
 
-RegVal LVPU::read_entry(Addr pc) {
-    int entry_index = find_entry(pc);
-    RegVal value;
-    if (entry_index != -1 and valid_entry(pc)) {
-        value = lvpt_table[entry_index].value;
+bool LVPU::read_entry(Addr pc, std::vector<RegVal> &values) {
+    lvpt_entry *entry = find_entry(pc);
+    if (entry && entry->value_valid) {
+        lvpt_table.accessEntry(entry);
+        values = entry->values;
         DPRINTF(LVPU,
-            "read_entry: pc: %s, value: %s\n",
+            "read_entry: pc: %s, values: %d\n",
             pc,
-            value);
+            values.size());
+        return true;
     }
-    return value;
+    return false;
 }
 
-LVPU::LVPUStats::LVPUStats(MinorCPU *cpu)
-    : statistics::Group(cpu, "lvpu"),
+LVPU::LVPUStats::LVPUStats(statistics::Group *parent)
+    : statistics::Group(parent, "lvpu"),
     ADD_STAT(num_predictions, statistics::units::Count::get(),
              "Number of LVPU predictions"),
     ADD_STAT(correct_predictions, statistics::units::Count::get(),
@@ -136,7 +390,27 @@ LVPU::LVPUStats::LVPUStats(MinorCPU *cpu)
     ADD_STAT(incorrect_predictions, statistics::units::Count::get(),
              "Number of incorrect LVPU predictions"),
     ADD_STAT(memory_bypasses, statistics::units::Count::get(),
-             "Number of memory bypasses from constant loads")
+             "Number of memory bypasses from constant loads"),
+    ADD_STAT(lvpt_replacements, statistics::units::Count::get(),
+             "Number of valid LVPT entries replaced"),
+    ADD_STAT(lct_replacements, statistics::units::Count::get(),
+             "Number of valid LCT entries replaced"),
+    ADD_STAT(cvt_replacements, statistics::units::Count::get(),
+             "Number of valid CVT entries replaced"),
+    ADD_STAT(cvt_store_invalidations, statistics::units::Count::get(),
+             "Number of CVT entries invalidated by overlapping stores"),
+    ADD_STAT(selective_replays, statistics::units::Count::get(),
+             "Number of incorrect predictions recovered by replaying their"
+             " consumers"),
+    ADD_STAT(replay_flush_fallbacks, statistics::units::Count::get(),
+             "Number of incorrect predictions flushed because a consumer"
+             " had already accessed memory"),
+    ADD_STAT(replayed_insts, statistics::units::Count::get(),
+             "Number of in-flight instructions replayed after incorrect"
+             " predictions"),
+    ADD_STAT(squashable_insts, statistics::units::Count::get(),
+             "Number of in-flight instructions a flush squashes, or would"
+             " have squashed, after incorrect predictions")
 {
     num_predictions
         .flags(statistics::total);
@@ -146,136 +420,176 @@ LVPU::LVPUStats::LVPUStats(MinorCPU *cpu)
         .flags(statistics::total);
     memory_bypasses
         .flags(statistics::total);
+    lvpt_replacements
+        .flags(statistics::total);
+    lct_replacements
+        .flags(statistics::total);
+    cvt_replacements
+        .flags(statistics::total);
+    cvt_store_invalidations
+        .flags(statistics::total);
+    selective_replays
+        .flags(statistics::total);
+    replay_flush_fallbacks
+        .flags(statistics::total);
+    replayed_insts
+        .flags(statistics::total);
+    squashable_insts
+        .flags(statistics::total);
 }
 
-LVPU::PredictionResults LVPU::prediction_results(Addr pc, RegVal value) {
+bool LVPU::predict_values(Addr pc, unsigned num_slots,
+    std::vector<value_prediction::ValuePredictor::Prediction> &predictions,
+    std::vector<RegVal> &values) {
+    predictions.clear();
+    if (find_entry(pc) == nullptr) {
+        return false;
+    }
+    // Every slot is looked up, so that every slot can be trained with the
+    // prediction it issued with
+    predictions.resize(num_slots);
+    values.resize(num_slots);
+    bool predicted = true;
+    for (unsigned slot = 0; slot < num_slots; slot++) {
+        predicted &= value_pred->predict(slot_key(pc, slot),
+            predictions[slot]);
+        values[slot] = predictions[slot].value;
+    }
+    return predicted;
+}
+
+LVPU::PredictionResults LVPU::prediction_results(Addr pc,
+    const std::vector<value_prediction::ValuePredictor::Prediction>
+        &predictions,
+    const std::vector<RegVal> &values, bool representable) {
     bool misprediction = false;
     bool entry_upgraded = false;
-    if (valid_entry(pc)) {
-        // Compare predicted value with value returned from memory
-        RegVal predicted_value = read_entry(pc);
-        if (predicted_value == value) {
-            DPRINTF(LVPU, "prediction_results: Correct prediction\n");
-            // Get previous classification to determine if entry was upgraded
-            Classification previous_classification = get_classification(pc);
-            increment_counter(pc);
-            Classification new_classification = get_classification(pc);
-            if (previous_classification != Constant && new_classification == Constant) {
-                DPRINTF(LVPU, "prediction_results: Entry upgraded to constant. pc: %s\n", pc);
-                entry_upgraded = true;
-            }
+    // Compare the prediction of every slot made when the load issued with
+    // the values returned from memory.  Older loads of the same PC may
+    // have trained the predictor since, so it isn't looked up again.  The
+    // load is only correct if all slots are correct.  Slots the load
+    // wasn't looked up for have no prediction
+    value_prediction::ValuePredictor::Outcome outcome =
+        value_prediction::ValuePredictor::Correct;
+    for (unsigned slot = 0; slot < values.size(); slot++) {
+        value_prediction::ValuePredictor::Outcome slot_outcome =
+            value_prediction::ValuePredictor::NoPrediction;
+        if (slot < predictions.size()) {
+            slot_outcome = value_pred->train(slot_key(pc, slot),
+                values[slot], predictions[slot]);
         } else {
-            DPRINTF(LVPU, "prediction_results: Incorrect prediction\n");
-            decrement_counter(pc);
-            misprediction = true;
+            value_pred->train(slot_key(pc, slot), values[slot]);
         }
+        if (slot_outcome == value_prediction::ValuePredictor::Incorrect) {
+            outcome = slot_outcome;
+        } else if (slot_outcome ==
+            value_prediction::ValuePredictor::NoPrediction &&
+            outcome == value_prediction::ValuePredictor::Correct) {
+            outcome = slot_outcome;
+        }
+    }
+    if (!representable) {
+        outcome = value_prediction::ValuePredictor::Incorrect;
+    }
+    if (find_entry(pc) == nullptr) {
+        DPRINTF(LVPU, "check_prediction: LVPT entry not found. \n");
+    } else if (outcome == value_prediction::ValuePredictor::Correct) {
+        DPRINTF(LVPU, "prediction_results: Correct prediction\n");
+        // Get previous classification to determine if entry was upgraded
+        Classification previous_classification = get_classification(pc);
+        increment_counter(pc);
+        Classification new_classification = get_classification(pc);
+        if (previous_classification != Constant && new_classification == Constant) {
+            DPRINTF(LVPU, "prediction_results: Entry upgraded to constant. pc: %s\n", pc);
+            entry_upgraded = true;
+        }
+    } else if (outcome == value_prediction::ValuePredictor::Incorrect) {
+        DPRINTF(LVPU, "prediction_results: Incorrect prediction\n");
+        decrement_counter(pc);
+        misprediction = true;
     } else {
-        DPRINTF(LVPU, "check_prediction: Valid LVPT entry not found. \n");
+        DPRINTF(LVPU, "check_prediction: No prediction for pc: %s\n", pc);
     }
-    update_entry(pc, value);
+    update_entry(pc, values);
     PredictionResults results = {misprediction, entry_upgraded};
     return results;
 }
 
 void LVPU::decrement_counter(Addr pc) {
-    int min_value = 0; // Minimum value for the counter
-    int index = find_lct_entry(pc);
-    if (index != -1) {
-        if (lc_table[index].classification > min_value) {
-            lc_table[index].classification--;
+    lct_entry *entry = find_lct_entry(pc);
+    if (entry) {
+        if (entry->classification > 0) {
+            entry->classification--;
             DPRINTF(LVPU, "d_counter: decremented classification to %d\n",
-                lc_table[index].classification);
+                (int)entry->classification);
         } else {
-            DPRINTF(LVPU, "d_counter: classification already at minimum (%d)\n", min_value);
+            DPRINTF(LVPU, "d_counter: classification already at minimum (%d)\n", 0);
         }
     }
     return;
 }
 
 void LVPU::increment_counter(Addr pc) {
-    int max_value = (1 << bits_per_entry) - 1; // maximum value for the counter
-    int index = find_lct_entry(pc);
-    if (index != -1) {
-        if (lc_table[index].classification < max_value) {
-            lc_table[index].classification++;
+    lct_entry *entry = find_lct_entry(pc);
+    if (entry) {
+        if (!entry->classification.isSaturated()) {
+            entry->classification++;
             DPRINTF(LVPU, "incre_counter: Incremented classification to %d\n",
-                lc_table[index].classification);
+                (int)entry->classification);
         } else {
-            DPRINTF(LVPU, "incre_counter: classification already at maximum  (%d)\n", max_value);
+            DPRINTF(LVPU, "incre_counter: classification already at maximum  (%d)\n",
+                (int)entry->classification);
         }
     }
     return;
 }
 
-int LVPU::find_lct_entry(long unsigned int pc) {
-    for (size_t i = 0; i < lc_table.size(); i++) {
-        if (lc_table[i].pc == pc) {
-            return i; // Entry found, return index
-        }
+LVPU::lct_entry *
+LVPU::find_lct_entry(Addr pc) {
+    lct_entry *entry = lc_table.findEntry(pc, is_secure);
+    if (entry) {
+        lc_table.accessEntry(entry);
     }
-    return -1; // Entry not found
+    return entry;
 }
 
 void LVPU::add_lct_entry(Addr pc) {
-    //TODO
-    // Default classification to 0
-
     // check if  PC already exists in the LCT
-    if (find_lct_entry(pc) == -1) {
-        if (lc_table.size() >= num_lct_entries) {       //   LCT does not exceed  maximum number of entries
-            // Replace an existing entry based on classification
-            // remove the first entry classified as 'Unpredictable'
-
-            auto it = std::find_if(lc_table.begin(), lc_table.end(), [this](const lct_entry &entry) {
-                return this->get_classification(entry.pc) == Unpredictable;
-            });
-
-            if (it != lc_table.end()) {
-                DPRINTF(LVPU, "add_lct_entry: Replacing entry with PC: %lx\n", it->pc);
-                lc_table.erase(it);
-            } else {
-                DPRINTF(LVPU, "add_lct_entry: Unable to replace any entry in LCT.\n");
-                return;
-            }
+    if (find_lct_entry(pc) == nullptr) {
+        // Replace an entry of the indexed set chosen by the replacement
+        // policy.  Default classification is Unpredictable
+        if (set_full(lc_table, pc)) {
+            DPRINTF(LVPU, "add_lct_entry: Replacing entry in set for PC: %lx\n", pc);
+            stats.lct_replacements++;
         }
-
-        //  a new LCT entry and add it to the table
-        struct lct_entry new_entry = {pc, 0}; // Default classification is Unpredictable
-        lc_table.push_back(new_entry);
+        lct_entry *victim = lc_table.findVictim(pc);
+        lc_table.insertEntry(pc, is_secure, victim);
 
         DPRINTF(LVPU,
-            "add_lct_entry: Added entry to LCT. PC: %s, Total entries: %s\n",
-            pc, lc_table.size());
+            "add_lct_entry: Added entry to LCT. PC: %s\n", pc);
     } else {
         DPRINTF(LVPU,
-            "add_lct_entry: Entry already exists in LCT. PC: %s, Total entries: %s\n",
-            pc, lc_table.size());
+            "add_lct_entry: Entry already exists in LCT. PC: %s\n", pc);
     }
 }
 
 bool LVPU::is_predictable(Addr pc) {
-    //TODO
-    // Predictable when lvpt has a valid entry and lct classified as predictable
-    // for 1 bit counter Predictable when classification == 1, unpredictable if classification == 0
-    // for 2 bit counter predictable when classification == 2 or 3, unpredictable if classification == 0 or 1
-
     // Disables load value prediction.  Registers should not be written to and lvpu should not issue a branch
-    if (hacks == "never_predictable" or hacks == "constant_only") {
+    if (!predict) {
         return false;
     }
-    //TODO
-    // Predictable when lvpt has a valid entry and lct classified as predictable
+
+    // Predictable when lvpt has an entry and lct classified as predictable
     // for 1 bit counter Predictable when classification == 1, unpredictable if classification == 0
     // for 2 bit counter predictable when classification == 2 or 3, unpredictable if classification == 0 or 1
 
-    // ensure the entry exists and valid in LVPT
-    if (!valid_entry(pc)) {
+    // ensure the entry exists in LVPT.  The value comes from the value predictor
+    if (find_entry(pc) == nullptr) {
         return false; //
     }
 
     // Check LCT classification
-    int lct_index = find_lct_entry(pc);
-    if (lct_index == -1) {
+    if (find_lct_entry(pc) == nullptr) {
         return false; // not predictable if no LCT entry exist
     }
 
@@ -288,17 +602,16 @@ bool LVPU::is_predictable(Addr pc) {
 
 bool LVPU::is_constant(Addr pc, Addr mem_addr) {
     // Return true if classified as a constant and has an entry in cvt with matching pc
-    if (hacks == "never_predictable") {
+    if (!bypass) {
         return false;
     }
-    
+
     // Check for valid entry
     if (!valid_entry(pc)) {
         return false;
     }
 
-    int lct_index = find_lct_entry(pc);
-    if (lct_index == -1) {
+    if (find_lct_entry(pc) == nullptr) {
         return false;
     }
 
@@ -316,66 +629,311 @@ bool LVPU::is_constant(Addr pc, Addr mem_addr) {
 }
 
 LVPU::Classification LVPU::get_classification(Addr pc) {
-    int index = find_lct_entry(pc);
-    if (index != -1) {
-        int classification = lc_table[index].classification;
-        switch (bits_per_entry) {
-            case 1:
-                switch (classification) {
-                    case 0:
-                        return Unpredictable;
-                    case 1:
-                        return Constant;
-                }
-            case 2:
-                switch (classification) {
-                    case 0:
-                        return Unpredictable;
-                    case 1:
-                        return Unpredictable;
-                    case 2:
-                        return Predictable;
-                    case 3:
-                        return Constant;
-                }
+    lct_entry *entry = find_lct_entry(pc);
+    if (entry) {
+        // A saturated counter is Constant.  With more than one bit the
+        // upper half of the range below saturation is Predictable, e.g.
+        // for 2 bits 0/1 are Unpredictable, 2 is Predictable, 3 Constant
+        if (entry->classification.isSaturated()) {
+            return Constant;
+        } else if (bits_per_entry > 1 &&
+            entry->classification >= (1 << (bits_per_entry - 1))) {
+            return Predictable;
         }
     }
     return Unpredictable;
 }
 
 bool LVPU::verify_constant(Addr pc, Addr mem_addr) {
-    if (hacks == "no_constants") {
+    if (!bypass) {
         return false;
     }
-    for (auto entry : cv_table) {
-        if (entry.pc==pc && entry.mem_addr==mem_addr) {
-            return true;
-        }
+    cvt_entry *entry = cv_table.findEntry(pc, is_secure);
+    if (entry && entry->mem_addr == mem_addr) {
+        cv_table.accessEntry(entry);
+        return true;
     }
     return false;
 }
 
-void LVPU::add_cvt_entry(Addr pc, Addr mem_addr) {
-    //TODO
-    // Loads are indexed by both the load address and the memory address
-    if (cv_table.size() <= num_cvt_entries) {
-        DPRINTF(LVPU, "Adding entry to CVT. pc: %s, mem_addr: %s\n", pc, mem_addr);
-        struct cvt_entry entry = {pc, mem_addr};
-        cv_table.push_back(entry);
+bool LVPU::constant_location(Addr pc, Addr &mem_addr, unsigned &size) {
+    cvt_entry *entry = cv_table.findEntry(pc, is_secure);
+    if (!entry) {
+        return false;
+    }
+    mem_addr = entry->mem_addr;
+    size = entry->size;
+    return true;
+}
+
+void LVPU::add_cvt_entry(Addr pc, Addr mem_addr, unsigned size) {
+    // Stores demote constants through the CVT whenever the LVPU trains
+    if (!train) {
+        return;
+    }
+    // Loads are indexed by the load PC and record the memory address
+    cvt_entry *entry = cv_table.findEntry(pc, is_secure);
+    if (!entry) {
+        // The replacement policy invalidates the victim, so remember the
+        // byte ranges of the set to drop the victim from the address index
+        std::vector<std::pair<cvt_entry *, std::pair<Addr, unsigned>>>
+            ranges;
+        for (cvt_entry *way : cv_table.getPossibleEntries(pc)) {
+            if (way->isValid()) {
+                ranges.push_back({way, {way->mem_addr, way->size}});
+            }
+        }
+        entry = cv_table.findVictim(pc);
+        for (const auto &range : ranges) {
+            if (range.first == entry) {
+                stats.cvt_replacements++;
+                unindex_cvt_entry(entry, range.second.first,
+                    range.second.second);
+            }
+        }
+        cv_table.insertEntry(pc, is_secure, entry);
     } else {
-        DPRINTF(LVPU, "CVT full.  Not adding entry. pc: %s, mem_addr: %s\n", pc, mem_addr);
+        cv_table.accessEntry(entry);
+        unindex_cvt_entry(entry, entry->mem_addr, entry->size);
     }
+    DPRINTF(LVPU, "Adding entry to CVT. pc: %s, mem_addr: %s, size: %s\n",
+        pc, mem_addr, size);
+    entry->mem_addr = mem_addr;
+    entry->size = std::max(size, 1u);
+    index_cvt_entry(entry);
     return;
 }
 
-std::vector<Addr> LVPU::update_store_addr(Addr mem_addr) {
+void LVPU::index_cvt_entry(cvt_entry *entry) {
+    const Addr end = entry->mem_addr + entry->size;
+    for (Addr block = roundDown(entry->mem_addr, cvt_block_size);
+         block < end; block += cvt_block_size) {
+        cvt_addr_index[block].push_back(entry);
+    }
+}
+
+void LVPU::unindex_cvt_entry(cvt_entry *entry, Addr mem_addr, unsigned size) {
+    const Addr end = mem_addr + size;
+    for (Addr block = roundDown(mem_addr, cvt_block_size);
+         block < end; block += cvt_block_size) {
+        auto it = cvt_addr_index.find(block);
+        if (it == cvt_addr_index.end()) {
+            continue;
+        }
+        std::vector<cvt_entry *> &bucket = it->second;
+        auto found = std::find(bucket.begin(), bucket.end(), entry);
+        if (found != bucket.end()) {
+            *found = bucket.back();
+            bucket.pop_back();
+        }
+        if (bucket.empty()) {
+            cvt_addr_index.erase(it);
+        }
+    }
+}
+
+void LVPU::invalidate_constants() {
+    for (cvt_entry &entry : cv_table) {
+        if (entry.isValid()) {
+            Addr pc = entry.getTag();
+            DPRINTF(LVPU, "invalidate_constants: downgrading entry: %s\n", pc);
+            decrement_counter(pc);
+            cv_table.invalidate(&entry);
+        }
+    }
+    cvt_addr_index.clear();
+}
+
+void LVPU::add_warming_cpu(const SimObject *cpu) {
+    if (!warmed_by(cpu)) {
+        warming_cpus.push_back(cpu);
+    }
+}
+
+bool LVPU::warmed_by(const SimObject *cpu) const {
+    return std::find(warming_cpus.begin(), warming_cpus.end(), cpu) !=
+        warming_cpus.end();
+}
+
+void LVPU::warm_load(const StaticInstPtr &si, const PCStateBase &pc_state,
+    ThreadContext &thread, Addr mem_addr, unsigned size) {
+    if (value_slots(si) == 0) {
+        return;
+    }
+
+    Addr pc = load_key(pc_state);
+    add_entry(pc);
+
+    // Functional accesses complete at once, so the lookup is made just
+    // before training
+    std::vector<value_prediction::ValuePredictor::Prediction> predictions;
+    std::vector<RegVal> predicted_values;
+    predict_values(pc, value_slots(si), predictions, predicted_values);
+
+    std::vector<RegVal> values;
+    bool representable = read_dests(si, thread, values);
+    PredictionResults results = prediction_results(pc, predictions, values,
+        representable);
+    if (results.entry_upgraded) {
+        add_cvt_entry(pc, mem_addr, size);
+    }
+}
+
+LVPU::TableState LVPU::save_tables() const {
+    TableState state;
+    for (const lvpt_entry &entry : lvpt_table) {
+        if (entry.isValid()) {
+            state.lvpt_pcs.push_back(entry.getTag());
+            state.lvpt_value_valid.push_back(entry.value_valid);
+            state.lvpt_num_values.push_back(entry.values.size());
+            state.lvpt_values.insert(state.lvpt_values.end(),
+                entry.values.begin(), entry.values.end());
+        }
+    }
+    for (const lct_entry &entry : lc_table) {
+        if (entry.isValid()) {
+            state.lct_pcs.push_back(entry.getTag());
+            state.lct_counters.push_back(entry.classification);
+        }
+    }
+    for (const cvt_entry &entry : cv_table) {
+        if (entry.isValid()) {
+            state.cvt_pcs.push_back(entry.getTag());
+            state.cvt_mem_addrs.push_back(entry.mem_addr);
+            state.cvt_sizes.push_back(entry.size);
+        }
+    }
+    return state;
+}
+
+void LVPU::restore_tables(const TableState &state) {
+    for (lvpt_entry &entry : lvpt_table) {
+        lvpt_table.invalidate(&entry);
+    }
+    for (lct_entry &entry : lc_table) {
+        lc_table.invalidate(&entry);
+    }
+    for (cvt_entry &entry : cv_table) {
+        cv_table.invalidate(&entry);
+    }
+    cvt_addr_index.clear();
+
+    // Each table gets back only its own entries, without counting them as
+    // insertions or replacements.  A smaller table keeps the entries the
+    // replacement policy chooses
+    auto value = state.lvpt_values.begin();
+    for (size_t i = 0; i < state.lvpt_pcs.size(); i++) {
+        lvpt_entry *entry =
+            restore_entry(lvpt_table, state.lvpt_pcs[i], is_secure);
+        entry->value_valid = state.lvpt_value_valid[i];
+        entry->values.assign(value, value + state.lvpt_num_values[i]);
+        value += state.lvpt_num_values[i];
+    }
+    for (size_t i = 0; i < state.lct_pcs.size(); i++) {
+        lct_entry *entry =
+            restore_entry(lc_table, state.lct_pcs[i], is_secure);
+        entry->classification.reset();
+        entry->classification += state.lct_counters[i];
+    }
+    if (train) {
+        for (size_t i = 0; i < state.cvt_pcs.size(); i++) {
+            cvt_entry *entry =
+                restore_entry(cv_table, state.cvt_pcs[i], is_secure);
+            entry->mem_addr = state.cvt_mem_addrs[i];
+            entry->size = std::max(state.cvt_sizes[i], 1u);
+        }
+        // Index the entries which survived, once they are all in
+        for (cvt_entry &entry : cv_table) {
+            if (entry.isValid()) {
+                index_cvt_entry(&entry);
+            }
+        }
+    }
+    DPRINTF(LVPU, "restore_tables: lvpt: %d, lct: %d, cvt: %d entries\n",
+        state.lvpt_pcs.size(), state.lct_pcs.size(), state.cvt_pcs.size());
+}
+
+void LVPU::serialize(CheckpointOut &cp) const {
+    TableState state = save_tables();
+    arrayParamOut(cp, "lvpt_pcs", state.lvpt_pcs);
+    arrayParamOut(cp, "lvpt_value_valid", state.lvpt_value_valid);
+    arrayParamOut(cp, "lvpt_num_values", state.lvpt_num_values);
+    arrayParamOut(cp, "lvpt_values", state.lvpt_values);
+    arrayParamOut(cp, "lct_pcs", state.lct_pcs);
+    arrayParamOut(cp, "lct_counters", state.lct_counters);
+    arrayParamOut(cp, "cvt_pcs", state.cvt_pcs);
+    arrayParamOut(cp, "cvt_mem_addrs", state.cvt_mem_addrs);
+    arrayParamOut(cp, "cvt_sizes", state.cvt_sizes);
+}
+
+void LVPU::unserialize(CheckpointIn &cp) {
+    // Checkpoints taken by other CPUs have no LVPU, the tables stay cold
+    if (!cp.entryExists(Serializable::currentSection(), "lvpt_pcs")) {
+        return;
+    }
+
+    TableState state;
+    arrayParamIn(cp, "lvpt_pcs", state.lvpt_pcs);
+    arrayParamIn(cp, "lvpt_value_valid", state.lvpt_value_valid);
+    arrayParamIn(cp, "lvpt_num_values", state.lvpt_num_values);
+    arrayParamIn(cp, "lvpt_values", state.lvpt_values);
+    arrayParamIn(cp, "lct_pcs", state.lct_pcs);
+    arrayParamIn(cp, "lct_counters", state.lct_counters);
+    arrayParamIn(cp, "cvt_pcs", state.cvt_pcs);
+    arrayParamIn(cp, "cvt_mem_addrs", state.cvt_mem_addrs);
+    arrayParamIn(cp, "cvt_sizes", state.cvt_sizes);
+
+    size_t num_values = 0;
+    for (unsigned entry_values : state.lvpt_num_values) {
+        num_values += entry_values;
+    }
+    fatal_if(state.lvpt_value_valid.size() != state.lvpt_pcs.size() ||
+        state.lvpt_num_values.size() != state.lvpt_pcs.size() ||
+        state.lvpt_values.size() != num_values ||
+        state.lct_counters.size() != state.lct_pcs.size() ||
+        state.cvt_mem_addrs.size() != state.cvt_pcs.size() ||
+        state.cvt_sizes.size() != state.cvt_pcs.size(),
+        "%s: inconsistent LVPU table sizes in checkpoint\n", name());
+
+    restore_tables(state);
+}
+
+void LVPU::takeOverFrom(const LVPU &old) {
+    restore_tables(old.save_tables());
+    // CPUs can share a value predictor, which then needs no hand over
+    if (old.value_pred != value_pred) {
+        value_pred->takeOverFrom(*old.value_pred);
+    }
+}
+
+std::vector<Addr> LVPU::update_store_addr(Addr mem_addr, unsigned size) {
     std::vector<Addr> entries_removed;
-    for (int i = cv_table.size()-1; i >= 0; i--) {
-        if (cv_table[i].mem_addr == mem_addr) {
-            DPRINTF(LVPU, "update_store_addr.  matching entry found for mem_addr: %s, downgrading entry: %s, num cvt entries: %s\n", mem_addr, cv_table[i].pc, cv_table.size());
-            entries_removed.push_back(cv_table[i].pc);
-            decrement_counter(cv_table[i].pc);
-            cv_table.erase(cv_table.begin() + i);
+    if (!train) {
+        return entries_removed;
+    }
+    const Addr end = mem_addr + std::max(size, 1u);
+    for (Addr block = roundDown(mem_addr, cvt_block_size);
+         block < end; block += cvt_block_size) {
+        auto it = cvt_addr_index.find(block);
+        if (it == cvt_addr_index.end()) {
+            continue;
+        }
+        // Collect overlapping entries first as removing them edits the bucket
+        std::vector<cvt_entry *> matches;
+        for (cvt_entry *entry : it->second) {
+            if (entry->mem_addr < end &&
+                mem_addr < entry->mem_addr + entry->size) {
+                matches.push_back(entry);
+            }
+        }
+        for (cvt_entry *entry : matches) {
+            Addr pc = entry->getTag();
+            DPRINTF(LVPU, "update_store_addr.  overlapping entry found for mem_addr: %s, size: %s, downgrading entry: %s\n", mem_addr, size, pc);
+            entries_removed.push_back(pc);
+            decrement_counter(pc);
+            unindex_cvt_entry(entry, entry->mem_addr, entry->size);
+            cv_table.invalidate(entry);
+            stats.cvt_store_invalidations++;
         }
     }
     return entries_removed;
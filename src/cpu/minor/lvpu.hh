@@ -1,16 +1,25 @@
 #ifndef __LOAD_VALUE_PREDICTOR_UNIT_HH__
 #define __LOAD_VALUE_PREDICTOR_UNIT_HH__
 
+#include <unordered_map>
 #include <vector>
 
+#include "arch/generic/isa.hh"
 #include "base/named.hh"
+#include "base/sat_counter.hh"
 #include "base/types.hh"
 #include "cpu/minor/buffers.hh"
 #include "cpu/minor/cpu.hh"
 #include "cpu/minor/pipe_data.hh"
 #include "cpu/pred/bpred_unit.hh"
-#include "params/BaseMinorCPU.hh"
+#include "cpu/pred/value_pred.hh"
+#include "cpu/static_inst_fwd.hh"
+#include "enums/LVPUPolicy.hh"
+#include "mem/cache/prefetch/associative_set.hh"
+#include "mem/cache/tags/indexing_policies/set_associative.hh"
+#include "params/LVPUHashedSetAssociative.hh"
 #include "cpu/reg_class.hh"
+#include "sim/serialize.hh"
 
 namespace gem5
 {
@@ -19,7 +28,31 @@ GEM5_DEPRECATED_NAMESPACE(Minor, minor);
 namespace minor
 {
 
-class LVPU : public Named 
+/**
+ * Set associative indexing for the LVPU tables.  Load PCs are instruction
+ * aligned, so the low bits are dropped and the upper bits folded in before
+ * selecting a set.  The full PC is kept as the tag so entries never alias.
+ */
+class LVPUHashedSetAssociative : public SetAssociative
+{
+  protected:
+    uint32_t extractSet(const Addr addr) const override;
+    Addr extractTag(const Addr addr) const override;
+
+  public:
+    LVPUHashedSetAssociative(const LVPUHashedSetAssociativeParams &p)
+      : SetAssociative(p)
+    {
+    }
+    ~LVPUHashedSetAssociative() = default;
+};
+
+/**
+ * The LVPU tables are checkpointed and handed over on CPU switches in a
+ * form independent of the table geometry, so a warmed LVPU can be
+ * restored into a differently sized one.  Replacement state isn't kept
+ */
+class LVPU : public Named, public Serializable
 {
   public:
     enum Classification
@@ -29,47 +62,128 @@ class LVPU : public Named
       Constant
     };
 
+    /**
+     * Table geometry and policy of an LVPU.  Fields are named after the
+     * BaseMinorCPU parameters they come from, so the config can be made
+     * from the params of any SimObject declaring them (see
+     * LVPTraceReplayer)
+     */
+    struct Config
+    {
+      uint64_t num_lvpt_entries;
+      int lvpt_assoc;
+      BaseIndexingPolicy *lvpt_indexing_policy;
+      replacement_policy::Base *lvpt_replacement_policy;
+
+      uint64_t num_lct_entries;
+      int lct_assoc;
+      BaseIndexingPolicy *lct_indexing_policy;
+      replacement_policy::Base *lct_replacement_policy;
+      int lct_bits_per_entry;
+
+      uint64_t num_cvt_entries;
+      int cvt_assoc;
+      BaseIndexingPolicy *cvt_indexing_policy;
+      replacement_policy::Base *cvt_replacement_policy;
+      unsigned cvt_block_size;
+
+      unsigned lvpt_max_vec_bytes;
+      value_prediction::ValuePredictor *valuePred;
+      LVPUPolicy lvpu_policy;
+
+      template <class Params>
+      static Config
+      from_params(const Params &params)
+      {
+          return Config{
+              params.num_lvpt_entries, params.lvpt_assoc,
+              params.lvpt_indexing_policy, params.lvpt_replacement_policy,
+              params.num_lct_entries, params.lct_assoc,
+              params.lct_indexing_policy, params.lct_replacement_policy,
+              params.lct_bits_per_entry,
+              params.num_cvt_entries, params.cvt_assoc,
+              params.cvt_indexing_policy, params.cvt_replacement_policy,
+              params.cvt_block_size,
+              params.lvpt_max_vec_bytes, params.valuePred,
+              params.lvpu_policy};
+      }
+    };
+
+    /** A load or store seen by the LVPU, in commit order.  Reported to the
+     *  MinorCPU's LVPUMemRefs probe point, e.g. for LVPTraceRecorder */
+    struct MemRefRecord
+    {
+      bool is_load;
+      // Load key (see load_key).  Unused for stores
+      Addr pc;
+      Addr mem_addr;
+      unsigned size;
+      // Values returned to the load's predicted destinations, see
+      // read_dests.  nullptr for stores
+      const std::vector<RegVal> *values;
+      bool representable;
+      // The load writes back its base register, so is never bypassed
+      bool has_base_update_dests;
+    };
+
     struct LVPUStats : public statistics::Group
     {
-      LVPUStats(MinorCPU *cpu);
+      LVPUStats(statistics::Group *parent);
       /** Stats */
       statistics::Scalar num_predictions;
       statistics::Scalar correct_predictions;
       statistics::Scalar incorrect_predictions;
       statistics::Scalar memory_bypasses;
+      statistics::Scalar lvpt_replacements;
+      statistics::Scalar lct_replacements;
+      statistics::Scalar cvt_replacements;
+      statistics::Scalar cvt_store_invalidations;
+      statistics::Scalar selective_replays;
+      statistics::Scalar replay_flush_fallbacks;
+      statistics::Scalar replayed_insts;
+      statistics::Scalar squashable_insts;
     } stats;
 
     struct PredictionResults {
-      bool misprediction;
+      bool misprediction;  // The value predictor's prediction did not match
       bool entry_upgraded;
     };
 
   protected:
-    struct lvpt_entry {
-      Addr pc;
-      bool valid; // 0 when the entry is added.  Change to 1 when the value is returned from memory
-      RegVal value;
+    /** LVPT entry, tagged by load PC */
+    struct lvpt_entry : public TaggedEntry {
+      lvpt_entry() : TaggedEntry() { invalidate(); }
+      void invalidate() override;
+
+      // false when the entry is added.  Set when the value is returned from memory
+      bool value_valid;
+      // Last values returned, one per value slot of the predicted
+      // destinations.  Used for constant memory bypasses
+      std::vector<RegVal> values;
     };
 
-    struct lct_entry {
-      Addr pc;
-      int classification;  // n bit saturating counter used to classify table entries
+    /** LCT entry, tagged by load PC */
+    struct lct_entry : public TaggedEntry {
+      lct_entry(const SatCounter8 &init_classification)
+        : TaggedEntry(), classification(init_classification)
+      {
+          invalidate();
+      }
+      void invalidate() override;
+
+      // n bit saturating counter used to classify table entries
+      SatCounter8 classification;
     };
 
-    struct cvt_entry {
-      Addr pc;
+    /** CVT entry, tagged by load PC */
+    struct cvt_entry : public TaggedEntry {
+      cvt_entry() : TaggedEntry() { invalidate(); }
+      void invalidate() override;
+
       Addr mem_addr;
+      unsigned size; // Number of bytes read by the load
     };
 
-    /** Load value prediction table */
-    std::vector<lvpt_entry> lvpt_table;
-
-    /** Load classification table */
-    std::vector<lct_entry> lc_table;
-
-    /** Constant verification table */
-    std::vector<cvt_entry> cv_table;
-
     /** Parameters for LCT */
     int num_lct_entries;
     int bits_per_entry;  // Number of bits for saturating counter used for load classification
@@ -79,43 +193,173 @@ class LVPU : public Named
 
     /** Parameters for CVT */
     int num_cvt_entries;
+    Addr cvt_block_size;  // Granularity of the CVT store address index
 
-    std::string hacks;
+    /** Bytes of a vector destination held in the LVPT, the rest of the
+     *  register is predicted to be zero */
+    unsigned max_vec_bytes;
+
+    /** Register classes of the ISA, for the size of vector destinations */
+    const BaseISA::RegClasses reg_classes;
+
+    /**
+     * Features enabled by the lvpu_policy parameter.  Fixed at construction
+     * so the per-load paths test a flag rather than the policy itself
+     */
+    const bool train;    // LVPT/LCT are allocated and trained
+    const bool predict;  // Predictable loads write their predicted value
+    const bool bypass;   // Constant loads skip memory
+
+    /** Load value prediction table */
+    AssociativeSet<lvpt_entry> lvpt_table;
+
+    /** Load classification table */
+    AssociativeSet<lct_entry> lc_table;
+
+    /** Constant verification table */
+    AssociativeSet<cvt_entry> cv_table;
+
+    /** Supplies the predicted values of predictable loads */
+    value_prediction::ValuePredictor *value_pred;
+
+    /**
+     * Reverse index of the CVT from block aligned memory address to the
+     * entries whose loaded bytes fall in that block.  A load that spans
+     * blocks is indexed in each of them
+     */
+    std::unordered_map<Addr, std::vector<cvt_entry *>> cvt_addr_index;
+
+    /** CPUs whose stores are reported to the LVPU by an LVPUWarmer */
+    std::vector<const SimObject *> warming_cpus;
+
+    /** LVPU tables are not split into secure/non-secure partitions */
+    static constexpr bool is_secure = false;
+
+    /** Valid entries of the LVPU tables, one element per entry */
+    struct TableState
+    {
+      std::vector<Addr> lvpt_pcs;
+      std::vector<bool> lvpt_value_valid;
+      std::vector<unsigned> lvpt_num_values;
+      std::vector<RegVal> lvpt_values;  // Values of all entries, in order
+
+      std::vector<Addr> lct_pcs;
+      std::vector<unsigned> lct_counters;
+
+      std::vector<Addr> cvt_pcs;
+      std::vector<Addr> cvt_mem_addrs;
+      std::vector<unsigned> cvt_sizes;
+    };
 
   public:
+    /** Statistics are registered under stats_parent.  reg_classes are
+     *  only used to size vector destinations, see value_slots */
     LVPU(std::string name_,
-      MinorCPU &cpu_,
-      int num_lvpt_entries_,
-      int num_lct_entries_,
-      int num_cvt_entries_,
-      int bits_per_entry_,
-      std::string hacks_);
-
+      statistics::Group *stats_parent,
+      const BaseISA::RegClasses &reg_classes_,
+      const Config &config);
+
+    /** Policy queries for callers to skip LVPU work altogether */
+    bool enabled() const { return train; }
+    bool predicts() const { return predict; }
+    bool bypasses() const { return bypass; }
+
+    /** Bytes of a vector destination the LVPT holds, see value_slots */
+    unsigned vec_bytes() const { return max_vec_bytes; }
+
+    /** Checkpointing of the table contents.  The value predictor is a
+     *  SimObject and checkpoints itself */
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+
+    // Take over the tables and value predictor state of the LVPU of a
+    // switched out CPU
+    void takeOverFrom(const LVPU &old);
+
+    // Drop every CVT entry and downgrade its load as a store to it would.
+    // For when stores were executed without the LVPU seeing them
+    void invalidate_constants();
+
+    /** Functional warming while another CPU runs, see LVPUWarmer */
+    // Record that the stores of cpu are reported to the LVPU, so its
+    // constants stay valid when taking over from cpu
+    void add_warming_cpu(const SimObject *cpu);
+    bool warmed_by(const SimObject *cpu) const;
+
+    // Train the tables with a load executed by another CPU, allocating it
+    // as Fetch2 would.  values are read from the load's destinations in
+    // thread
+    void warm_load(const StaticInstPtr &si, const PCStateBase &pc_state,
+        ThreadContext &thread, Addr mem_addr, unsigned size);
+
+    /** Destination values */
+    // Key of a load in the LVPU tables.  Micro-op loads of a macro-op
+    // share its instruction address, so the micro PC is mixed in
+    static Addr load_key(const PCStateBase &pc);
+
+    // Whether destination dest_index of si is the base register a load
+    // with writeback updates itself (IsBaseUpdate), rather than in a
+    // separate micro-op.  Such destinations are computed rather than
+    // loaded, so they are never predicted and stay in the scoreboard until
+    // the load completes.  Other destinations that are also sources, as of
+    // ldr x0, [x0, #8], are loaded
+    static bool is_base_update_dest(const StaticInstPtr &si, unsigned dest_index);
+    static bool has_base_update_dests(const StaticInstPtr &si);
+
+    // Number of RegVal sized value slots of the predicted destinations of
+    // si.  0 if si has a destination the LVPU can't predict, or none to
+    // predict
+    unsigned value_slots(const StaticInstPtr &si) const;
+
+    // Read the values of the predicted destinations of si.  Returns false
+    // if a vector destination has non-zero bytes the LVPT can't hold
+    bool read_dests(const StaticInstPtr &si, ThreadContext &thread,
+        std::vector<RegVal> &values) const;
+
+    // Write values to the predicted destinations of si
+    void write_dests(const StaticInstPtr &si, ThreadContext &thread,
+        const std::vector<RegVal> &values) const;
 
     /**  LVPT functions */
-    // Looks for entry with matching pc in LVPT table.  Returns index of the entry or -1 if not found
-    int find_entry(Addr pc);
+    // Looks for entry with matching pc in LVPT table.  Returns the entry or nullptr if not found
+    lvpt_entry *find_entry(Addr pc);
 
-    // Adds entry to LVPT table. Valid bit is set to false.  
+    // Adds entry to LVPT table, replacing an entry of the indexed set if
+    // needed. Value valid bit is set to false.
     void add_entry(Addr pc);
 
-    // Updates LVPT entry value.  Sets valid bit to true.
-    void update_entry(Addr pc, RegVal value);
+    // Updates LVPT entry values.  Sets valid bit to true.
+    void update_entry(Addr pc, const std::vector<RegVal> &values);
 
     // Checks if entry exists and is valid
     bool valid_entry(Addr pc);
 
-    // Get the value of the given entry if it exists
-    RegVal read_entry(Addr pc);
-
-    // Increase saturating counter by one if entry.value matches value.  Decrease counter otherwise
-    // Update entry with new value
-    // Records results of prediction in stats
-    // Return true on correct prediction
-    PredictionResults prediction_results(Addr pc, RegVal value);
+    // Get the last values returned by the given entry.  Returns false if
+    // there is no valid entry
+    bool read_entry(Addr pc, std::vector<RegVal> &values);
+
+    // Look up the value predictor for each of the num_slots value slots
+    // of a load with an LVPT entry when it issues.  The predictions are
+    // kept for prediction_results.  Returns true, with the predicted
+    // values, if every slot has a prediction
+    bool predict_values(Addr pc, unsigned num_slots,
+        std::vector<value_prediction::ValuePredictor::Prediction>
+            &predictions,
+        std::vector<RegVal> &values);
+
+    // Train the value predictor with the values returned from memory and
+    // the predictions made when the load issued, if it was looked up.
+    // Increase saturating counter by one if the predictions matched every
+    // value.  Decrease counter if any slot mismatched or the values
+    // weren't representable (see read_dests)
+    // Update entry with new values
+    PredictionResults prediction_results(Addr pc,
+        const std::vector<value_prediction::ValuePredictor::Prediction>
+            &predictions,
+        const std::vector<RegVal> &values, bool representable);
 
     /** LCT functions */
-    int find_lct_entry(Addr pc);
+    lct_entry *find_lct_entry(Addr pc);
 
     // Decreases saturating counter by one
     void decrement_counter(Addr pc);
@@ -123,11 +367,11 @@ class LVPU : public Named
     // Increases saturating counter by one
     void increment_counter(Addr pc);
 
-    // Add a new entry if the number of entries is less than num_entries.  Entries start at Unpredictable
-    //TODO: Need to come up with logic to replace entries when the table is full.  Replace Unpredictable?
+    // Add a new entry, replacing an entry of the indexed set chosen by the
+    // replacement policy if needed.  Entries start at Unpredictable
     void add_lct_entry(Addr pc);
 
-    // Returns true if entry is valid and is classified as 'Predictable' or 'Constant'
+    // Returns true if entry exists and is classified as 'Predictable' or 'Constant'
     bool is_predictable(Addr pc);
 
     // Returns true if the given pc has a valid LVPT entry, classified as 'Constant' in LCT, and has an entry in CVT
@@ -136,15 +380,32 @@ class LVPU : public Named
     Classification get_classification(Addr pc);
 
     /** CVT functions */
-    void add_cvt_entry(Addr pc, Addr mem_addr);
+    // Adds or updates the CVT entry of pc for a load of size bytes at mem_addr
+    void add_cvt_entry(Addr pc, Addr mem_addr, unsigned size);
 
     // Returns true if memory address and mem_addr matches an entry in CVT
     bool verify_constant(Addr pc, Addr mem_addr);
 
-    // Checks for entries with address.
+    // Get the bytes a constant load was verified for.  Returns false if pc
+    // has no CVT entry
+    bool constant_location(Addr pc, Addr &mem_addr, unsigned &size);
+
+    // Checks for entries whose loaded bytes overlap the size bytes stored at address.
     // If any entries are found, remove them and downgrade LCT entry to 'predictable'
     // Returns list of PCs of entries that were removed
-    std::vector<Addr> update_store_addr(Addr address);
+    std::vector<Addr> update_store_addr(Addr address, unsigned size);
+
+  protected:
+    /** Copy out / replace the contents of the tables */
+    TableState save_tables() const;
+    void restore_tables(const TableState &state);
+
+    /** Key of a value slot in the value predictor */
+    static Addr slot_key(Addr pc, unsigned slot);
+
+    /** Add entry to / remove entry from cvt_addr_index for its byte range */
+    void index_cvt_entry(cvt_entry *entry);
+    void unindex_cvt_entry(cvt_entry *entry, Addr mem_addr, unsigned size);
 };
 
 } // namespace minor
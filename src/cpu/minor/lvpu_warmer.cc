@@ -0,0 +1,46 @@
+#include "cpu/minor/lvpu_warmer.hh"
+
+#include "cpu/minor/lvpu.hh"
+
+namespace gem5
+{
+
+GEM5_DEPRECATED_NAMESPACE(Minor, minor);
+namespace minor
+{
+
+LVPUWarmer::LVPUWarmer(const LVPUWarmerParams &params)
+    : ProbeListenerObject(params),
+      lvpu(params.cpu->getLVPU())
+{
+    // Stores are reported too, so the LVPU can keep its constants when
+    // taking over from the probed CPU
+    lvpu.add_warming_cpu(params.manager);
+}
+
+void
+LVPUWarmer::regProbeListeners()
+{
+    typedef ProbeListenerArg<LVPUWarmer, BaseCPU::RetiredMemRef>
+        RetiredMemRefListener;
+    listeners.push_back(new RetiredMemRefListener(this, "RetiredMemRefs",
+                                                  &LVPUWarmer::warm));
+}
+
+void
+LVPUWarmer::warm(const BaseCPU::RetiredMemRef &mem_ref)
+{
+    if (!lvpu.enabled() || mem_ref.size == 0)
+        return;
+
+    const StaticInstPtr &inst = mem_ref.inst;
+    if (inst->isStore() || inst->isAtomic()) {
+        lvpu.update_store_addr(mem_ref.addr, mem_ref.size);
+    } else if (inst->isLoad()) {
+        lvpu.warm_load(inst, *mem_ref.pc, *mem_ref.tc, mem_ref.addr,
+            mem_ref.size);
+    }
+}
+
+} // namespace minor
+} // namespace gem5
@@ -0,0 +1,43 @@
+/**
+ * @file
+ * Functional warming of a Minor CPU's LVPU while a simple CPU runs, e.g.
+ * during an atomic fast forward.  The warmer listens to the simple CPU's
+ * RetiredMemRefs probe point and trains the switched out Minor CPU's LVPU
+ * tables and value predictor directly, so they are warm when the Minor
+ * CPU takes over.
+ */
+
+#ifndef __CPU_MINOR_LVPU_WARMER_HH__
+#define __CPU_MINOR_LVPU_WARMER_HH__
+
+#include "cpu/minor/cpu.hh"
+#include "params/LVPUWarmer.hh"
+#include "sim/probe/probe.hh"
+
+namespace gem5
+{
+
+GEM5_DEPRECATED_NAMESPACE(Minor, minor);
+namespace minor
+{
+
+class LVPUWarmer : public ProbeListenerObject
+{
+  public:
+    LVPUWarmer(const LVPUWarmerParams &params);
+
+    void regProbeListeners() override;
+
+    /** Train the LVPU with a retired load, or invalidate the constants a
+     *  retired store overwrites */
+    void warm(const BaseCPU::RetiredMemRef &mem_ref);
+
+  protected:
+    /** LVPU of the Minor CPU being warmed */
+    LVPU &lvpu;
+};
+
+} // namespace minor
+} // namespace gem5
+
+#endif // __CPU_MINOR_LVPU_WARMER_HH__
@@ -59,7 +59,9 @@ Pipeline::Pipeline(MinorCPU &cpu_, const BaseMinorCPUParams &params) :
     Ticked(cpu_, &(cpu_.BaseCPU::baseStats.numCycles)),
     cpu(cpu_),
     allow_idling(params.enableIdling),
-    lvpu(cpu.name() + ".lvpu", cpu, params.num_lvpt_entries, params.num_lct_entries, params.num_cvt_entries, params.lct_bits_per_entry, params.lvpu_hacks),
+    lvpu(cpu.name() + ".lvpu", &cpu,
+        cpu.threads[0]->getIsaPtr()->regClasses(),
+        LVPU::Config::from_params(params)),
     f1ToF2(cpu.name() + ".f1ToF2", "lines",
         params.fetch1ToFetch2ForwardDelay),
     f2ToF1(cpu.name() + ".f2ToF1", "prediction",
@@ -87,6 +89,7 @@ Pipeline::Pipeline(MinorCPU &cpu_, const BaseMinorCPUParams &params) :
         std::max(params.fetch2ToDecodeForwardDelay,
         std::max(params.decodeToExecuteForwardDelay,
         params.executeBranchDelay)))),
+    wakeEvent([this]{ wakeup(); }, cpu.name() + ".pipeline.wakeEvent"),
     needToSignalDrained(false)
 {
     if (params.fetch1ToFetch2ForwardDelay < 1) {
@@ -110,6 +113,49 @@ Pipeline::Pipeline(MinorCPU &cpu_, const BaseMinorCPUParams &params) :
     }
 }
 
+Cycles
+Pipeline::nextWakeCycle() const
+{
+    return std::min(std::min(fetch1.nextWakeCycle(), fetch2.nextWakeCycle()),
+        std::min(decode.nextWakeCycle(), execute.nextWakeCycle()));
+}
+
+bool
+Pipeline::isQuiescent() const
+{
+    for (int stage_id = 0; stage_id < Num_StageId; stage_id++) {
+        if (activityRecorder.getStageActive(stage_id))
+            return false;
+    }
+
+    return f1ToF2.empty() && f2ToF1.empty() && f2ToD.empty() &&
+        dToE.empty() && eToF1.empty();
+}
+
+void
+Pipeline::scheduleWakeup(Cycles wake_cycle)
+{
+    DPRINTF(Quiesce, "Scheduling wakeup for cycle %d\n", wake_cycle);
+
+    /* Starting the pipeline schedules its next evaluate a cycle on */
+    cpu.reschedule(wakeEvent,
+        cpu.clockEdge(Cycles(wake_cycle - cpu.curCycle() - 1)), true);
+}
+
+void
+Pipeline::wakeup()
+{
+    if (!running)
+        cpu.stats.timedWakeups++;
+    cpu.wakeupOnEvent(CPUStageId);
+}
+
+void
+Pipeline::regProbePoints()
+{
+    execute.regProbePoints();
+}
+
 void
 Pipeline::minorTrace() const
 {
@@ -154,10 +200,25 @@ Pipeline::evaluate()
     activityRecorder.evaluate();
 
     if (allow_idling) {
-        /* Become idle if we can but are not draining */
-        if (!activityRecorder.active() && !needToSignalDrained) {
+        /* Become idle if we can but are not draining.  A stage may still
+         *  want to be evaluated in a later cycle, e.g. Execute waiting for
+         *  a stalled inst to be allowed to commit, so the pipeline is
+         *  woken then if no event wakes it first */
+        Cycles wake_cycle = nextWakeCycle();
+        bool quiescent = wake_cycle > cpu.curCycle() + Cycles(1) &&
+            isQuiescent();
+
+        if ((!activityRecorder.active() || quiescent) &&
+            !needToSignalDrained)
+        {
             DPRINTF(Quiesce, "Suspending as the processor is idle\n");
+            if (activityRecorder.active())
+                cpu.stats.quiescentIdles++;
             stop();
+            if (wake_cycle != NoWakeCycle)
+                scheduleWakeup(wake_cycle);
+            else if (wakeEvent.scheduled())
+                cpu.deschedule(wakeEvent);
         }
 
         /* Deactivate all stages.  Note that the stages *could*
@@ -179,6 +240,8 @@ Pipeline::evaluate()
             cpu.signalDrainDone();
             needToSignalDrained = false;
             stop();
+            if (wakeEvent.scheduled())
+                cpu.deschedule(wakeEvent);
         }
     }
 }
@@ -214,6 +277,9 @@ Pipeline::drain()
     bool drained = isDrained();
     needToSignalDrained = !drained;
 
+    if (drained && wakeEvent.scheduled())
+        cpu.deschedule(wakeEvent);
+
     return drained;
 }
 
@@ -95,6 +95,22 @@ class Pipeline : public Ticked
      *  cleanest place to initialise it */
     MinorActivityRecorder activityRecorder;
 
+    /** Restarts the pipeline, when idle, in the cycle a stage asked to be
+     *  woken in (see nextWakeCycle) */
+    EventFunctionWrapper wakeEvent;
+
+    /** Earliest nextWakeCycle of the stages */
+    Cycles nextWakeCycle() const;
+
+    /** No stage is active and no latch holds data, so the activity
+     *  recorder's window of recent activity has nothing left to move */
+    bool isQuiescent() const;
+
+    /** Schedule wakeEvent so the pipeline is next evaluated in
+     *  wake_cycle */
+    void scheduleWakeup(Cycles wake_cycle);
+    void wakeup();
+
   public:
     LVPU lvpu;
     
@@ -133,6 +149,9 @@ class Pipeline : public Ticked
 
     void minorTrace() const;
 
+    /** Register the probe points of the pipeline stages */
+    void regProbePoints();
+
     /** Functions below here are BaseCPU operations passed on to pipeline
      *  stages */
 
@@ -0,0 +1,88 @@
+#include "cpu/minor/pool.hh"
+
+#include <new>
+
+namespace gem5
+{
+
+GEM5_DEPRECATED_NAMESPACE(Minor, minor);
+namespace minor
+{
+
+BlockPool::BlockPool(statistics::Group *parent, const char *name) :
+    statistics::Group(parent, name),
+    ADD_STAT(allocations, statistics::units::Count::get(),
+             "Number of objects allocated from the pool"),
+    ADD_STAT(reuses, statistics::units::Count::get(),
+             "Number of allocations that reused a freed block"),
+    ADD_STAT(reuseRate, statistics::units::Ratio::get(),
+             "Fraction of allocations that reused a freed block",
+             reuses / allocations)
+{
+    reuseRate.precision(6);
+}
+
+BlockPool::~BlockPool()
+{
+    for (auto &free_list : freeLists) {
+        for (BlockHeader *header : free_list.second)
+            ::operator delete(header);
+    }
+}
+
+std::vector<BlockPool::BlockHeader *> &
+BlockPool::freeList(size_t size)
+{
+    for (auto &free_list : freeLists) {
+        if (free_list.first == size)
+            return free_list.second;
+    }
+    freeLists.emplace_back(size, std::vector<BlockHeader *>());
+    return freeLists.back().second;
+}
+
+void *
+BlockPool::allocate(size_t size)
+{
+    allocations++;
+
+    std::vector<BlockHeader *> &free_list = freeList(size);
+    BlockHeader *header;
+    if (!free_list.empty()) {
+        header = free_list.back();
+        free_list.pop_back();
+        reuses++;
+    } else {
+        header = static_cast<BlockHeader *>(
+            ::operator new(sizeof(BlockHeader) + size));
+        header->pool = this;
+        header->size = size;
+    }
+    return header + 1;
+}
+
+void *
+BlockPool::allocateUnpooled(size_t size)
+{
+    BlockHeader *header = static_cast<BlockHeader *>(
+        ::operator new(sizeof(BlockHeader) + size));
+    header->pool = nullptr;
+    header->size = size;
+    return header + 1;
+}
+
+void
+BlockPool::release(void *ptr)
+{
+    if (!ptr)
+        return;
+
+    BlockHeader *header = static_cast<BlockHeader *>(ptr) - 1;
+    if (header->pool)
+        header->pool->freeList(header->size).push_back(header);
+    else
+        ::operator delete(header);
+}
+
+} // namespace minor
+} // namespace gem5
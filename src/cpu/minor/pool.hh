@@ -0,0 +1,98 @@
+/**
+ * @file
+ *
+ *  Free list allocation for the objects Minor creates per instruction and
+ *  per memory access.  Each MinorCPU has a BlockPool for its dynamic
+ *  instructions and one for its LSQ requests.  Freed blocks are kept on
+ *  the pool's free lists and reused rather than returned to the heap.
+ */
+
+#ifndef __CPU_MINOR_POOL_HH__
+#define __CPU_MINOR_POOL_HH__
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "base/statistics.hh"
+
+namespace gem5
+{
+
+GEM5_DEPRECATED_NAMESPACE(Minor, minor);
+namespace minor
+{
+
+/** Pool of heap blocks, with a free list per block size.  Blocks carry a
+ *  header naming their pool so they can be released without it */
+class BlockPool : public statistics::Group
+{
+  protected:
+    /** Placed in front of each block */
+    struct alignas(std::max_align_t) BlockHeader
+    {
+        /** nullptr for blocks allocated without a pool */
+        BlockPool *pool;
+        size_t size;
+    };
+
+    /** Free blocks (pointing at their headers) of each block size.  There
+     *  are only a handful of sizes, so they are searched linearly */
+    std::vector<std::pair<size_t, std::vector<BlockHeader *>>> freeLists;
+
+    std::vector<BlockHeader *> &freeList(size_t size);
+
+  public:
+    BlockPool(statistics::Group *parent, const char *name);
+
+    /** Free the blocks on the free lists.  Blocks still in use must not
+     *  be released after this */
+    ~BlockPool();
+
+    /** Allocate size bytes, reusing a free block if there is one */
+    void *allocate(size_t size);
+
+    /** Allocate size bytes from the heap, for objects created without a
+     *  pool such as the bubble instruction */
+    static void *allocateUnpooled(size_t size);
+
+    /** Return a block to its pool, or to the heap if it has none */
+    static void release(void *ptr);
+
+    /** Stats */
+    statistics::Scalar allocations;
+    statistics::Scalar reuses;
+    statistics::Formula reuseRate;
+};
+
+/** Base for classes whose instances are allocated from a BlockPool with
+ *  new (pool) T(...).  A plain new T(...) allocates outside any pool */
+class PoolAllocated
+{
+  public:
+    static void *
+    operator new(size_t size, BlockPool &pool)
+    {
+        return pool.allocate(size);
+    }
+
+    static void *
+    operator new(size_t size)
+    {
+        return BlockPool::allocateUnpooled(size);
+    }
+
+    static void operator delete(void *ptr) { BlockPool::release(ptr); }
+
+    /** Called if a constructor throws after new (pool) */
+    static void
+    operator delete(void *ptr, BlockPool &pool)
+    {
+        BlockPool::release(ptr);
+    }
+};
+
+} // namespace minor
+} // namespace gem5
+
+#endif /* __CPU_MINOR_POOL_HH__ */
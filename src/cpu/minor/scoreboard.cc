@@ -37,6 +37,8 @@
 
 #include "cpu/minor/scoreboard.hh"
 
+#include <algorithm>
+
 #include "cpu/reg_class.hh"
 #include "debug/MinorScoreboard.hh"
 #include "debug/MinorTiming.hh"
@@ -49,6 +51,22 @@ GEM5_DEPRECATED_NAMESPACE(Minor, minor);
 namespace minor
 {
 
+namespace
+{
+
+/** Add the loads in from to into, skipping those already there */
+void
+mergePredictedLoads(std::vector<InstSeqNum> &into,
+    const std::vector<InstSeqNum> &from)
+{
+    for (InstSeqNum load : from) {
+        if (std::find(into.begin(), into.end(), load) == into.end())
+            into.push_back(load);
+    }
+}
+
+} // anonymous namespace
+
 bool
 Scoreboard::findIndex(const RegId& reg, Index &scoreboard_index)
 {
@@ -107,6 +125,25 @@ Scoreboard::markupInstDests(MinorDynInstPtr inst, Cycles retire_time,
     StaticInstPtr staticInst = inst->staticInst;
     unsigned int num_dests = staticInst->numDestRegs();
 
+    /* Inherit the predicted loads any source was computed from */
+    if (trackPredictedValues) {
+        std::vector<InstSeqNum> &predicted_loads =
+            inst->predictedLoadDependences;
+        unsigned int num_srcs = staticInst->numSrcRegs();
+
+        predicted_loads.clear();
+        for (unsigned int src_index = 0; src_index < num_srcs;
+            src_index++)
+        {
+            RegId reg = flattenRegIndex(staticInst->srcRegIdx(src_index),
+                thread_context);
+            Index index;
+
+            if (findIndex(reg, index))
+                mergePredictedLoads(predicted_loads, predictedLoads[index]);
+        }
+    }
+
     /** Mark each destination register */
     for (unsigned int dest_index = 0; dest_index < num_dests;
         dest_index++)
@@ -127,7 +164,11 @@ Scoreboard::markupInstDests(MinorDynInstPtr inst, Cycles retire_time,
              *  execSeqNums, but sanity check */
             if (inst->id.execSeqNum > writingInst[index]) {
                 writingInst[index] = inst->id.execSeqNum;
+                writingLoadPC[index] = (staticInst->isLoad() ?
+                    inst->pc->instAddr() : MaxAddr);
                 fuIndices[index] = inst->fuIndex;
+                if (trackPredictedValues)
+                    setPredictedLoads(index, inst->predictedLoadDependences);
             }
 
             DPRINTF(MinorScoreboard, "Marking up inst: %s"
@@ -179,28 +220,96 @@ Scoreboard::clearInstDests(MinorDynInstPtr inst, bool clear_unpredictable)
     unsigned int num_dests = staticInst->numDestRegs();
 
     /** Mark each destination register */
+    for (unsigned int dest_index = 0; dest_index < num_dests;
+        dest_index++)
+    {
+        clearInstDest(inst, dest_index, clear_unpredictable);
+    }
+}
+
+void
+Scoreboard::clearInstDest(MinorDynInstPtr inst, unsigned int dest_index,
+    bool clear_unpredictable)
+{
+    const RegId& reg = inst->flatDestRegIdx[dest_index];
+    Index index;
+
+    if (findIndex(reg, index)) {
+        if (clear_unpredictable && numUnpredictableResults[index] != 0)
+            numUnpredictableResults[index] --;
+
+        numResults[index] --;
+
+        if (numResults[index] == 0) {
+            returnCycle[index] = Cycles(0);
+            writingInst[index] = 0;
+            writingLoadPC[index] = MaxAddr;
+            fuIndices[index] = invalidFUIndex;
+        }
+
+        DPRINTF(MinorScoreboard, "Clearing inst: %s"
+            " regIndex: %d final numResults: %d\n",
+            *inst, index, numResults[index]);
+    }
+}
+
+void
+Scoreboard::markupPredictedDests(MinorDynInstPtr inst)
+{
+    if (!trackPredictedValues || inst->isFault())
+        return;
+
+    unsigned int num_dests = inst->staticInst->numDestRegs();
+
     for (unsigned int dest_index = 0; dest_index < num_dests;
         dest_index++)
     {
         const RegId& reg = inst->flatDestRegIdx[dest_index];
         Index index;
 
-        if (findIndex(reg, index)) {
-            if (clear_unpredictable && numUnpredictableResults[index] != 0)
-                numUnpredictableResults[index] --;
+        if (findIndex(reg, index) && numResults[index] == 0) {
+            /* A load whose address came from older predicted loads
+             *  keeps their tags too */
+            std::vector<InstSeqNum> loads = inst->predictedLoadDependences;
+            loads.push_back(inst->id.execSeqNum);
+            setPredictedLoads(index, loads);
 
-            numResults[index] --;
+            DPRINTF(MinorScoreboard, "Marking predicted value of inst: %s"
+                " regIndex: %d\n", *inst, index);
+        }
+    }
+}
 
-            if (numResults[index] == 0) {
-                returnCycle[index] = Cycles(0);
-                writingInst[index] = 0;
-                fuIndices[index] = invalidFUIndex;
-            }
+void
+Scoreboard::clearPredictedDests(MinorDynInstPtr inst)
+{
+    if (!trackPredictedValues)
+        return;
 
-            DPRINTF(MinorScoreboard, "Clearing inst: %s"
-                " regIndex: %d final numResults: %d\n",
-                *inst, index, numResults[index]);
-        }
+    /* Consumers' destinations carry the tag too, and are recorded with
+     *  the load's own */
+    auto found = predictedLoadRegs.find(inst->id.execSeqNum);
+    if (found == predictedLoadRegs.end())
+        return;
+
+    for (Index index : found->second) {
+        std::vector<InstSeqNum> &loads = predictedLoads[index];
+        loads.erase(std::remove(loads.begin(), loads.end(),
+            inst->id.execSeqNum), loads.end());
+    }
+    predictedLoadRegs.erase(found);
+}
+
+void
+Scoreboard::setPredictedLoads(Index index,
+    const std::vector<InstSeqNum> &loads)
+{
+    predictedLoads[index] = loads;
+
+    for (InstSeqNum load : loads) {
+        std::vector<Index> &regs = predictedLoadRegs[load];
+        if (std::find(regs.begin(), regs.end(), index) == regs.end())
+            regs.push_back(index);
     }
 }
 
@@ -208,8 +317,11 @@ bool
 Scoreboard::canInstIssue(MinorDynInstPtr inst,
     const std::vector<Cycles> *src_reg_relative_latencies,
     const std::vector<bool> *cant_forward_from_fu_indices,
-    Cycles now, ThreadContext *thread_context)
+    Cycles now, ThreadContext *thread_context, Addr *blocking_load_pc)
 {
+    if (blocking_load_pc)
+        *blocking_load_pc = MaxAddr;
+
     /* Always allow fault to be issued */
     if (inst->isFault())
         return true;
@@ -259,6 +371,8 @@ Scoreboard::canInstIssue(MinorDynInstPtr inst,
                 numUnpredictableResults[index] != 0)
             {
                 ret = false;
+                if (blocking_load_pc)
+                    *blocking_load_pc = writingLoadPC[index];
                 DPRINTF(MinorExecute,
                     "Cannot issue inst.  Waiting on reg: %s \n",
                     reg);
@@ -44,6 +44,7 @@
 #ifndef __CPU_MINOR_SCOREBOARD_HH__
 #define __CPU_MINOR_SCOREBOARD_HH__
 
+#include <unordered_map>
 #include <vector>
 
 #include "base/named.hh"
@@ -106,9 +107,33 @@ class Scoreboard : public Named
      *  register value */
     std::vector<InstSeqNum> writingInst;
 
+    /** The PC of writingInst if it is a load, otherwise MaxAddr.  Used
+     *  to attribute dependence stalls to the loads causing them */
+    std::vector<Addr> writingLoadPC;
+
+    /** Maintain predictedLoad so the consumers of a mispredicted load
+     *  value can be found for selective replay */
+    bool trackPredictedValues;
+
+    /** The execSeqNums of the unverified value predicted loads from
+     *  which each register's value was (transitively) computed.  All of
+     *  them are kept, so every in-flight consumer of a load being
+     *  verified is tagged with it, whichever of its loads verify first */
+    std::vector<std::vector<InstSeqNum>> predictedLoads;
+
+    /** The registers each load in predictedLoads has tagged, so only
+     *  those are cleared once it is verified.  Registers since written
+     *  by insts not depending on the load may still be listed */
+    std::unordered_map<InstSeqNum, std::vector<Index>> predictedLoadRegs;
+
+    /** Set the predictedLoads of a register and record it against each
+     *  of those loads */
+    void setPredictedLoads(Index index, const std::vector<InstSeqNum> &loads);
+
   public:
     Scoreboard(const std::string &name,
-            const BaseISA::RegClasses& reg_classes) :
+            const BaseISA::RegClasses& reg_classes,
+            bool track_predicted_values = false) :
         Named(name),
         regClasses(reg_classes),
         intRegOffset(0),
@@ -122,7 +147,10 @@ class Scoreboard : public Named
         numUnpredictableResults(numRegs, 0),
         fuIndices(numRegs, invalidFUIndex),
         returnCycle(numRegs, Cycles(0)),
-        writingInst(numRegs, 0)
+        writingInst(numRegs, 0),
+        writingLoadPC(numRegs, MaxAddr),
+        trackPredictedValues(track_predicted_values),
+        predictedLoads(numRegs)
     { }
 
   public:
@@ -142,6 +170,20 @@ class Scoreboard : public Named
      *  must match mark_unpredictable for the same inst. */
     void clearInstDests(MinorDynInstPtr inst, bool clear_unpredictable);
 
+    /** Clear down a single destination of this instruction, for insts
+     *  whose destinations become available at different times */
+    void clearInstDest(MinorDynInstPtr inst, unsigned int dest_index,
+        bool clear_unpredictable);
+
+    /** Tag the destinations of a value predicted load, after they have
+     *  been cleared, as holding its unverified value.  Destinations with
+     *  a younger in-flight writer are left alone */
+    void markupPredictedDests(MinorDynInstPtr inst);
+
+    /** Remove the tags of a value predicted load once its value has
+     *  been verified or the load has been discarded */
+    void clearPredictedDests(MinorDynInstPtr inst);
+
     /** Returns the exec sequence number of the most recent inst on
      *  which the given inst depends.  Useful for determining which
      *  inst must actually be committed before a dependent inst
@@ -150,11 +192,14 @@ class Scoreboard : public Named
         ThreadContext *thread_context);
 
     /** Can this instruction be issued.  Are any of its source registers
-     *  due to be written by other marked-up instructions in flight */
+     *  due to be written by other marked-up instructions in flight.  If
+     *  blocking_load_pc is given, it is set to the writingLoadPC of the
+     *  register that prevents issue, or MaxAddr if there isn't one */
     bool canInstIssue(MinorDynInstPtr inst,
         const std::vector<Cycles> *src_reg_relative_latencies,
         const std::vector<bool> *cant_forward_from_fu_indices,
-        Cycles now, ThreadContext *thread_context);
+        Cycles now, ThreadContext *thread_context,
+        Addr *blocking_load_pc = nullptr);
 
     /** MinorTraceIF interface */
     void minorTrace() const;
@@ -58,6 +58,12 @@ MinorStats::MinorStats(BaseCPU *base_cpu)
     ADD_STAT(quiesceCycles, statistics::units::Cycle::get(),
              "Total number of cycles that CPU has spent quiesced or waiting "
              "for an interrupt"),
+    ADD_STAT(quiescentIdles, statistics::units::Count::get(),
+             "Number of times the pipeline idled with nothing left in "
+             "flight between stages before the activity window emptied"),
+    ADD_STAT(timedWakeups, statistics::units::Count::get(),
+             "Number of times the idle pipeline was woken in the cycle a "
+             "stalled stage asked for"),
     ADD_STAT(cpi, statistics::units::Rate<
                 statistics::units::Cycle, statistics::units::Count>::get(),
              "CPI: cycles per instruction"),
@@ -75,6 +75,12 @@ struct MinorStats : public statistics::Group
     /** Number of cycles in quiescent state */
     statistics::Scalar quiesceCycles;
 
+    /** Number of times the pipeline idled before the activity recorder's
+     *  window emptied, and number of idle periods ended by a timed wakeup
+     *  a stage asked for rather than by an event */
+    statistics::Scalar quiescentIdles;
+    statistics::Scalar timedWakeups;
+
     /** CPI/IPC for total cycle counts and macro insts */
     statistics::Formula cpi;
     statistics::Formula ipc;
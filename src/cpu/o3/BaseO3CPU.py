@@ -44,6 +44,7 @@ from m5.objects.BaseCPU import BaseCPU
 from m5.objects.FUPool import *
 #from m5.objects.O3Checker import O3Checker
 from m5.objects.BranchPredictor import *
+from m5.objects.ValuePredictor import *
 
 class SMTFetchPolicy(ScopedEnum):
     vals = [ 'RoundRobin', 'Branch', 'IQCount', 'LSQCount' ]
@@ -170,3 +171,10 @@ class BaseO3CPU(BaseCPU):
                                                        Parent.numThreads),
                                        "Branch Predictor")
     needsTSO = Param.Bool(False, "Enable TSO Memory model")
+
+    valuePred = Param.ValuePredictor(NULL, "Load value predictor, load "
+                                     "value prediction is disabled if unset")
+    lvpConfidenceTableSize = Param.Unsigned(1024,
+        "Number of load value prediction confidence counters")
+    lvpConfidenceBits = Param.Unsigned(1, "Bits per load value prediction "
+        "confidence counter, loads are predicted from half the maximum")
@@ -1304,6 +1304,16 @@ Commit::commitHead(const DynInstPtr &head_inst, unsigned inst_num)
                                  head_inst->renamedDestIdx(i));
     }
 
+    // Train the load value predictor with the committed value
+    if (head_inst->isLoad())
+        iewStage->valuePredUnit.train(head_inst);
+
+    // Report the access now the committed registers hold its results
+    if (head_inst->isMemRef() && head_inst->effAddrValid()) {
+        cpu->probeRetiredMemRef(head_inst->tcBase(), head_inst->staticInst,
+            head_inst->pcState(), head_inst->effAddr, head_inst->effSize);
+    }
+
     // hardware transactional memory
     // the HTM UID is purely for correctness and debugging purposes
     if (head_inst->isHtmStart())
@@ -60,6 +60,7 @@
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/o3/lsq_unit.hh"
 #include "cpu/op_class.hh"
+#include "cpu/pred/value_pred.hh"
 #include "cpu/reg_class.hh"
 #include "cpu/static_inst.hh"
 #include "cpu/translation.hh"
@@ -187,6 +188,7 @@ class DynInst : public ExecContext, public RefCounted
         ReqMade,
         MemOpDone,
         HtmFromTransaction,
+        ValuePredicted,
         MaxFlags
     };
 
@@ -323,6 +325,9 @@ class DynInst : public ExecContext, public RefCounted
     /** Predicted PC state after this instruction. */
     std::unique_ptr<PCStateBase> predPC;
 
+    /** The load value predictor's lookup for this load at rename. */
+    value_prediction::ValuePredictor::Prediction valuePred;
+
     /** The Macroop if one exists */
     const StaticInstPtr macroop;
 
@@ -524,6 +529,29 @@ class DynInst : public ExecContext, public RefCounted
         instFlags[PredTaken] = predicted_taken;
     }
 
+    /** Returns whether the load value predictor wrote this load's
+     *  destination register at rename. */
+    bool valuePredicted() const { return instFlags[ValuePredicted]; }
+
+    void setValuePredicted() { instFlags[ValuePredicted] = true; }
+
+    RegVal predictedValue() const { return valuePred.value; }
+
+    /** The load value predictor's lookup for this load at rename, which
+     *  the predictor is trained with. */
+    const value_prediction::ValuePredictor::Prediction &
+    valuePrediction() const
+    {
+        return valuePred;
+    }
+
+    void
+    setValuePrediction(
+        const value_prediction::ValuePredictor::Prediction &prediction)
+    {
+        valuePred = prediction;
+    }
+
     /** Returns whether the instruction mispredicted. */
     bool
     mispredicted()
@@ -70,6 +70,7 @@ IEW::IEW(CPU *_cpu, const BaseO3CPUParams &params)
       cpu(_cpu),
       instQueue(_cpu, this, params),
       ldstQueue(_cpu, this, params),
+      valuePredUnit(_cpu, params),
       fuPool(params.fuPool),
       commitToIEWDelay(params.commitToIEWDelay),
       renameToIEWDelay(params.renameToIEWDelay),
@@ -500,6 +501,30 @@ IEW::squashDueToMemOrder(const DynInstPtr& inst, ThreadID tid)
     }
 }
 
+void
+IEW::squashDueToValuePred(const DynInstPtr& inst, ThreadID tid)
+{
+    DPRINTF(IEW, "[tid:%i] [sn:%llu] Load value misprediction, squashing "
+            "younger insts, PC: %s\n", tid, inst->seqNum, inst->pcState());
+
+    if (!toCommit->squash[tid] ||
+            inst->seqNum < toCommit->squashedSeqNum[tid]) {
+        toCommit->squash[tid] = true;
+        toCommit->squashedSeqNum[tid] = inst->seqNum;
+        toCommit->branchTaken[tid] = false;
+
+        // The load itself has its correct value now, so restart fetch
+        // after it
+        set(toCommit->pc[tid], inst->pcState());
+        inst->staticInst->advancePC(*toCommit->pc[tid]);
+
+        toCommit->mispredictInst[tid] = NULL;
+        toCommit->includeSquashInst[tid] = false;
+
+        wroteToTimeBuffer = true;
+    }
+}
+
 void
 IEW::block(ThreadID tid)
 {
@@ -1620,5 +1645,21 @@ IEW::checkMisprediction(const DynInstPtr& inst)
     }
 }
 
+void
+IEW::checkValuePrediction(const DynInstPtr& inst)
+{
+    ThreadID tid = inst->threadNumber;
+
+    if (!valuePredUnit.verify(inst))
+        return;
+
+    if (!fetchRedirect[tid] ||
+        !toCommit->squash[tid] ||
+        toCommit->squashedSeqNum[tid] > inst->seqNum) {
+        fetchRedirect[tid] = true;
+        squashDueToValuePred(inst, tid);
+    }
+}
+
 } // namespace o3
 } // namespace gem5
@@ -51,6 +51,7 @@
 #include "cpu/o3/limits.hh"
 #include "cpu/o3/lsq.hh"
 #include "cpu/o3/scoreboard.hh"
+#include "cpu/o3/value_pred_unit.hh"
 #include "cpu/timebuf.hh"
 #include "debug/IEW.hh"
 #include "sim/probe/probe.hh"
@@ -226,6 +227,10 @@ class IEW
     /** Check misprediction  */
     void checkMisprediction(const DynInstPtr &inst);
 
+    /** Verify a load's predicted value once its destination register
+     *  holds the value from memory, squashing younger insts if wrong */
+    void checkValuePrediction(const DynInstPtr &inst);
+
     // hardware transactional memory
     // For debugging purposes, it is useful to keep track of the most recent
     // htmUid that has been committed (architecturally, not transactionally)
@@ -247,6 +252,11 @@ class IEW
      */
     void squashDueToMemOrder(const DynInstPtr &inst, ThreadID tid);
 
+    /** Sends commit proper information for a squash due to a load value
+     * misprediction.
+     */
+    void squashDueToValuePred(const DynInstPtr &inst, ThreadID tid);
+
     /** Sets Dispatch to blocked, and signals back to other stages to block. */
     void block(ThreadID tid);
 
@@ -357,6 +367,9 @@ class IEW
     /** Load / store queue. */
     LSQ ldstQueue;
 
+    /** Load value prediction unit. */
+    ValuePredUnit valuePredUnit;
+
     /** Pointer to the functional unit pool. */
     FUPool *fuPool;
     /** Records if the LSQ needs to be updated on the next cycle, so that
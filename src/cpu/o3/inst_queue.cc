@@ -65,7 +65,7 @@ namespace o3
 
 InstructionQueue::FUCompletion::FUCompletion(const DynInstPtr &_inst,
     int fu_idx, InstructionQueue *iq_ptr)
-    : Event(Stat_Event_Pri, AutoDelete),
+    : PooledEvent(Stat_Event_Pri, AutoDelete),
       inst(_inst), fuIdx(fu_idx), iqPtr(iq_ptr), freeFU(false)
 {
 }
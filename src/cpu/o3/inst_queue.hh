@@ -59,6 +59,7 @@
 #include "cpu/op_class.hh"
 #include "cpu/timebuf.hh"
 #include "enums/SMTQueuePolicy.hh"
+#include "sim/event_pool.hh"
 #include "sim/eventq.hh"
 
 namespace gem5
@@ -102,7 +103,7 @@ class InstructionQueue
     typedef typename std::list<DynInstPtr>::iterator ListIt;
 
     /** FU completion event class. */
-    class FUCompletion : public Event
+    class FUCompletion : public PooledEvent
     {
       private:
         /** Executing instruction. */
@@ -64,7 +64,7 @@ namespace o3
 
 LSQUnit::WritebackEvent::WritebackEvent(const DynInstPtr &_inst,
         PacketPtr _pkt, LSQUnit *lsq_ptr)
-    : Event(Default_Pri, AutoDelete),
+    : PooledEvent(Default_Pri, AutoDelete),
       inst(_inst), pkt(_pkt), lsqPtr(lsq_ptr)
 {
     assert(_inst->savedRequest);
@@ -606,6 +606,7 @@ LSQUnit::executeLoad(const DynInstPtr &inst)
         inst->completeAcc(nullptr);
         iewStage->instToCommit(inst);
         iewStage->activityThisCycle();
+        iewStage->checkValuePrediction(inst);
         return NoFault;
     }
 
@@ -630,8 +631,13 @@ LSQUnit::executeLoad(const DynInstPtr &inst)
         // realizes there is activity.  Mark it as executed unless it
         // is a strictly ordered load that needs to hit the head of
         // commit.
-        if (!inst->readPredicate())
+        if (!inst->readPredicate()) {
             inst->forwardOldRegs();
+            // The destination now holds its old value rather than the
+            // predicted one
+            if (load_fault == NoFault)
+                iewStage->checkValuePrediction(inst);
+        }
         DPRINTF(LSQUnit, "Load [sn:%lli] not executed from %s\n",
                 inst->seqNum,
                 (load_fault != NoFault ? "fault" : "predication"));
@@ -1083,12 +1089,15 @@ LSQUnit::writeback(const DynInstPtr &inst, PacketPtr pkt)
         return;
     }
 
+    bool completed_access = false;
+
     if (!inst->isExecuted()) {
         inst->setExecuted();
 
         if (inst->fault == NoFault) {
             // Complete access to copy data to proper place.
             inst->completeAcc(pkt);
+            completed_access = true;
         } else {
             // If the instruction has an outstanding fault, we cannot complete
             // the access as this discards the current fault.
@@ -1131,6 +1140,10 @@ LSQUnit::writeback(const DynInstPtr &inst, PacketPtr pkt)
 
     // see if this load changed the PC
     iewStage->checkMisprediction(inst);
+
+    // check any value predicted for the load now it has its data
+    if (completed_access && inst->isLoad())
+        iewStage->checkValuePrediction(inst);
 }
 
 void
@@ -63,6 +63,7 @@
 #include "debug/LSQUnit.hh"
 #include "mem/packet.hh"
 #include "mem/port.hh"
+#include "sim/event_pool.hh"
 
 namespace gem5
 {
@@ -409,7 +410,7 @@ class LSQUnit
     RequestPort *dcachePort;
 
     /** Writeback event, specifically for when stores forward data to loads. */
-    class WritebackEvent : public Event
+    class WritebackEvent : public PooledEvent
     {
       public:
         /** Constructs a writeback event. */
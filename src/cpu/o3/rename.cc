@@ -711,6 +711,12 @@ Rename::renameInsts(ThreadID tid)
 
         renameDestRegs(inst, inst->threadNumber);
 
+        // A load with a predicted value produces its result now, so
+        // younger consumers don't wait for memory
+        if (iew_ptr->valuePredUnit.predict(inst)) {
+            scoreboard->setReg(inst->renamedDestIdx(0));
+        }
+
         if (inst->isAtomic() || inst->isStore()) {
             storesInProgress[tid]++;
         } else if (inst->isLoad()) {
@@ -0,0 +1,141 @@
+#include "cpu/o3/value_pred_unit.hh"
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "cpu/o3/cpu.hh"
+#include "cpu/o3/dyn_inst.hh"
+#include "debug/ValuePredUnit.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+ValuePredUnit::ValuePredUnit(CPU *_cpu, const BaseO3CPUParams &params)
+    : cpu(_cpu),
+      valuePred(params.valuePred),
+      confidence(params.lvpConfidenceTableSize,
+                 SatCounter8(params.lvpConfidenceBits)),
+      confidenceMask(params.lvpConfidenceTableSize - 1),
+      confidenceThreshold(1 << (params.lvpConfidenceBits - 1)),
+      stats(_cpu)
+{
+    fatal_if(!isPowerOf2(params.lvpConfidenceTableSize),
+             "Load value prediction confidence table size must be a "
+             "power of 2\n");
+    fatal_if(params.lvpConfidenceBits < 1 || params.lvpConfidenceBits > 8,
+             "Load value prediction confidence counters must have 1 to 8 "
+             "bits\n");
+}
+
+std::string
+ValuePredUnit::name() const
+{
+    return cpu->name() + ".lvp";
+}
+
+bool
+ValuePredUnit::canPredict(const DynInstPtr &inst) const
+{
+    if (!inst->isLoad() || inst->isAtomic() || inst->numDestRegs() != 1)
+        return false;
+
+    const RegId &dest = inst->destRegIdx(0);
+    return (dest.is(IntRegClass) || dest.is(FloatRegClass)) &&
+        !inst->renamedDestIdx(0)->isFixedMapping();
+}
+
+unsigned
+ValuePredUnit::confidenceIndex(Addr pc) const
+{
+    return (pc >> 1) & confidenceMask;
+}
+
+bool
+ValuePredUnit::predict(const DynInstPtr &inst)
+{
+    if (!enabled() || !canPredict(inst))
+        return false;
+
+    // Every load is looked up, to be trained with the prediction it was
+    // renamed with, but only confident ones have their value written
+    Addr pc = inst->pcState().instAddr();
+    value_prediction::ValuePredictor::Prediction prediction;
+    bool predicted = valuePred->predict(pc, prediction);
+    inst->setValuePrediction(prediction);
+    if (!predicted || confidence[confidenceIndex(pc)] < confidenceThreshold)
+        return false;
+
+    RegVal value = prediction.value;
+    inst->setValuePredicted();
+    cpu->setReg(inst->renamedDestIdx(0), value);
+    ++stats.predicted;
+
+    DPRINTF(ValuePredUnit, "[sn:%llu] PC %s predicted value %#x written to "
+            "reg %i (%s)\n", inst->seqNum, inst->pcState(), value,
+            inst->renamedDestIdx(0)->index(),
+            inst->renamedDestIdx(0)->className());
+    return true;
+}
+
+bool
+ValuePredUnit::verify(const DynInstPtr &inst)
+{
+    if (!enabled() || !inst->valuePredicted() || inst->isSquashed())
+        return false;
+
+    RegVal value = cpu->getReg(inst->renamedDestIdx(0));
+    if (inst->predictedValue() == value) {
+        ++stats.correct;
+        return false;
+    }
+
+    DPRINTF(ValuePredUnit, "[sn:%llu] PC %s value mispredicted, predicted "
+            "%#x actual %#x\n", inst->seqNum, inst->pcState(),
+            inst->predictedValue(), value);
+    ++stats.incorrect;
+    return true;
+}
+
+void
+ValuePredUnit::train(const DynInstPtr &inst)
+{
+    if (!enabled() || !canPredict(inst) || !inst->readPredicate() ||
+        !inst->readMemAccPredicate()) {
+        return;
+    }
+
+    Addr pc = inst->pcState().instAddr();
+    RegVal value = cpu->getReg(inst->renamedDestIdx(0));
+
+    // Confidence follows the predictor's own accuracy, as the Minor
+    // LVPU's classification counters do
+    SatCounter8 &counter = confidence[confidenceIndex(pc)];
+    switch (valuePred->train(pc, value, inst->valuePrediction())) {
+      case value_prediction::ValuePredictor::Correct:
+        counter++;
+        break;
+      case value_prediction::ValuePredictor::Incorrect:
+        counter--;
+        break;
+      default:
+        break;
+    }
+}
+
+ValuePredUnit::ValuePredUnitStats::ValuePredUnitStats(CPU *cpu)
+    : statistics::Group(cpu, "lvp"),
+      ADD_STAT(predicted, statistics::units::Count::get(),
+               "Number of loads whose predicted value was written at "
+               "rename"),
+      ADD_STAT(correct, statistics::units::Count::get(),
+               "Number of predicted loads whose value was correct"),
+      ADD_STAT(incorrect, statistics::units::Count::get(),
+               "Number of predicted loads whose value was incorrect")
+{
+}
+
+} // namespace o3
+} // namespace gem5
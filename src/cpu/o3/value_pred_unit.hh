@@ -0,0 +1,103 @@
+/**
+ * @file
+ * Load value prediction for the O3 CPU.  Confident loads have their
+ * predicted value written to their destination physical register at
+ * rename so that consumers can issue without waiting for memory.  The
+ * value is verified when the load's data is written back and younger
+ * instructions are squashed on a misprediction.  The predictor is only
+ * trained by loads that commit.
+ */
+
+#ifndef __CPU_O3_VALUE_PRED_UNIT_HH__
+#define __CPU_O3_VALUE_PRED_UNIT_HH__
+
+#include <string>
+#include <vector>
+
+#include "base/sat_counter.hh"
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "cpu/o3/dyn_inst_ptr.hh"
+#include "cpu/pred/value_pred.hh"
+#include "params/BaseO3CPU.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+class CPU;
+
+class ValuePredUnit
+{
+  public:
+    ValuePredUnit(CPU *_cpu, const BaseO3CPUParams &params);
+
+    /** Returns the name of the value prediction unit. */
+    std::string name() const;
+
+    /** Load value prediction is enabled if a predictor is configured. */
+    bool enabled() const { return valuePred != nullptr; }
+
+    /**
+     * Look up the value of a renamed load, writing it to the load's
+     * destination physical register if the load's confidence counter
+     * allows it.  The lookup is kept with the load for verify.
+     * @return True if a value was written.
+     */
+    bool predict(const DynInstPtr &inst);
+
+    /**
+     * Check any value predicted for a load once its destination holds
+     * the value it wrote.
+     * @return True if the load's predicted value was wrong.
+     */
+    bool verify(const DynInstPtr &inst);
+
+    /**
+     * Train the predictor and confidence counters with the value a
+     * committed load wrote to its destination.  Loads that were squashed,
+     * or didn't access memory, never train them.
+     */
+    void train(const DynInstPtr &inst);
+
+  private:
+    /** Loads with a single integer or floating point destination */
+    bool canPredict(const DynInstPtr &inst) const;
+
+    /** Index of the confidence counter of a load PC */
+    unsigned confidenceIndex(Addr pc) const;
+
+    /** Pointer to the CPU. */
+    CPU *cpu;
+
+    /** Supplies the predicted values */
+    value_prediction::ValuePredictor *valuePred;
+
+    /** Confidence counters, indexed by load PC */
+    std::vector<SatCounter8> confidence;
+
+    /** Mask to get the confidence counter index bits */
+    const unsigned confidenceMask;
+
+    /** Smallest counter value for which loads are predicted */
+    const uint8_t confidenceThreshold;
+
+    struct ValuePredUnitStats : public statistics::Group
+    {
+        ValuePredUnitStats(CPU *cpu);
+
+        /** Loads whose predicted value was written at rename */
+        statistics::Scalar predicted;
+        /** Predicted loads whose value matched memory */
+        statistics::Scalar correct;
+        /** Predicted loads whose value didn't match, causing a squash */
+        statistics::Scalar incorrect;
+    } stats;
+};
+
+} // namespace o3
+} // namespace gem5
+
+#endif // __CPU_O3_VALUE_PRED_UNIT_HH__
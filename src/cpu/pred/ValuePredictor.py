@@ -0,0 +1,77 @@
+# Copyright (c) 2026 The gem5 Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.SimObject import SimObject
+from m5.params import *
+from m5.proxy import *
+
+class ValuePredictor(SimObject):
+    type = 'ValuePredictor'
+    cxx_class = 'gem5::value_prediction::ValuePredictor'
+    cxx_header = "cpu/pred/value_pred.hh"
+    abstract = True
+
+    instShiftAmt = Param.Unsigned(2, "Number of bits to shift instructions by")
+
+class LastValuePredictor(ValuePredictor):
+    type = 'LastValuePredictor'
+    cxx_class = 'gem5::value_prediction::LastValuePredictor'
+    cxx_header = "cpu/pred/last_value_pred.hh"
+
+    tableSize = Param.Unsigned(1024, "Number of entries in the value table")
+
+class StrideValuePredictor(ValuePredictor):
+    type = 'StrideValuePredictor'
+    cxx_class = 'gem5::value_prediction::StrideValuePredictor'
+    cxx_header = "cpu/pred/stride_value_pred.hh"
+
+    tableSize = Param.Unsigned(1024, "Number of entries in the stride table")
+
+class FCMValuePredictor(ValuePredictor):
+    type = 'FCMValuePredictor'
+    cxx_class = 'gem5::value_prediction::FCMValuePredictor'
+    cxx_header = "cpu/pred/fcm_value_pred.hh"
+
+    historyTableSize = Param.Unsigned(1024,
+        "Number of entries in the per-PC value history table")
+    valueTableSize = Param.Unsigned(4096,
+        "Number of entries in the shared value prediction table")
+    order = Param.Unsigned(4, "Number of previous values in a context")
+
+class VTAGEValuePredictor(ValuePredictor):
+    type = 'VTAGEValuePredictor'
+    cxx_class = 'gem5::value_prediction::VTAGEValuePredictor'
+    cxx_header = "cpu/pred/vtage_value_pred.hh"
+
+    baseTableSize = Param.Unsigned(1024, "Number of entries in the base table")
+    logTaggedTableSize = Param.Unsigned(8,
+        "Log2 of the number of entries in each tagged table")
+    tagBits = Param.Unsigned(12, "Number of tag bits of the tagged tables")
+    confBits = Param.Unsigned(3,
+        "Number of bits of the tagged table confidence counters")
+    histLengths = VectorParam.Unsigned([2, 4, 8, 16, 32, 64],
+        "Global history length in bits of each tagged table, 2 bits are"
+        " shifted in per load")
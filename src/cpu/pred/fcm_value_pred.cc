@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/fcm_value_pred.hh"
+
+#include <algorithm>
+
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "sim/serialize.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+FCMValuePredictor::FCMValuePredictor(const FCMValuePredictorParams &params)
+    : ValuePredictor(params),
+      historyTableSize(params.historyTableSize),
+      valueTableSize(params.valueTableSize),
+      order(params.order),
+      historyIndexMask(historyTableSize - 1),
+      valueIndexBits(floorLog2(valueTableSize)),
+      shiftPerValue(order ? divCeil(valueIndexBits, order) : 0),
+      historyTable(historyTableSize),
+      valueTable(valueTableSize)
+{
+    fatal_if(!isPowerOf2(historyTableSize),
+             "FCM history table size must be a power of 2\n");
+    fatal_if(!isPowerOf2(valueTableSize) || valueTableSize < 2,
+             "FCM value table size must be a power of 2 greater than 1\n");
+    fatal_if(order == 0, "FCM order must be at least 1\n");
+}
+
+unsigned
+FCMValuePredictor::getHistoryIndex(Addr pc) const
+{
+    return (pc >> instShiftAmt) & historyIndexMask;
+}
+
+uint64_t
+FCMValuePredictor::foldValue(RegVal value) const
+{
+    uint64_t folded = 0;
+    for (unsigned shift = 0; shift < 64; shift += valueIndexBits) {
+        folded ^= value >> shift;
+    }
+    return folded & mask(valueIndexBits);
+}
+
+bool
+FCMValuePredictor::lookup(Addr pc, RegVal &value)
+{
+    const HistoryEntry &history = historyTable[getHistoryIndex(pc)];
+    if (!history.valid || history.tag != pc || history.depth < order) {
+        return false;
+    }
+
+    const ValueEntry &entry = valueTable[history.context];
+    if (!entry.valid) {
+        return false;
+    }
+    value = entry.value;
+    return true;
+}
+
+void
+FCMValuePredictor::update(Addr pc, RegVal value, uint64_t)
+{
+    HistoryEntry &history = historyTable[getHistoryIndex(pc)];
+    if (!history.valid || history.tag != pc) {
+        history.valid = true;
+        history.tag = pc;
+        history.context = 0;
+        history.depth = 0;
+    }
+
+    // The value that followed a full context trains the second level
+    if (history.depth >= order) {
+        ValueEntry &entry = valueTable[history.context];
+        entry.valid = true;
+        entry.value = value;
+    }
+
+    // Shift the new value into the context, older values fall off the top
+    history.context = ((history.context << shiftPerValue) ^
+                       foldValue(value)) & mask(valueIndexBits);
+    if (history.depth < order) {
+        history.depth++;
+    }
+}
+
+void
+FCMValuePredictor::copyState(const ValuePredictor &old)
+{
+    const auto &other = static_cast<const FCMValuePredictor &>(old);
+    fatal_if(other.historyTableSize != historyTableSize ||
+             other.valueTableSize != valueTableSize || other.order != order,
+             "%s: can't take over the tables of %s, which has a different "
+             "geometry\n", name(), other.name());
+    historyTable = other.historyTable;
+    valueTable = other.valueTable;
+}
+
+void
+FCMValuePredictor::serialize(CheckpointOut &cp) const
+{
+    std::vector<bool> historyValid;
+    std::vector<Addr> historyTag;
+    std::vector<uint64_t> historyContext;
+    std::vector<unsigned> historyDepth;
+    for (const HistoryEntry &entry : historyTable) {
+        historyValid.push_back(entry.valid);
+        historyTag.push_back(entry.tag);
+        historyContext.push_back(entry.context);
+        historyDepth.push_back(entry.depth);
+    }
+    SERIALIZE_CONTAINER(historyValid);
+    SERIALIZE_CONTAINER(historyTag);
+    SERIALIZE_CONTAINER(historyContext);
+    SERIALIZE_CONTAINER(historyDepth);
+
+    std::vector<bool> valueValid;
+    std::vector<RegVal> value;
+    for (const ValueEntry &entry : valueTable) {
+        valueValid.push_back(entry.valid);
+        value.push_back(entry.value);
+    }
+    SERIALIZE_CONTAINER(valueValid);
+    SERIALIZE_CONTAINER(value);
+}
+
+void
+FCMValuePredictor::unserialize(CheckpointIn &cp)
+{
+    // Checkpoints taken without this predictor leave it cold
+    if (!cp.entryExists(Serializable::currentSection(), "historyValid"))
+        return;
+
+    std::vector<bool> historyValid;
+    std::vector<Addr> historyTag;
+    std::vector<uint64_t> historyContext;
+    std::vector<unsigned> historyDepth;
+    UNSERIALIZE_CONTAINER(historyValid);
+    UNSERIALIZE_CONTAINER(historyTag);
+    UNSERIALIZE_CONTAINER(historyContext);
+    UNSERIALIZE_CONTAINER(historyDepth);
+    fatal_if(historyValid.size() != historyTableSize ||
+             historyTag.size() != historyTableSize ||
+             historyContext.size() != historyTableSize ||
+             historyDepth.size() != historyTableSize,
+             "%s: checkpoint history table size doesn't match "
+             "historyTableSize (%d)\n", name(), historyTableSize);
+
+    std::vector<bool> valueValid;
+    std::vector<RegVal> value;
+    UNSERIALIZE_CONTAINER(valueValid);
+    UNSERIALIZE_CONTAINER(value);
+    fatal_if(valueValid.size() != valueTableSize ||
+             value.size() != valueTableSize,
+             "%s: checkpoint value table size doesn't match "
+             "valueTableSize (%d)\n", name(), valueTableSize);
+
+    for (unsigned i = 0; i < historyTableSize; i++) {
+        historyTable[i].valid = historyValid[i];
+        historyTable[i].tag = historyTag[i];
+        historyTable[i].context = historyContext[i] & mask(valueIndexBits);
+        historyTable[i].depth = std::min(historyDepth[i], order);
+    }
+    for (unsigned i = 0; i < valueTableSize; i++) {
+        valueTable[i].valid = valueValid[i];
+        valueTable[i].value = value[i];
+    }
+}
+
+} // namespace value_prediction
+} // namespace gem5
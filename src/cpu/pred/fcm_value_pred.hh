@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Two-level finite context method (FCM) value predictor.  The first level
+ * keeps, per load PC, a hash of the last order values the load returned.
+ * That hash indexes a shared second level table holding the value that
+ * followed the context the last time it was seen.
+ */
+
+#ifndef __CPU_PRED_FCM_VALUE_PRED_HH__
+#define __CPU_PRED_FCM_VALUE_PRED_HH__
+
+#include <vector>
+
+#include "base/types.hh"
+#include "cpu/pred/value_pred.hh"
+#include "params/FCMValuePredictor.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+class FCMValuePredictor : public ValuePredictor
+{
+  public:
+    FCMValuePredictor(const FCMValuePredictorParams &params);
+
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+
+  protected:
+    bool lookup(Addr pc, RegVal &value) override;
+    void update(Addr pc, RegVal value, uint64_t history) override;
+    void copyState(const ValuePredictor &old) override;
+
+    /** Value history table entry */
+    struct HistoryEntry
+    {
+        bool valid = false;
+        Addr tag = 0;
+        /** Hashed history of the last order values */
+        uint64_t context = 0;
+        /** Number of values folded into context, up to order */
+        unsigned depth = 0;
+    };
+
+    /** Value prediction table entry */
+    struct ValueEntry
+    {
+        bool valid = false;
+        RegVal value = 0;
+    };
+
+    /** Calculates the history table index based on the PC */
+    unsigned getHistoryIndex(Addr pc) const;
+
+    /** Fold a value down to the value table index width */
+    uint64_t foldValue(RegVal value) const;
+
+    /** Number of entries in the per-PC value history table */
+    const unsigned historyTableSize;
+
+    /** Number of entries in the shared value prediction table */
+    const unsigned valueTableSize;
+
+    /** Number of previous values that make up a context */
+    const unsigned order;
+
+    /** Mask to get history table index bits */
+    const unsigned historyIndexMask;
+
+    /** Number of bits of a value table index */
+    const unsigned valueIndexBits;
+
+    /** Bits each value in the context is shifted by */
+    const unsigned shiftPerValue;
+
+    std::vector<HistoryEntry> historyTable;
+    std::vector<ValueEntry> valueTable;
+};
+
+} // namespace value_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_FCM_VALUE_PRED_HH__
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/last_value_pred.hh"
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "sim/serialize.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+LastValuePredictor::LastValuePredictor(
+    const LastValuePredictorParams &params)
+    : ValuePredictor(params),
+      tableSize(params.tableSize),
+      indexMask(tableSize - 1),
+      table(tableSize)
+{
+    fatal_if(!isPowerOf2(tableSize),
+             "Last value predictor table size must be a power of 2\n");
+}
+
+unsigned
+LastValuePredictor::getIndex(Addr pc) const
+{
+    return (pc >> instShiftAmt) & indexMask;
+}
+
+bool
+LastValuePredictor::lookup(Addr pc, RegVal &value)
+{
+    const Entry &entry = table[getIndex(pc)];
+    if (entry.valid && entry.tag == pc) {
+        value = entry.value;
+        return true;
+    }
+    return false;
+}
+
+void
+LastValuePredictor::update(Addr pc, RegVal value, uint64_t)
+{
+    Entry &entry = table[getIndex(pc)];
+    entry.valid = true;
+    entry.tag = pc;
+    entry.value = value;
+}
+
+void
+LastValuePredictor::copyState(const ValuePredictor &old)
+{
+    const auto &other = static_cast<const LastValuePredictor &>(old);
+    fatal_if(other.tableSize != tableSize,
+             "%s: can't take over a table of %d entries from %s\n",
+             name(), other.tableSize, other.name());
+    table = other.table;
+}
+
+void
+LastValuePredictor::serialize(CheckpointOut &cp) const
+{
+    std::vector<bool> valid;
+    std::vector<Addr> tag;
+    std::vector<RegVal> value;
+    for (const Entry &entry : table) {
+        valid.push_back(entry.valid);
+        tag.push_back(entry.tag);
+        value.push_back(entry.value);
+    }
+    SERIALIZE_CONTAINER(valid);
+    SERIALIZE_CONTAINER(tag);
+    SERIALIZE_CONTAINER(value);
+}
+
+void
+LastValuePredictor::unserialize(CheckpointIn &cp)
+{
+    // Checkpoints taken without this predictor leave it cold
+    if (!cp.entryExists(Serializable::currentSection(), "valid"))
+        return;
+
+    std::vector<bool> valid;
+    std::vector<Addr> tag;
+    std::vector<RegVal> value;
+    UNSERIALIZE_CONTAINER(valid);
+    UNSERIALIZE_CONTAINER(tag);
+    UNSERIALIZE_CONTAINER(value);
+    fatal_if(valid.size() != tableSize || tag.size() != tableSize ||
+             value.size() != tableSize,
+             "%s: checkpoint table size doesn't match tableSize (%d)\n",
+             name(), tableSize);
+
+    for (unsigned i = 0; i < tableSize; i++) {
+        table[i].valid = valid[i];
+        table[i].tag = tag[i];
+        table[i].value = value[i];
+    }
+}
+
+} // namespace value_prediction
+} // namespace gem5
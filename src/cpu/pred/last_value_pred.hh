@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Last value predictor: predicts that a load returns the same value it
+ * returned the previous time it executed.
+ */
+
+#ifndef __CPU_PRED_LAST_VALUE_PRED_HH__
+#define __CPU_PRED_LAST_VALUE_PRED_HH__
+
+#include <vector>
+
+#include "base/types.hh"
+#include "cpu/pred/value_pred.hh"
+#include "params/LastValuePredictor.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+class LastValuePredictor : public ValuePredictor
+{
+  public:
+    LastValuePredictor(const LastValuePredictorParams &params);
+
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+
+  protected:
+    bool lookup(Addr pc, RegVal &value) override;
+    void update(Addr pc, RegVal value, uint64_t history) override;
+    void copyState(const ValuePredictor &old) override;
+
+    struct Entry
+    {
+        bool valid = false;
+        Addr tag = 0;
+        RegVal value = 0;
+    };
+
+    /** Calculates the table index based on the PC */
+    unsigned getIndex(Addr pc) const;
+
+    /** Number of entries in the table */
+    const unsigned tableSize;
+
+    /** Mask to get index bits */
+    const unsigned indexMask;
+
+    /** Direct mapped table tagged by the full PC */
+    std::vector<Entry> table;
+};
+
+} // namespace value_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_LAST_VALUE_PRED_HH__
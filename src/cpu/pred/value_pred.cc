@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/value_pred.hh"
+
+#include <typeinfo>
+
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/ValuePredictor.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+ValuePredictor::ValuePredictor(const Params &p)
+    : SimObject(p),
+      instShiftAmt(p.instShiftAmt),
+      stats(this)
+{
+}
+
+bool
+ValuePredictor::predict(Addr pc, Prediction &prediction)
+{
+    ++stats.lookups;
+    prediction.history = history();
+    prediction.valid = lookup(pc, prediction.value);
+    if (prediction.valid) {
+        ++stats.predicted;
+        DPRINTF(ValuePredictor, "Predicted pc: %#x value: %#x\n",
+                pc, prediction.value);
+        return true;
+    }
+    DPRINTF(ValuePredictor, "No prediction for pc: %#x\n", pc);
+    return false;
+}
+
+ValuePredictor::Outcome
+ValuePredictor::train(Addr pc, RegVal value, const Prediction &prediction)
+{
+    ++stats.updates;
+
+    Outcome outcome = NoPrediction;
+    if (prediction.valid) {
+        if (prediction.value == value) {
+            ++stats.correct;
+            outcome = Correct;
+        } else {
+            ++stats.incorrect;
+            outcome = Incorrect;
+        }
+    }
+
+    DPRINTF(ValuePredictor, "Training pc: %#x value: %#x outcome: %d\n",
+            pc, value, outcome);
+    update(pc, value, prediction.history);
+    return outcome;
+}
+
+void
+ValuePredictor::train(Addr pc, RegVal value)
+{
+    ++stats.updates;
+    DPRINTF(ValuePredictor, "Training unpredicted pc: %#x value: %#x\n",
+            pc, value);
+    update(pc, value, history());
+}
+
+void
+ValuePredictor::takeOverFrom(const ValuePredictor &old)
+{
+    fatal_if(typeid(old) != typeid(*this),
+             "%s: can't take over the state of %s, a different type of "
+             "value predictor\n", name(), old.name());
+    copyState(old);
+}
+
+ValuePredictor::ValuePredictorStats::ValuePredictorStats(
+    statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(lookups, statistics::units::Count::get(),
+               "Number of value predictor lookups"),
+      ADD_STAT(predicted, statistics::units::Count::get(),
+               "Number of lookups that returned a prediction"),
+      ADD_STAT(updates, statistics::units::Count::get(),
+               "Number of loads the predictor was trained with"),
+      ADD_STAT(correct, statistics::units::Count::get(),
+               "Number of trained loads that were predicted correctly"),
+      ADD_STAT(incorrect, statistics::units::Count::get(),
+               "Number of trained loads that were predicted incorrectly"),
+      ADD_STAT(coverage, statistics::units::Ratio::get(),
+               "Fraction of trained loads that had a prediction",
+               (correct + incorrect) / updates),
+      ADD_STAT(accuracy, statistics::units::Ratio::get(),
+               "Fraction of predictions that were correct",
+               correct / (correct + incorrect))
+{
+    coverage.precision(6);
+    accuracy.precision(6);
+}
+
+} // namespace value_prediction
+} // namespace gem5
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Base class for load value predictors.  A value predictor supplies the
+ * predicted value of a load when it issues and is trained with that
+ * prediction and the value the load actually returned.  Confidence
+ * estimation (e.g. the LVPU's LCT) is left to the user of the predictor.
+ */
+
+#ifndef __CPU_PRED_VALUE_PRED_HH__
+#define __CPU_PRED_VALUE_PRED_HH__
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "params/ValuePredictor.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+class ValuePredictor : public SimObject
+{
+  public:
+    typedef ValuePredictorParams Params;
+
+    /** Result of checking a trained value against the prediction */
+    enum Outcome
+    {
+        NoPrediction,
+        Correct,
+        Incorrect
+    };
+
+    /**
+     * A lookup made when a load issued.  It is kept with the load until
+     * the load's value returns, as older loads of the same PC may train
+     * the predictor in the meantime.
+     */
+    struct Prediction
+    {
+        /** The predictor had a prediction */
+        bool valid = false;
+        RegVal value = 0;
+        /** The predictor's history when the lookup was made */
+        uint64_t history = 0;
+    };
+
+    ValuePredictor(const Params &p);
+
+    /**
+     * Get the predicted value of the load at pc, recording the lookup in
+     * the predictor stats.
+     * @param pc The load PC.
+     * @param prediction The prediction is passed back through this
+     * parameter, valid or not, to be passed to train.
+     * @return True if the predictor has a prediction for pc.
+     */
+    bool predict(Addr pc, Prediction &prediction);
+
+    /**
+     * Train the predictor with the value returned by the load at pc.
+     * The prediction made when the load issued is checked against value
+     * to track the predictor's own accuracy.
+     * @param pc The load PC.
+     * @param value The value returned from memory.
+     * @param prediction The load's prediction, as returned by predict.
+     * @return How the prediction compared with value.
+     */
+    Outcome train(Addr pc, RegVal value, const Prediction &prediction);
+
+    /**
+     * Train the predictor with the value returned by a load at pc that
+     * wasn't looked up when it issued.
+     */
+    void train(Addr pc, RegVal value);
+
+    /**
+     * Take over the predictor state of a switched out CPU's predictor.
+     * @param old The old predictor, which must be of the same type and
+     * size as this one.
+     */
+    void takeOverFrom(const ValuePredictor &old);
+
+  protected:
+    /**
+     * Looks up pc without side effects on the predictor state.
+     * @return True and the predicted value if there is a prediction.
+     */
+    virtual bool lookup(Addr pc, RegVal &value) = 0;
+
+    /**
+     * The global state lookups depend on besides the PC, passed back to
+     * update for the tables to be updated where the lookup was made.
+     */
+    virtual uint64_t history() const { return 0; }
+
+    /**
+     * Update the predictor state with the value returned by pc.
+     * @param history The history pc was looked up with.
+     */
+    virtual void update(Addr pc, RegVal value, uint64_t history) = 0;
+
+    /** Copy the tables of old, which is of the same type as this */
+    virtual void copyState(const ValuePredictor &old) = 0;
+
+    /** Number of bits to shift the PC by when indexing tables */
+    const unsigned instShiftAmt;
+
+    struct ValuePredictorStats : public statistics::Group
+    {
+        ValuePredictorStats(statistics::Group *parent);
+
+        /** Lookups made by the user of the predictor */
+        statistics::Scalar lookups;
+        /** Lookups for which the predictor had a prediction */
+        statistics::Scalar predicted;
+        /** Loads the predictor was trained with */
+        statistics::Scalar updates;
+        /** Trained loads whose prediction matched the returned value */
+        statistics::Scalar correct;
+        /** Trained loads whose prediction did not match */
+        statistics::Scalar incorrect;
+        /** Fraction of trained loads that had a prediction */
+        statistics::Formula coverage;
+        /** Fraction of predictions that were correct */
+        statistics::Formula accuracy;
+    } stats;
+};
+
+} // namespace value_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_VALUE_PRED_HH__
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/vtage_value_pred.hh"
+
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "sim/serialize.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+VTAGEValuePredictor::VTAGEValuePredictor(
+    const VTAGEValuePredictorParams &params)
+    : ValuePredictor(params),
+      baseTableSize(params.baseTableSize),
+      logTaggedTableSize(params.logTaggedTableSize),
+      tagBits(params.tagBits),
+      histLengths(params.histLengths),
+      baseTable(baseTableSize),
+      taggedTables(histLengths.size(),
+          std::vector<TaggedTableEntry>(1ULL << logTaggedTableSize,
+                                   TaggedTableEntry(params.confBits))),
+      globalHistory(0)
+{
+    fatal_if(!isPowerOf2(baseTableSize),
+             "VTAGE base table size must be a power of 2\n");
+    fatal_if(logTaggedTableSize == 0,
+             "VTAGE tagged tables must have at least 2 entries\n");
+    fatal_if(tagBits < 2 || tagBits > 16,
+             "VTAGE tag bits must be between 2 and 16\n");
+    for (unsigned length : histLengths) {
+        fatal_if(length == 0 || length > 64,
+                 "VTAGE history lengths must be between 1 and 64 bits\n");
+    }
+}
+
+uint64_t
+VTAGEValuePredictor::fold(uint64_t history, unsigned length, unsigned bits)
+{
+    uint64_t folded = 0;
+    history &= mask(length);
+    for (unsigned shift = 0; shift < length; shift += bits) {
+        folded ^= history >> shift;
+    }
+    return folded & mask(bits);
+}
+
+unsigned
+VTAGEValuePredictor::getBaseIndex(Addr pc) const
+{
+    return (pc >> instShiftAmt) & (baseTableSize - 1);
+}
+
+unsigned
+VTAGEValuePredictor::getTaggedIndex(Addr pc, unsigned table,
+                                    uint64_t history) const
+{
+    const Addr shifted_pc = pc >> instShiftAmt;
+    return (shifted_pc ^ (shifted_pc >> logTaggedTableSize) ^
+            fold(history, histLengths[table], logTaggedTableSize)) &
+           mask(logTaggedTableSize);
+}
+
+uint16_t
+VTAGEValuePredictor::getTag(Addr pc, unsigned table,
+                            uint64_t history) const
+{
+    const Addr shifted_pc = pc >> instShiftAmt;
+    return (shifted_pc ^
+            fold(history, histLengths[table], tagBits) ^
+            (fold(history, histLengths[table], tagBits - 1) << 1)) &
+           mask(tagBits);
+}
+
+int
+VTAGEValuePredictor::findProvider(Addr pc, uint64_t history) const
+{
+    for (int table = taggedTables.size() - 1; table >= 0; table--) {
+        const TaggedTableEntry &entry =
+            taggedTables[table][getTaggedIndex(pc, table, history)];
+        if (entry.valid && entry.tag == getTag(pc, table, history)) {
+            return table;
+        }
+    }
+    return -1;
+}
+
+bool
+VTAGEValuePredictor::lookup(Addr pc, RegVal &value)
+{
+    // A tagged table only provides once its confidence has saturated
+    const int provider = findProvider(pc, globalHistory);
+    if (provider >= 0) {
+        const TaggedTableEntry &entry = taggedTables[provider][
+            getTaggedIndex(pc, provider, globalHistory)];
+        if (!entry.confidence.isSaturated()) {
+            return false;
+        }
+        value = entry.value;
+        return true;
+    }
+
+    const BaseEntry &base = baseTable[getBaseIndex(pc)];
+    if (base.valid && base.tag == pc) {
+        value = base.value;
+        return true;
+    }
+    return false;
+}
+
+void
+VTAGEValuePredictor::update(Addr pc, RegVal value, uint64_t history)
+{
+    const int provider = findProvider(pc, history);
+    BaseEntry &base = baseTable[getBaseIndex(pc)];
+
+    bool correct;
+    if (provider >= 0) {
+        TaggedTableEntry &entry =
+            taggedTables[provider][getTaggedIndex(pc, provider, history)];
+        correct = entry.value == value;
+        if (correct) {
+            entry.confidence++;
+            entry.useful = true;
+        } else {
+            entry.value = value;
+            entry.confidence.reset();
+            entry.useful = false;
+        }
+    } else {
+        correct = base.valid && base.tag == pc && base.value == value;
+    }
+
+    base.valid = true;
+    base.tag = pc;
+    base.value = value;
+
+    // On a misprediction, allocate in a table with a longer history than
+    // the provider.  If every candidate is useful, age them instead
+    if (!correct) {
+        bool allocated = false;
+        for (unsigned table = provider + 1; table < taggedTables.size();
+             table++) {
+            TaggedTableEntry &entry =
+                taggedTables[table][getTaggedIndex(pc, table, history)];
+            if (!entry.valid || !entry.useful) {
+                entry.valid = true;
+                entry.tag = getTag(pc, table, history);
+                entry.value = value;
+                entry.confidence.reset();
+                entry.useful = false;
+                allocated = true;
+                break;
+            }
+        }
+        if (!allocated) {
+            for (unsigned table = provider + 1; table < taggedTables.size();
+                 table++) {
+                taggedTables[table][getTaggedIndex(pc, table, history)]
+                    .useful = false;
+            }
+        }
+    }
+
+    globalHistory = (globalHistory << historyBitsPerLoad) |
+                    ((pc >> instShiftAmt) & mask(historyBitsPerLoad));
+}
+
+void
+VTAGEValuePredictor::copyState(const ValuePredictor &old)
+{
+    const auto &other = static_cast<const VTAGEValuePredictor &>(old);
+    fatal_if(other.baseTableSize != baseTableSize ||
+             other.logTaggedTableSize != logTaggedTableSize ||
+             other.tagBits != tagBits || other.histLengths != histLengths,
+             "%s: can't take over the tables of %s, which has a different "
+             "geometry\n", name(), other.name());
+    baseTable = other.baseTable;
+    taggedTables = other.taggedTables;
+    globalHistory = other.globalHistory;
+}
+
+void
+VTAGEValuePredictor::serialize(CheckpointOut &cp) const
+{
+    SERIALIZE_SCALAR(globalHistory);
+
+    std::vector<bool> baseValid;
+    std::vector<Addr> baseTag;
+    std::vector<RegVal> baseValue;
+    for (const BaseEntry &entry : baseTable) {
+        baseValid.push_back(entry.valid);
+        baseTag.push_back(entry.tag);
+        baseValue.push_back(entry.value);
+    }
+    SERIALIZE_CONTAINER(baseValid);
+    SERIALIZE_CONTAINER(baseTag);
+    SERIALIZE_CONTAINER(baseValue);
+
+    // The tagged tables are flattened, table 0 first
+    std::vector<bool> taggedValid;
+    std::vector<unsigned> taggedTag;
+    std::vector<RegVal> taggedValue;
+    std::vector<unsigned> taggedConfidence;
+    std::vector<bool> taggedUseful;
+    for (const auto &tagged_table : taggedTables) {
+        for (const TaggedTableEntry &entry : tagged_table) {
+            taggedValid.push_back(entry.valid);
+            taggedTag.push_back(entry.tag);
+            taggedValue.push_back(entry.value);
+            taggedConfidence.push_back(entry.confidence);
+            taggedUseful.push_back(entry.useful);
+        }
+    }
+    SERIALIZE_CONTAINER(taggedValid);
+    SERIALIZE_CONTAINER(taggedTag);
+    SERIALIZE_CONTAINER(taggedValue);
+    SERIALIZE_CONTAINER(taggedConfidence);
+    SERIALIZE_CONTAINER(taggedUseful);
+}
+
+void
+VTAGEValuePredictor::unserialize(CheckpointIn &cp)
+{
+    // Checkpoints taken without this predictor leave it cold
+    if (!cp.entryExists(Serializable::currentSection(), "globalHistory"))
+        return;
+
+    UNSERIALIZE_SCALAR(globalHistory);
+
+    std::vector<bool> baseValid;
+    std::vector<Addr> baseTag;
+    std::vector<RegVal> baseValue;
+    UNSERIALIZE_CONTAINER(baseValid);
+    UNSERIALIZE_CONTAINER(baseTag);
+    UNSERIALIZE_CONTAINER(baseValue);
+    fatal_if(baseValid.size() != baseTableSize ||
+             baseTag.size() != baseTableSize ||
+             baseValue.size() != baseTableSize,
+             "%s: checkpoint base table size doesn't match baseTableSize "
+             "(%d)\n", name(), baseTableSize);
+
+    std::vector<bool> taggedValid;
+    std::vector<unsigned> taggedTag;
+    std::vector<RegVal> taggedValue;
+    std::vector<unsigned> taggedConfidence;
+    std::vector<bool> taggedUseful;
+    UNSERIALIZE_CONTAINER(taggedValid);
+    UNSERIALIZE_CONTAINER(taggedTag);
+    UNSERIALIZE_CONTAINER(taggedValue);
+    UNSERIALIZE_CONTAINER(taggedConfidence);
+    UNSERIALIZE_CONTAINER(taggedUseful);
+    const size_t tagged_entries =
+        taggedTables.size() << logTaggedTableSize;
+    fatal_if(taggedValid.size() != tagged_entries ||
+             taggedTag.size() != tagged_entries ||
+             taggedValue.size() != tagged_entries ||
+             taggedConfidence.size() != tagged_entries ||
+             taggedUseful.size() != tagged_entries,
+             "%s: checkpoint tagged tables don't match the configured "
+             "history lengths and logTaggedTableSize\n", name());
+
+    for (unsigned i = 0; i < baseTableSize; i++) {
+        baseTable[i].valid = baseValid[i];
+        baseTable[i].tag = baseTag[i];
+        baseTable[i].value = baseValue[i];
+    }
+    size_t flat_index = 0;
+    for (auto &tagged_table : taggedTables) {
+        for (TaggedTableEntry &entry : tagged_table) {
+            entry.valid = taggedValid[flat_index];
+            entry.tag = taggedTag[flat_index] & mask(tagBits);
+            entry.value = taggedValue[flat_index];
+            entry.confidence.reset();
+            entry.confidence += taggedConfidence[flat_index];
+            entry.useful = taggedUseful[flat_index];
+            flat_index++;
+        }
+    }
+}
+
+} // namespace value_prediction
+} // namespace gem5
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * VTAGE style value predictor.  A PC indexed base table is backed by
+ * several tagged tables indexed by the PC hashed with increasingly long
+ * global histories; the longest matching table provides the prediction
+ * once its confidence counter has saturated.
+ * The global history is the path of load PCs the predictor has been
+ * trained with, which is the committed load stream.  Loads are trained in
+ * the tables they were looked up in, with the history they issued with.
+ */
+
+#ifndef __CPU_PRED_VTAGE_VALUE_PRED_HH__
+#define __CPU_PRED_VTAGE_VALUE_PRED_HH__
+
+#include <vector>
+
+#include "base/sat_counter.hh"
+#include "base/types.hh"
+#include "cpu/pred/value_pred.hh"
+#include "params/VTAGEValuePredictor.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+class VTAGEValuePredictor : public ValuePredictor
+{
+  public:
+    VTAGEValuePredictor(const VTAGEValuePredictorParams &params);
+
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+
+  protected:
+    bool lookup(Addr pc, RegVal &value) override;
+    uint64_t history() const override { return globalHistory; }
+    void update(Addr pc, RegVal value, uint64_t history) override;
+    void copyState(const ValuePredictor &old) override;
+
+    struct BaseEntry
+    {
+        bool valid = false;
+        Addr tag = 0;
+        RegVal value = 0;
+    };
+
+    struct TaggedTableEntry
+    {
+        TaggedTableEntry(unsigned conf_bits) : confidence(conf_bits) {}
+
+        bool valid = false;
+        uint16_t tag = 0;
+        RegVal value = 0;
+        SatCounter8 confidence;
+        bool useful = false;
+    };
+
+    /** Fold the low length bits of history down to bits bits */
+    static uint64_t fold(uint64_t history, unsigned length, unsigned bits);
+
+    unsigned getBaseIndex(Addr pc) const;
+    unsigned getTaggedIndex(Addr pc, unsigned table,
+                            uint64_t history) const;
+    uint16_t getTag(Addr pc, unsigned table, uint64_t history) const;
+
+    /**
+     * Find the longest history table with an entry matching pc.
+     * @return The table number or -1 if no tagged table matches.
+     */
+    int findProvider(Addr pc, uint64_t history) const;
+
+    /** Number of entries in the base table */
+    const unsigned baseTableSize;
+
+    /** Log2 of the number of entries in each tagged table */
+    const unsigned logTaggedTableSize;
+
+    /** Number of tag bits of the tagged tables */
+    const unsigned tagBits;
+
+    /** History length in bits used by each tagged table */
+    const std::vector<unsigned> histLengths;
+
+    /** Bits of global history shifted in per trained load */
+    static const unsigned historyBitsPerLoad = 2;
+
+    std::vector<BaseEntry> baseTable;
+    std::vector<std::vector<TaggedTableEntry>> taggedTables;
+
+    /** Global path history, newest load in the low bits */
+    uint64_t globalHistory;
+};
+
+} // namespace value_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_VTAGE_VALUE_PRED_HH__
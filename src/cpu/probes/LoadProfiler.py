@@ -0,0 +1,18 @@
+from m5.params import *
+from m5.objects.Probe import ProbeListenerObject
+
+class LoadProfiler(ProbeListenerObject):
+    """Profiles the value and address locality of each static load retired
+    by a CPU (manager) and, for CPUs that report them, the cycles
+    dependent instructions stall waiting for its result.  The top_k loads
+    by stall cycles, then by count, are appended to report_file at each
+    stats dump"""
+    type = 'LoadProfiler'
+    cxx_header = "cpu/probes/load_profiler.hh"
+    cxx_class = 'gem5::LoadProfiler'
+
+    history_depth = Param.Unsigned(4, "Number of earlier values of each"
+        " load to look for its value in (last-N hits)")
+    top_k = Param.Unsigned(20, "Number of loads in each report")
+    report_file = Param.String("loadprofile.txt", "Report file, created in"
+        " the output directory")
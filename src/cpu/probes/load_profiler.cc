@@ -0,0 +1,265 @@
+#include "cpu/probes/load_profiler.hh"
+
+#include <algorithm>
+#include <cstring>
+
+#include "base/cprintf.hh"
+#include "base/logging.hh"
+#include "cpu/thread_context.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+LoadProfiler::LoadProfiler(const LoadProfilerParams &params)
+    : ProbeListenerObject(params),
+      historyDepth(params.history_depth),
+      topK(params.top_k),
+      reportStream(simout.create(params.report_file)),
+      stats(this)
+{
+    fatal_if(historyDepth == 0, "%s: history_depth must be at least 1\n",
+        name());
+
+    statistics::registerDumpCallback([this]() { writeReport(); });
+}
+
+void
+LoadProfiler::regProbeListeners()
+{
+    typedef ProbeListenerArg<LoadProfiler, BaseCPU::RetiredMemRef>
+        MemRefListener;
+    typedef ProbeListenerArg<LoadProfiler, BaseCPU::LoadDependenceStall>
+        StallListener;
+    listeners.push_back(new MemRefListener(this, "RetiredMemRefs",
+                                           &LoadProfiler::profileLoad));
+    /* Only some CPU models have this point */
+    listeners.push_back(new StallListener(this, "LoadDependenceStalls",
+                                          &LoadProfiler::profileStall));
+}
+
+void
+LoadProfiler::resetStats()
+{
+    ProbeListenerObject::resetStats();
+    loads.clear();
+}
+
+bool
+LoadProfiler::loadedValue(const BaseCPU::RetiredMemRef &mem_ref,
+    uint64_t &value, bool &scalar)
+{
+    const StaticInstPtr &si = mem_ref.inst;
+    const BaseISA::RegClasses &reg_classes =
+        mem_ref.tc->getIsaPtr()->regClasses();
+
+    /* Several values are combined, FNV style */
+    unsigned num_values = 0;
+    value = 0;
+    auto combine = [&value, &num_values](uint64_t v) {
+        value = (num_values++ == 0 ? v : (value ^ v) * 0x100000001b3ULL);
+    };
+
+    for (int dest_index = 0; dest_index < si->numDestRegs(); dest_index++) {
+        const RegId &dest = si->destRegIdx(dest_index);
+        if (!dest.isRenameable())
+            continue;
+
+        /* Skip the base register updates of loads with writeback.  Other
+         *  destinations that are also sources are loaded */
+        if (si->isBaseUpdate()) {
+            bool is_src = false;
+            for (int src_index = 0; src_index < si->numSrcRegs();
+                src_index++)
+                is_src = is_src || si->srcRegIdx(src_index) == dest;
+            if (is_src)
+                continue;
+        }
+
+        size_t reg_bytes = reg_classes.at(dest.classValue()).regBytes();
+        if (reg_bytes <= sizeof(RegVal)) {
+            combine(mem_ref.tc->getReg(dest));
+        } else {
+            regBuffer.resize(reg_bytes);
+            mem_ref.tc->getReg(dest, regBuffer.data());
+            for (size_t offset = 0; offset < reg_bytes;
+                offset += sizeof(uint64_t)) {
+                uint64_t word = 0;
+                std::memcpy(&word, &regBuffer[offset],
+                    std::min(sizeof(uint64_t), reg_bytes - offset));
+                combine(word);
+            }
+        }
+    }
+
+    scalar = num_values == 1;
+    return num_values != 0;
+}
+
+void
+LoadProfiler::profileLoad(const BaseCPU::RetiredMemRef &mem_ref)
+{
+    if (!mem_ref.inst->isLoad() || mem_ref.inst->isDataPrefetch() ||
+        mem_ref.size == 0) {
+        return;
+    }
+
+    LoadRecord &record = loads[mem_ref.pc->instAddr()];
+    record.inst = mem_ref.inst;
+    stats.loads++;
+
+    uint64_t value;
+    bool scalar;
+    bool has_value = loadedValue(mem_ref, value, scalar);
+
+    if (record.count != 0) {
+        if (has_value && !record.history.empty()) {
+            uint64_t last = record.history.front();
+            if (value == last) {
+                record.lastValueHits++;
+                stats.lastValueHits++;
+            }
+            if (std::find(record.history.begin(), record.history.end(),
+                    value) != record.history.end()) {
+                record.historyHits++;
+                stats.historyHits++;
+            }
+            /* A stride needs two earlier scalar values */
+            if (scalar && record.scalar && record.count > 1 &&
+                value == last + record.valueStride) {
+                record.valueStrideHits++;
+                stats.valueStrideHits++;
+            }
+            record.valueStride = value - last;
+        }
+
+        if (mem_ref.addr == record.lastAddr) {
+            record.sameAddrHits++;
+            stats.sameAddrHits++;
+        }
+        if (record.count > 1 &&
+            mem_ref.addr == record.lastAddr + record.addrStride) {
+            record.addrStrideHits++;
+            stats.addrStrideHits++;
+        }
+        record.addrStride = mem_ref.addr - record.lastAddr;
+    }
+
+    if (has_value) {
+        if (record.history.size() == historyDepth)
+            record.history.pop_back();
+        record.history.insert(record.history.begin(), value);
+        record.scalar = scalar;
+    }
+    record.lastAddr = mem_ref.addr;
+    record.count++;
+}
+
+void
+LoadProfiler::profileStall(const BaseCPU::LoadDependenceStall &stall)
+{
+    LoadRecord &record = loads[stall.loadPC];
+    record.stalls++;
+    record.stallCycles += stall.cycles;
+    stats.stalls++;
+    stats.stallCycles += stall.cycles;
+}
+
+void
+LoadProfiler::writeReport()
+{
+    std::ostream &os = *reportStream->stream();
+
+    /* Rank by critical path contribution, then by how often the loads
+     *  retired, for CPUs without stall reports */
+    std::vector<std::pair<Addr, const LoadRecord *>> ranked;
+    ranked.reserve(loads.size());
+    for (const auto &load : loads)
+        ranked.emplace_back(load.first, &load.second);
+
+    size_t num_reported = std::min<size_t>(topK, ranked.size());
+    std::partial_sort(ranked.begin(), ranked.begin() + num_reported,
+        ranked.end(), [](const auto &a, const auto &b) {
+            if (a.second->stallCycles != b.second->stallCycles)
+                return a.second->stallCycles > b.second->stallCycles;
+            if (a.second->count != b.second->count)
+                return a.second->count > b.second->count;
+            return a.first < b.first;
+        });
+
+    auto percent = [](uint64_t part, uint64_t whole) {
+        return whole == 0 ? 0.0 : 100.0 * part / whole;
+    };
+
+    uint64_t total_loads = stats.loads.value();
+    uint64_t total_stall_cycles = stats.stallCycles.value();
+
+    ccprintf(os, "---------- %s at tick %d: %d of %d static loads"
+        " ----------\n", name(), curTick(), num_reported, loads.size());
+    ccprintf(os, "%4s %18s %10s %6s %6s %6s %6s %6s %6s %12s %6s %s\n",
+        "rank", "pc", "count", "%load", "last", "lastN", "stride",
+        "addr", "astrd", "stall_cyc", "%stall", "inst");
+
+    for (size_t rank = 0; rank < num_reported; rank++) {
+        Addr pc = ranked[rank].first;
+        const LoadRecord &record = *ranked[rank].second;
+
+        /* Hit rates are over the instances which had a prediction */
+        uint64_t predicted = (record.count == 0 ? 0 : record.count - 1);
+        ccprintf(os, "%4d %#18x %10d %6.2f %6.2f %6.2f %6.2f %6.2f %6.2f"
+            " %12d %6.2f %s\n",
+            rank + 1, pc, record.count,
+            percent(record.count, total_loads),
+            percent(record.lastValueHits, predicted),
+            percent(record.historyHits, predicted),
+            percent(record.valueStrideHits, predicted),
+            percent(record.sameAddrHits, predicted),
+            percent(record.addrStrideHits, predicted),
+            record.stallCycles,
+            percent(record.stallCycles, total_stall_cycles),
+            record.inst ? record.inst->disassemble(pc) : "");
+    }
+    os << std::endl;
+}
+
+LoadProfiler::LoadProfilerStats::LoadProfilerStats(
+    statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(loads, statistics::units::Count::get(),
+               "Number of retired loads profiled"),
+      ADD_STAT(lastValueHits, statistics::units::Count::get(),
+               "Loads returning the same value as their last instance"),
+      ADD_STAT(historyHits, statistics::units::Count::get(),
+               "Loads returning one of the values of their last"
+               " history_depth instances"),
+      ADD_STAT(valueStrideHits, statistics::units::Count::get(),
+               "Loads whose value continued the stride of their last two"
+               " instances"),
+      ADD_STAT(sameAddrHits, statistics::units::Count::get(),
+               "Loads accessing the same address as their last instance"),
+      ADD_STAT(addrStrideHits, statistics::units::Count::get(),
+               "Loads whose address continued the stride of their last"
+               " two instances"),
+      ADD_STAT(stalls, statistics::units::Count::get(),
+               "Instructions whose issue waited on a load's result"),
+      ADD_STAT(stallCycles, statistics::units::Cycle::get(),
+               "Cycles instructions waited on loads' results to issue"),
+      ADD_STAT(lastValueRate, statistics::units::Ratio::get(),
+               "Fraction of loads with a last value hit",
+               lastValueHits / loads),
+      ADD_STAT(historyRate, statistics::units::Ratio::get(),
+               "Fraction of loads with a last N values hit",
+               historyHits / loads),
+      ADD_STAT(valueStrideRate, statistics::units::Ratio::get(),
+               "Fraction of loads with a value stride hit",
+               valueStrideHits / loads),
+      ADD_STAT(sameAddrRate, statistics::units::Ratio::get(),
+               "Fraction of loads with a same address hit",
+               sameAddrHits / loads),
+      ADD_STAT(addrStrideRate, statistics::units::Ratio::get(),
+               "Fraction of loads with an address stride hit",
+               addrStrideHits / loads)
+{
+}
+
+} // namespace gem5
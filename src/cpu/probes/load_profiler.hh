@@ -0,0 +1,118 @@
+/**
+ * @file
+ * Per-PC load profiling for any CPU model.  LoadProfiler listens to a
+ * CPU's RetiredMemRefs probe point and, for each static load, measures
+ * how predictable its values (last value, last N values, stride) and
+ * addresses (same address, stride) are.  CPU models that report their
+ * LoadDependenceStalls, currently Minor, also give the cycles dependent
+ * instructions spent waiting for each load's result, its contribution to
+ * the critical path.  A report of the top K loads is written at each stats
+ * dump, and the profile is cleared when the stats are reset.
+ */
+
+#ifndef __CPU_PROBES_LOAD_PROFILER_HH__
+#define __CPU_PROBES_LOAD_PROFILER_HH__
+
+#include <unordered_map>
+#include <vector>
+
+#include "base/output.hh"
+#include "base/statistics.hh"
+#include "cpu/base.hh"
+#include "params/LoadProfiler.hh"
+#include "sim/probe/probe.hh"
+
+namespace gem5
+{
+
+class LoadProfiler : public ProbeListenerObject
+{
+  public:
+    LoadProfiler(const LoadProfilerParams &params);
+
+    void regProbeListeners() override;
+
+    void resetStats() override;
+
+    /** Profile a retired load's values and address */
+    void profileLoad(const BaseCPU::RetiredMemRef &mem_ref);
+
+    /** Charge a dependence stall to the load causing it */
+    void profileStall(const BaseCPU::LoadDependenceStall &stall);
+
+    /** Append the top K loads to the report file, at each stats dump */
+    void writeReport();
+
+  protected:
+    /** The profile of one static load */
+    struct LoadRecord
+    {
+        /** The last instance, for disassembly in the report */
+        StaticInstPtr inst;
+
+        uint64_t count = 0;
+
+        /** Hits against the values and addresses of earlier instances */
+        uint64_t lastValueHits = 0;
+        uint64_t historyHits = 0;
+        uint64_t valueStrideHits = 0;
+        uint64_t sameAddrHits = 0;
+        uint64_t addrStrideHits = 0;
+
+        /** Dependence stalls charged to this load */
+        uint64_t stalls = 0;
+        uint64_t stallCycles = 0;
+
+        /** The last historyDepth values, most recent first.  Values of
+         *  loads with several or vector destinations are hashed, so have
+         *  no meaningful stride */
+        std::vector<uint64_t> history;
+        bool scalar = true;
+        int64_t valueStride = 0;
+
+        Addr lastAddr = 0;
+        int64_t addrStride = 0;
+    };
+
+    /** Read the value a load left in its destinations, excluding base
+     *  register updates.  Returns false if it has no such destination */
+    bool loadedValue(const BaseCPU::RetiredMemRef &mem_ref,
+        uint64_t &value, bool &scalar);
+
+    /** Number of earlier values to look for each value in */
+    const unsigned historyDepth;
+
+    /** Number of loads in each report */
+    const unsigned topK;
+
+    OutputStream *reportStream;
+
+    std::unordered_map<Addr, LoadRecord> loads;
+
+    /** Reused to read vector destinations */
+    std::vector<uint8_t> regBuffer;
+
+    struct LoadProfilerStats : public statistics::Group
+    {
+        LoadProfilerStats(statistics::Group *parent);
+
+        statistics::Scalar loads;
+        statistics::Scalar lastValueHits;
+        statistics::Scalar historyHits;
+        statistics::Scalar valueStrideHits;
+        statistics::Scalar sameAddrHits;
+        statistics::Scalar addrStrideHits;
+        statistics::Scalar stalls;
+        statistics::Scalar stallCycles;
+
+        statistics::Formula lastValueRate;
+        statistics::Formula historyRate;
+        statistics::Formula valueStrideRate;
+        statistics::Formula sameAddrRate;
+        statistics::Formula addrStrideRate;
+    } stats;
+};
+
+} // namespace gem5
+
+#endif // __CPU_PROBES_LOAD_PROFILER_HH__
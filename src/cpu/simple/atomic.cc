@@ -82,7 +82,7 @@ AtomicSimpleCPU::AtomicSimpleCPU(const BaseAtomicSimpleCPUParams &p)
       icachePort(name() + ".icache_port", this),
       dcachePort(name() + ".dcache_port", this),
       dcache_access(false), dcache_latency(0),
-      ppCommit(nullptr)
+      ppCommit(nullptr), ppRequest(nullptr)
 {
     _status = Idle;
     ifetch_req = std::make_shared<Request>();
@@ -272,6 +272,8 @@ AtomicSimpleCPU::suspendContext(ThreadID thread_num)
 Tick
 AtomicSimpleCPU::sendPacket(RequestPort &port, const PacketPtr &pkt)
 {
+    if (ppRequest->hasListeners())
+        ppRequest->notify(probing::PacketInfo(pkt));
     return port.sendAtomic(pkt);
 }
 
@@ -373,6 +375,9 @@ AtomicSimpleCPU::readMem(Addr addr, uint8_t *data, unsigned size,
     if (traceData)
         traceData->setMem(addr, size, flags);
 
+    memRefAddr = addr;
+    memRefSize = size;
+
     dcache_latency = 0;
 
     req->taskId(taskId());
@@ -446,6 +451,9 @@ AtomicSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
     SimpleThread *thread = t_info.thread;
     static uint8_t zero_array[64] = {};
 
+    memRefAddr = addr;
+    memRefSize = size;
+
     if (data == NULL) {
         assert(size <= 64);
         assert(flags & Request::STORE_NO_DATA);
@@ -559,6 +567,9 @@ AtomicSimpleCPU::amoMem(Addr addr, uint8_t* data, unsigned size,
     if (traceData)
         traceData->setMem(addr, size, flags);
 
+    memRefAddr = addr;
+    memRefSize = size;
+
     //The address of the second part of this access if it needs to be split
     //across a cache line boundary.
     Addr secondAddr = roundDown(addr + size - 1, cacheLineSize());
@@ -691,6 +702,7 @@ AtomicSimpleCPU::tick()
                 if (fault == NoFault) {
                     countInst();
                     ppCommit->notify(std::make_pair(thread, curStaticInst));
+                    probeRetiredMemRef();
                 } else if (traceData) {
                     traceFault();
                 }
@@ -763,10 +775,11 @@ AtomicSimpleCPU::fetchInstMem()
 void
 AtomicSimpleCPU::regProbePoints()
 {
-    BaseCPU::regProbePoints();
+    BaseSimpleCPU::regProbePoints();
 
     ppCommit = new ProbePointArg<std::pair<SimpleThread*, const StaticInstPtr>>
                                 (getProbeManager(), "Commit");
+    ppRequest = new probing::Packet(getProbeManager(), "PktRequest");
 }
 
 void
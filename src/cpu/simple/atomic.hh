@@ -45,6 +45,7 @@
 #include "cpu/simple/exec_context.hh"
 #include "mem/request.hh"
 #include "params/BaseAtomicSimpleCPU.hh"
+#include "sim/probe/mem.hh"
 #include "sim/probe/probe.hh"
 
 namespace gem5
@@ -173,6 +174,9 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     /** Probe Points. */
     ProbePointArg<std::pair<SimpleThread *, const StaticInstPtr>> *ppCommit;
 
+    /** The requests sent to the instruction and data ports */
+    probing::Packet *ppRequest;
+
   protected:
 
     /** Return a reference to the data port. */
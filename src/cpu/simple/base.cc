@@ -86,7 +86,9 @@ BaseSimpleCPU::BaseSimpleCPU(const BaseSimpleCPUParams &p)
       curThread(0),
       branchPred(p.branchPred),
       traceData(NULL),
-      _status(Idle)
+      _status(Idle),
+      memRefAddr(0),
+      memRefSize(0)
 {
     SimpleThread *thread;
 
@@ -310,6 +312,8 @@ BaseSimpleCPU::preExecute()
     t_info.setPredicate(true);
     t_info.setMemAccPredicate(true);
 
+    memRefSize = 0;
+
     // decode the instruction
     set(preExecuteTempPC, thread->pcState());
     auto &pc_state = *preExecuteTempPC;
@@ -454,6 +458,19 @@ BaseSimpleCPU::postExecute()
     probeInstCommit(curStaticInst, instAddr);
 }
 
+void
+BaseSimpleCPU::probeRetiredMemRef()
+{
+    if (!curStaticInst->isLoad() && !curStaticInst->isStore() &&
+        !curStaticInst->isAtomic()) {
+        return;
+    }
+
+    SimpleThread *thread = threadInfo[curThread]->thread;
+    BaseCPU::probeRetiredMemRef(thread->getTC(), curStaticInst,
+        thread->pcState(), memRefAddr, memRefSize);
+}
+
 void
 BaseSimpleCPU::advancePC(const Fault &fault)
 {
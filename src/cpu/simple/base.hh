@@ -140,6 +140,17 @@ class BaseSimpleCPU : public BaseCPU
     void postExecute();
     void advancePC(const Fault &fault);
 
+  protected:
+    /** Access made by the current instruction, set by the memory
+     *  functions and cleared by preExecute */
+    Addr memRefAddr;
+    unsigned memRefSize;
+
+    /** Notify ppRetiredMemRefs if the current instruction references
+     *  memory */
+    void probeRetiredMemRef();
+
+  public:
     void haltContext(ThreadID thread_num) override;
 
     // statistics
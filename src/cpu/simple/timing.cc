@@ -464,7 +464,10 @@ TimingSimpleCPU::initiateMemRead(Addr addr, unsigned size,
     if (traceData)
         traceData->setMem(addr, size, flags);
 
-    RequestPtr req = std::make_shared<Request>(
+    memRefAddr = addr;
+    memRefSize = size;
+
+    RequestPtr req = Request::make(
         addr, size, flags, dataRequestorId(), pc, thread->contextId());
     req->setByteEnable(byte_enable);
 
@@ -535,6 +538,9 @@ TimingSimpleCPU::writeMem(uint8_t *data, unsigned size,
     unsigned block_size = cacheLineSize();
     BaseMMU::Mode mode = BaseMMU::Write;
 
+    memRefAddr = addr;
+    memRefSize = size;
+
     if (data == NULL) {
         assert(flags & Request::STORE_NO_DATA);
         // This must be a cache block cleaning request
@@ -546,7 +552,7 @@ TimingSimpleCPU::writeMem(uint8_t *data, unsigned size,
     if (traceData)
         traceData->setMem(addr, size, flags);
 
-    RequestPtr req = std::make_shared<Request>(
+    RequestPtr req = Request::make(
         addr, size, flags, dataRequestorId(), pc, thread->contextId());
     req->setByteEnable(byte_enable);
 
@@ -602,7 +608,10 @@ TimingSimpleCPU::initiateMemAMO(Addr addr, unsigned size,
     if (traceData)
         traceData->setMem(addr, size, flags);
 
-    RequestPtr req = std::make_shared<Request>(addr, size, flags,
+    memRefAddr = addr;
+    memRefSize = size;
+
+    RequestPtr req = Request::make(addr, size, flags,
                             dataRequestorId(), pc, thread->contextId(),
                             std::move(amo_op));
 
@@ -699,7 +708,7 @@ TimingSimpleCPU::fetch()
 
     if (needToFetch) {
         _status = BaseSimpleCPU::Running;
-        RequestPtr ifetch_req = std::make_shared<Request>();
+        RequestPtr ifetch_req = Request::make();
         ifetch_req->taskId(taskId());
         ifetch_req->setContext(thread->contextId());
         setupFetchRequest(ifetch_req);
@@ -1064,9 +1073,10 @@ TimingSimpleCPU::completeDataAccess(PacketPtr pkt)
     }
 
     // keep an instruction count
-    if (fault == NoFault)
+    if (fault == NoFault) {
         countInst();
-    else if (traceData) {
+        probeRetiredMemRef();
+    } else if (traceData) {
         traceFault();
     }
 
@@ -1245,7 +1255,7 @@ TimingSimpleCPU::initiateMemMgmtCmd(Request::Flags flags)
     if (traceData)
         traceData->setMem(addr, size, flags);
 
-    RequestPtr req = std::make_shared<Request>(
+    RequestPtr req = Request::make(
         addr, size, flags, dataRequestorId());
 
     req->setPC(pc);
@@ -1300,7 +1310,7 @@ TimingSimpleCPU::htmSendAbortSignal(ThreadID tid, uint64_t htm_uid,
 
     // notify l1 d-cache (ruby) that core has aborted transaction
 
-    RequestPtr req = std::make_shared<Request>(
+    RequestPtr req = Request::make(
         addr, size, flags, dataRequestorId());
 
     req->setPC(pc);
@@ -150,6 +150,7 @@ class StaticInst : public RefCounted, public StaticInstFlags
     bool isStoreConditional()     const { return flags[IsStoreConditional]; }
     bool isInstPrefetch() const { return flags[IsInstPrefetch]; }
     bool isDataPrefetch() const { return flags[IsDataPrefetch]; }
+    bool isBaseUpdate()   const { return flags[IsBaseUpdate]; }
     bool isPrefetch()     const { return isInstPrefetch() ||
                                          isDataPrefetch(); }
 
@@ -108,7 +108,7 @@ GUPSGen::indexToAddr (uint64_t index)
 PacketPtr
 GUPSGen::getReadPacket(Addr addr, unsigned int size)
 {
-    RequestPtr req = std::make_shared<Request>(addr, size, 0, requestorId);
+    RequestPtr req = Request::make(addr, size, 0, requestorId);
     // Dummy PC to have PC-based prefetchers latch on; get entropy into higher
     // bits
     req->setPC(((Addr)requestorId) << 2);
@@ -123,8 +123,7 @@ GUPSGen::getReadPacket(Addr addr, unsigned int size)
 PacketPtr
 GUPSGen::getWritePacket(Addr addr, unsigned int size, uint8_t *data)
 {
-    RequestPtr req = std::make_shared<Request>(addr, size, 0,
-                                               requestorId);
+    RequestPtr req = Request::make(addr, size, 0, requestorId);
     // Dummy PC to have PC-based prefetchers latch on; get entropy into higher
     // bits
     req->setPC(((Addr)requestorId) << 2);
@@ -0,0 +1,27 @@
+from m5.params import *
+from m5.objects.ClockedObject import ClockedObject
+
+class PartitionChannel(ClockedObject):
+    """Joins a requestor and responder simulated on different event
+    queues.  Timing packets cross it as events on the other queue, which
+    is only safe if they take at least a simulation quantum, so the
+    channel lowers Root's sim_quantum to its shortest delay.  Snoops,
+    atomic and functional accesses are made synchronously on the other
+    queue.  m5.partition splices these into the links between a system's
+    partitions"""
+    type = 'PartitionChannel'
+    cxx_header = "mem/partition_channel.hh"
+    cxx_class = 'gem5::PartitionChannel'
+
+    cpu_side_port = ResponsePort("This port receives requests and "
+                                 "sends responses")
+    mem_side_port = RequestPort("This port sends requests and "
+                                "receives responses")
+
+    cpu_side_eventq = Param.UInt32("Event queue of the object connected "
+                                   "to cpu_side_port")
+    mem_side_eventq = Param.UInt32("Event queue of the object connected "
+                                   "to mem_side_port")
+
+    delay = Param.Cycles(1, "Latency of requests and snoop responses")
+    response_delay = Param.Cycles(1, "Latency of responses")
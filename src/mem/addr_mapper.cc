@@ -104,6 +104,30 @@ AddrMapper::recvAtomicSnoop(PacketPtr pkt)
     return ret_tick;
 }
 
+WarmResponse
+AddrMapper::recvWarmRequest(const WarmRequest &req)
+{
+    WarmRequest remapped = req;
+    remapped.addr = remapAddr(req.addr);
+    return memSidePort.sendWarmRequest(remapped);
+}
+
+void
+AddrMapper::recvWarmEvict(const WarmEviction &evict)
+{
+    WarmEviction remapped = evict;
+    remapped.addr = remapAddr(evict.addr);
+    memSidePort.sendWarmEvict(remapped);
+}
+
+WarmSnoopResponse
+AddrMapper::recvWarmSnoop(const WarmSnoop &snoop)
+{
+    WarmSnoop remapped = snoop;
+    remapped.addr = remapAddr(snoop.addr);
+    return cpuSidePort.sendWarmSnoop(remapped);
+}
+
 bool
 AddrMapper::recvTimingReq(PacketPtr pkt)
 {
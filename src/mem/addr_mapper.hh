@@ -117,6 +117,12 @@ class AddrMapper : public SimObject
             return mapper.recvAtomicSnoop(pkt);
         }
 
+        WarmSnoopResponse
+        recvWarmSnoop(const WarmSnoop &snoop) override
+        {
+            return mapper.recvWarmSnoop(snoop);
+        }
+
         bool
         recvTimingResp(PacketPtr pkt) override
         {
@@ -174,6 +180,18 @@ class AddrMapper : public SimObject
             return mapper.recvAtomic(pkt);
         }
 
+        WarmResponse
+        recvWarmRequest(const WarmRequest &req) override
+        {
+            return mapper.recvWarmRequest(req);
+        }
+
+        void
+        recvWarmEvict(const WarmEviction &evict) override
+        {
+            mapper.recvWarmEvict(evict);
+        }
+
         bool
         recvTimingReq(PacketPtr pkt) override
         {
@@ -213,6 +231,12 @@ class AddrMapper : public SimObject
 
     Tick recvAtomicSnoop(PacketPtr pkt);
 
+    WarmResponse recvWarmRequest(const WarmRequest &req);
+
+    void recvWarmEvict(const WarmEviction &evict);
+
+    WarmSnoopResponse recvWarmSnoop(const WarmSnoop &snoop);
+
     bool recvTimingReq(PacketPtr pkt);
 
     bool recvTimingResp(PacketPtr pkt);
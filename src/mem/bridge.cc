@@ -371,6 +371,18 @@ Bridge::BridgeResponsePort::recvFunctional(PacketPtr pkt)
     memSidePort.sendFunctional(pkt);
 }
 
+WarmResponse
+Bridge::BridgeResponsePort::recvWarmRequest(const WarmRequest &req)
+{
+    return memSidePort.sendWarmRequest(req);
+}
+
+void
+Bridge::BridgeResponsePort::recvWarmEvict(const WarmEviction &evict)
+{
+    memSidePort.sendWarmEvict(evict);
+}
+
 bool
 Bridge::BridgeRequestPort::trySatisfyFunctional(PacketPtr pkt)
 {
@@ -209,6 +209,11 @@ class Bridge : public ClockedObject
             pass it to the bridge. */
         void recvFunctional(PacketPtr pkt);
 
+        /** When receiving a warm request or eviction from the peer
+            port, pass it through the bridge. */
+        WarmResponse recvWarmRequest(const WarmRequest &req);
+        void recvWarmEvict(const WarmEviction &evict);
+
         /** When receiving a address range request the peer port,
             pass it to the bridge. */
         AddrRangeList getAddrRanges() const;
@@ -43,6 +43,7 @@ from m5.SimObject import SimObject
 from m5.objects.ClockedObject import ClockedObject
 from m5.objects.Compressors import BaseCacheCompressor
 from m5.objects.Prefetcher import BasePrefetcher
+from m5.objects.Probe import ProbeListenerObject
 from m5.objects.ReplacementPolicies import *
 from m5.objects.Tags import *
 
@@ -166,3 +167,15 @@ class NoncoherentCache(BaseCache):
     # writebacks would be unnecessary traffic to the main memory.
     writeback_clean = False
 
+class CacheWarmer(ProbeListenerObject):
+    """Functionally warms the caches of a CPU (manager) with the addresses
+    of the requests it sends while the caches are bypassed, e.g. during an
+    atomic fast forward. The manager must have a PktRequest probe point,
+    as the AtomicSimpleCPU does."""
+    type = 'CacheWarmer'
+    cxx_header = 'mem/cache/cache_warmer.hh'
+    cxx_class = 'gem5::CacheWarmer'
+
+    icache = Param.BaseCache(NULL, "Cache instruction fetches go to")
+    dcache = Param.BaseCache(NULL, "Cache loads and stores go to")
+    system = Param.System(Parent.any, "System the caches belong to")
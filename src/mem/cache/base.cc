@@ -107,6 +107,7 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
       blocked(0),
       order(0),
       noTargetMSHR(nullptr),
+      dataStale(false),
       missCount(p.max_miss_count),
       addrRanges(p.addr_ranges.begin(), p.addr_ranges.end()),
       system(p.system),
@@ -245,7 +246,7 @@ BaseCache::handleTimingReqHit(PacketPtr pkt, CacheBlk *blk, Tick request_time)
             // Basically we need to get the MSHR in the same state as if
             // we had missed and just received the response.
             // Request *req2 = new Request(*(pkt->req));
-            RequestPtr req2 = std::make_shared<Request>(*(pkt->req));
+            RequestPtr req2 = Request::make(*(pkt->req));
             PacketPtr pkt2 = new Packet(req2, pkt->cmd);
             MSHR *mshr = allocateMissBuffer(pkt2, curTick(), true);
             // Mark the MSHR "in service" (even though it's not) to prevent
@@ -1697,7 +1698,7 @@ BaseCache::writebackBlk(CacheBlk *blk)
 
     stats.writebacks[Request::wbRequestorId]++;
 
-    RequestPtr req = std::make_shared<Request>(
+    RequestPtr req = Request::make(
         regenerateBlkAddr(blk), blkSize, 0, Request::wbRequestorId);
 
     if (blk->isSecure())
@@ -1740,7 +1741,7 @@ BaseCache::writebackBlk(CacheBlk *blk)
 PacketPtr
 BaseCache::writecleanBlk(CacheBlk *blk, Request::Flags dest, PacketId id)
 {
-    RequestPtr req = std::make_shared<Request>(
+    RequestPtr req = Request::make(
         regenerateBlkAddr(blk), blkSize, 0, Request::wbRequestorId);
 
     if (blk->isSecure()) {
@@ -1786,15 +1787,257 @@ BaseCache::writecleanBlk(CacheBlk *blk, Request::Flags dest, PacketId id)
 void
 BaseCache::memWriteback()
 {
+    // Stale data must not be written over memory's
+    if (dataStale)
+        refillFromMemory();
+
     tags->forEachBlk([this](CacheBlk &blk) { writebackVisitor(blk); });
 }
 
 void
 BaseCache::memInvalidate()
 {
+    // Blocks dirtied by functional warming have no data of their own
+    if (dataStale) {
+        tags->forEachBlk([](CacheBlk &blk) {
+            blk.clearCoherenceBits(CacheBlk::DirtyBit); });
+        dataStale = false;
+    }
+
     tags->forEachBlk([this](CacheBlk &blk) { invalidateVisitor(blk); });
 }
 
+void
+BaseCache::drainResume()
+{
+    if (system->bypassCaches()) {
+        // Memory may be written without us seeing it
+        dataStale = true;
+    } else if (dataStale) {
+        refillFromMemory();
+        dataStale = false;
+    }
+}
+
+void
+BaseCache::refillFromMemory()
+{
+    memory::PhysicalMemory &physmem = system->getPhysMem();
+    tags->forEachBlk([this, &physmem](CacheBlk &blk) {
+        if (!blk.isValid())
+            return;
+
+        const Addr addr = regenerateBlkAddr(&blk);
+        if (!physmem.isMemAddr(addr)) {
+            // There is no data to refill the block with
+            blk.clearCoherenceBits(CacheBlk::DirtyBit);
+            invalidateBlock(&blk);
+            return;
+        }
+
+        RequestPtr req = Request::make(
+            addr, blkSize, 0, Request::funcRequestorId);
+        if (blk.isSecure())
+            req->setFlags(Request::SECURE);
+
+        Packet pkt(req, MemCmd::ReadReq);
+        pkt.dataStatic(blk.data);
+        physmem.functionalAccess(&pkt);
+    });
+}
+
+void
+BaseCache::warmAccess(Addr addr, bool is_secure, bool is_write,
+                      RequestorID requestor_id)
+{
+    panic_if(!system->bypassCaches(), "%s can only be functionally warmed "
+             "while the caches are bypassed\n", name());
+    gem5_assert(!(isReadOnly && is_write),
+                "Should never see a write in a read-only cache %s\n",
+                name());
+
+    warmRequest(WarmRequest{tags->blkAlign(addr), is_secure, requestor_id,
+                            is_write, false, false, false}, false);
+}
+
+WarmResponse
+BaseCache::warmRequest(const WarmRequest &req, bool from_cache)
+{
+    // A cache above is passing the line on, so as in Cache::recvAtomic()
+    // the request only goes on to invalidate the other copies
+    if (req.cacheResponding)
+        return memSidePort.sendWarmRequest(req);
+
+    CacheBlk *blk = tags->findBlock(req.addr, req.isSecure);
+    if (blk && (!req.needsWritable || blk->isSet(CacheBlk::WritableBit))) {
+        tags->warmTouch(blk);
+    } else {
+        // A miss, or an upgrade, fetched as by createMissPacket()
+        const bool clean = isReadOnly || clusivity == enums::mostly_excl;
+        const WarmResponse fill = memSidePort.sendWarmRequest(WarmRequest{
+            req.addr, req.isSecure, req.requestorId, req.needsWritable,
+            clean, false, false});
+        assert(fill.writable || !req.needsWritable);
+
+        if (!blk && allocOnFill(from_cache ? MemCmd::ReadSharedReq :
+                                MemCmd::ReadReq)) {
+            blk = warmAllocate(req.addr, req.isSecure, req.requestorId);
+        }
+        if (!blk) {
+            blk = tempBlock;
+            tempBlock->insert(req.addr, req.isSecure);
+        }
+
+        // The state of the fill, as in handleFill()
+        blk->setCoherenceBits(CacheBlk::ReadableBit);
+        if (fill.writable) {
+            blk->setCoherenceBits(CacheBlk::WritableBit);
+            if (fill.dirty)
+                blk->setCoherenceBits(CacheBlk::DirtyBit);
+        }
+    }
+
+    // Respond as satisfyRequest() would
+    WarmResponse resp{false, false};
+    if (!from_cache) {
+        if (req.needsWritable) {
+            assert(blk->isSet(CacheBlk::WritableBit));
+            blk->setCoherenceBits(CacheBlk::DirtyBit);
+        }
+    } else if (req.needsWritable ||
+               (blk->isSet(CacheBlk::WritableBit) && !req.hasSharers &&
+                !req.clean)) {
+        // The requestor gets the line writable, and takes ownership of
+        // it if it was dirty here
+        resp.writable = true;
+        if (blk->isSet(CacheBlk::DirtyBit)) {
+            resp.dirty = true;
+            blk->clearCoherenceBits(CacheBlk::DirtyBit);
+        }
+    }
+
+    if (blk != tempBlock) {
+        maintainClusivity(from_cache, blk);
+    } else if (!from_cache) {
+        warmEvictBlock(blk);
+    } else {
+        // The cache above keeps the line, so only dirty data is passed
+        // below, as by writebackTempBlockAtomic()
+        if (blk->isSet(CacheBlk::DirtyBit) || writebackClean) {
+            const bool dirty = blk->isSet(CacheBlk::DirtyBit);
+            memSidePort.sendWarmEvict(WarmEviction{req.addr, req.isSecure,
+                true, dirty, false, true});
+        }
+        invalidateBlock(blk);
+    }
+
+    return resp;
+}
+
+void
+BaseCache::warmEvict(const WarmEviction &evict)
+{
+    CacheBlk *blk = tags->findBlock(evict.addr, evict.isSecure);
+    if (blk)
+        tags->warmTouch(blk);
+
+    if (!evict.withData) {
+        // As in access(), a clean eviction stops at a cache with the line
+        if (!blk)
+            memSidePort.sendWarmEvict(evict);
+        return;
+    }
+
+    if (!blk) {
+        blk = warmAllocate(evict.addr, evict.isSecure, Request::wbRequestorId);
+        if (!blk) {
+            // No replaceable block, so pass the writeback on
+            memSidePort.sendWarmEvict(evict);
+            return;
+        }
+        blk->setCoherenceBits(CacheBlk::ReadableBit);
+    }
+
+    if (evict.dirty)
+        blk->setCoherenceBits(CacheBlk::DirtyBit);
+    if (evict.writable)
+        blk->setCoherenceBits(CacheBlk::WritableBit);
+}
+
+WarmSnoopResponse
+BaseCache::warmSnoop(const WarmSnoop &snoop)
+{
+    // As in handleSnoop(), the caches above are snooped first
+    WarmSnoopResponse resp{false, false, false};
+    if (forwardSnoops)
+        resp = cpuSidePort.sendWarmSnoop(snoop);
+
+    CacheBlk *blk = tags->findBlock(snoop.addr, snoop.isSecure);
+    if (!blk)
+        return resp;
+
+    resp.cached = true;
+    if (snoop.op == WarmSnoop::Op::Query)
+        return resp;
+
+    // The owner of a dirty line responds, unless one above already has
+    if (blk->isSet(CacheBlk::DirtyBit) && !resp.dirty) {
+        resp.dirty = true;
+        resp.writable = blk->isSet(CacheBlk::WritableBit);
+    }
+
+    if (snoop.op == WarmSnoop::Op::Downgrade)
+        blk->clearCoherenceBits(CacheBlk::WritableBit);
+    else
+        invalidateBlock(blk);
+
+    return resp;
+}
+
+CacheBlk *
+BaseCache::warmAllocate(Addr addr, bool is_secure, RequestorID requestor_id)
+{
+    std::vector<CacheBlk*> evict_blks;
+    CacheBlk *victim = tags->findVictim(addr, is_secure, blkSize * 8,
+                                        evict_blks);
+    if (!victim)
+        return nullptr;
+
+    for (CacheBlk *blk : evict_blks) {
+        if (blk->isValid())
+            warmEvictBlock(blk);
+    }
+
+    tags->warmInsert(addr, is_secure, requestor_id, victim);
+    victim->setWhenReady(curTick());
+
+    // Without data the block is stored uncompressed
+    if (compressor)
+        compressor->setSizeBits(victim, blkSize * 8);
+
+    dataStale = true;
+    return victim;
+}
+
+void
+BaseCache::warmEvictBlock(CacheBlk *blk)
+{
+    const bool dirty = blk->isSet(CacheBlk::DirtyBit);
+    WarmEviction evict{regenerateBlkAddr(blk), blk->isSecure(),
+                       dirty || writebackClean, dirty,
+                       blk->isSet(CacheBlk::WritableBit), false};
+    invalidateBlock(blk);
+
+    // As in doWritebacksAtomic(), only dirty data goes below if the line
+    // is still cached above
+    if (forwardSnoops) {
+        evict.blockCached = cpuSidePort.sendWarmSnoop(WarmSnoop{
+            evict.addr, evict.isSecure, WarmSnoop::Op::Query}).cached;
+    }
+    if (!evict.blockCached || evict.dirty)
+        memSidePort.sendWarmEvict(evict);
+}
+
 bool
 BaseCache::isDirty() const
 {
@@ -1814,7 +2057,7 @@ BaseCache::writebackVisitor(CacheBlk &blk)
     if (blk.isSet(CacheBlk::DirtyBit)) {
         assert(blk.isValid());
 
-        RequestPtr request = std::make_shared<Request>(
+        RequestPtr request = Request::make(
             regenerateBlkAddr(&blk), blkSize, 0, Request::funcRequestorId);
 
         request->taskId(blk.getTaskId());
@@ -2589,6 +2832,18 @@ BaseCache::CpuSidePort::recvFunctional(PacketPtr pkt)
     cache->functionalAccess(pkt, true);
 }
 
+WarmResponse
+BaseCache::CpuSidePort::recvWarmRequest(const WarmRequest &req)
+{
+    return cache->warmRequest(req, true);
+}
+
+void
+BaseCache::CpuSidePort::recvWarmEvict(const WarmEviction &evict)
+{
+    cache->warmEvict(evict);
+}
+
 AddrRangeList
 BaseCache::CpuSidePort::getAddrRanges() const
 {
@@ -2647,6 +2902,12 @@ BaseCache::MemSidePort::recvFunctionalSnoop(PacketPtr pkt)
     cache->functionalAccess(pkt, false);
 }
 
+WarmSnoopResponse
+BaseCache::MemSidePort::recvWarmSnoop(const WarmSnoop &snoop)
+{
+    return cache->warmSnoop(snoop);
+}
+
 void
 BaseCache::CacheReqPacketQueue::sendDeferredPacket()
 {
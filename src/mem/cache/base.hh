@@ -257,6 +257,8 @@ class BaseCache : public ClockedObject
 
         virtual void recvFunctionalSnoop(PacketPtr pkt);
 
+        virtual WarmSnoopResponse recvWarmSnoop(const WarmSnoop &snoop);
+
       public:
 
         MemSidePort(const std::string &_name, BaseCache *_cache,
@@ -326,6 +328,10 @@ class BaseCache : public ClockedObject
 
         virtual void recvFunctional(PacketPtr pkt) override;
 
+        virtual WarmResponse recvWarmRequest(const WarmRequest &req) override;
+
+        virtual void recvWarmEvict(const WarmEviction &evict) override;
+
         virtual AddrRangeList getAddrRanges() const override;
 
       public:
@@ -862,6 +868,44 @@ class BaseCache : public ClockedObject
      */
     virtual void memInvalidate() override;
 
+    /**
+     * @{
+     * @name Functional warming
+     * See warmAccess(). These mirror the handling of atomic requests and
+     * evictions from above and of atomic snoops from below, only for the
+     * tags and the coherence state of the blocks.
+     */
+    WarmResponse warmRequest(const WarmRequest &req, bool from_cache);
+    void warmEvict(const WarmEviction &evict);
+    WarmSnoopResponse warmSnoop(const WarmSnoop &snoop);
+    /** @} */
+
+    /**
+     * Allocate a block for a functionally warmed line, evicting the
+     * blocks it replaces.
+     *
+     * @param addr Address of the line.
+     * @param is_secure Whether the line is in the secure memory space.
+     * @param requestor_id The requestor the line is brought in for.
+     * @return The block, or nullptr if there is no replaceable block.
+     */
+    CacheBlk *warmAllocate(Addr addr, bool is_secure,
+                           RequestorID requestor_id);
+
+    /**
+     * Evict a block while functionally warming, sending the analog of
+     * the writeback or clean eviction evictBlock() would create below.
+     *
+     * @param blk Block to evict.
+     */
+    void warmEvictBlock(CacheBlk *blk);
+
+    /**
+     * Read the data of all valid blocks from memory.
+     * @sa dataStale
+     */
+    void refillFromMemory();
+
     /**
      * Determine if there are any dirty blocks in the cache.
      *
@@ -973,6 +1017,14 @@ class BaseCache : public ClockedObject
     /** Pointer to the MSHR that has no targets. */
     MSHR *noTargetMSHR;
 
+    /**
+     * Whether the data of the blocks may be stale, as they were
+     * functionally warmed or kept while the caches were bypassed. Memory
+     * is up to date while they are, so the data is read from it once
+     * the caches are used again.
+     */
+    bool dataStale;
+
     /** The number of misses to trigger an exit event. */
     Counter missCount;
 
@@ -1170,6 +1222,24 @@ class BaseCache : public ClockedObject
 
     const AddrRangeList &getAddrRanges() const { return addrRanges; }
 
+    /**
+     * Functionally warm the line of an access by a requestor without a
+     * cache, e.g. a CPU. The tags, replacement data and coherence state
+     * of the caches on the path to memory are updated as by an atomic
+     * access, without creating packets or moving data. This is only
+     * allowed while the caches are bypassed, and the data of the lines
+     * is read from memory once they are used again.
+     *
+     * @param addr Address of the access.
+     * @param is_secure Whether the access is to the secure memory space.
+     * @param is_write Whether the access writes the line.
+     * @param requestor_id The requestor of the access.
+     */
+    void warmAccess(Addr addr, bool is_secure, bool is_write,
+                    RequestorID requestor_id);
+
+    void drainResume() override;
+
     MSHR *allocateMissBuffer(PacketPtr pkt, Tick time, bool sched_send = true)
     {
         MSHR *mshr = mshrQueue.allocate(pkt->getBlockAddr(blkSize), blkSize,
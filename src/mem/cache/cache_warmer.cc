@@ -0,0 +1,53 @@
+#include "mem/cache/cache_warmer.hh"
+
+#include "mem/cache/base.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+CacheWarmer::CacheWarmer(const CacheWarmerParams &params)
+    : ProbeListenerObject(params),
+      icache(params.icache), dcache(params.dcache), system(params.system)
+{
+}
+
+void
+CacheWarmer::regProbeListeners()
+{
+    typedef ProbeListenerArg<CacheWarmer, probing::PacketInfo>
+        PacketListener;
+    listeners.push_back(new PacketListener(this, "PktRequest",
+                                           &CacheWarmer::warm));
+}
+
+void
+CacheWarmer::warm(const probing::PacketInfo &pkt_info)
+{
+    // Caches in use see the accesses themselves
+    if (!system->bypassCaches())
+        return;
+
+    const Request::Flags flags = pkt_info.flags;
+    BaseCache *cache = flags.isSet(Request::INST_FETCH) ? icache : dcache;
+    if (!cache || pkt_info.size == 0 ||
+        !(pkt_info.cmd.isRead() || pkt_info.cmd.isWrite())) {
+        return;
+    }
+
+    // Uncacheable accesses and those to devices never allocate
+    if (flags.isSet(Request::UNCACHEABLE | Request::STRICT_ORDER) ||
+        !system->isMemAddr(pkt_info.addr)) {
+        return;
+    }
+
+    const Addr blk_size = cache->getBlockSize();
+    const Addr last = pkt_info.addr + pkt_info.size - 1;
+    for (Addr addr = pkt_info.addr & ~(blk_size - 1); addr <= last;
+         addr += blk_size) {
+        cache->warmAccess(addr, flags.isSet(Request::SECURE),
+                          pkt_info.cmd.isWrite(), pkt_info.id);
+    }
+}
+
+} // namespace gem5
@@ -0,0 +1,46 @@
+/**
+ * @file
+ * Functional warming of a CPU's caches while it runs with the caches
+ * bypassed, e.g. during an atomic fast forward or between the samples of
+ * sampled simulation.  The warmer listens to the CPU's PktRequest probe
+ * point and warms the L1 caches with the address of each access, which
+ * then warm the rest of the hierarchy.
+ */
+
+#ifndef __MEM_CACHE_CACHE_WARMER_HH__
+#define __MEM_CACHE_CACHE_WARMER_HH__
+
+#include "params/CacheWarmer.hh"
+#include "sim/probe/mem.hh"
+#include "sim/probe/probe.hh"
+
+namespace gem5
+{
+
+class BaseCache;
+class System;
+
+class CacheWarmer : public ProbeListenerObject
+{
+  public:
+    CacheWarmer(const CacheWarmerParams &params);
+
+    void regProbeListeners() override;
+
+    /** Warm the cache an access would go to with the lines it spans */
+    void warm(const probing::PacketInfo &pkt_info);
+
+  protected:
+    /** The cache instruction fetches go to, if any */
+    BaseCache *const icache;
+
+    /** The cache loads and stores go to, if any */
+    BaseCache *const dcache;
+
+    /** Used to tell which accesses are to memory */
+    System *const system;
+};
+
+} // namespace gem5
+
+#endif // __MEM_CACHE_CACHE_WARMER_HH__
@@ -46,10 +46,17 @@ AssociativeSet<Entry>::AssociativeSet(int assoc, int num_entries,
              "AssociativeSet<> must be a power of 2");
     fatal_if(!isPowerOf2(assoc), "The associativity of an AssociativeSet<> "
              "must be a power of 2");
+
+    // Keep the replacement data in arrays per set, if the policies allow
+    const bool set_replacement = indexingPolicy->inSingleSet() &&
+        replacementPolicy->instantiateSets(indexingPolicy->getNumSets(),
+                                           indexingPolicy->getAssoc());
+
     for (unsigned int entry_idx = 0; entry_idx < numEntries; entry_idx += 1) {
         Entry* entry = &entries[entry_idx];
         indexingPolicy->setEntry(entry, entry_idx);
-        entry->replacementData = replacementPolicy->instantiateEntry();
+        if (!set_replacement)
+            entry->replacementData = replacementPolicy->instantiateEntry();
     }
 }
 
@@ -58,8 +65,9 @@ Entry*
 AssociativeSet<Entry>::findEntry(Addr addr, bool is_secure) const
 {
     Addr tag = indexingPolicy->extractTag(addr);
-    const std::vector<ReplaceableEntry*> selected_entries =
-        indexingPolicy->getPossibleEntries(addr);
+    std::vector<ReplaceableEntry*> scratch;
+    const std::vector<ReplaceableEntry*> &selected_entries =
+        indexingPolicy->getPossibleEntries(addr, scratch);
 
     for (const auto& location : selected_entries) {
         Entry* entry = static_cast<Entry *>(location);
@@ -75,7 +83,7 @@ template<class Entry>
 void
 AssociativeSet<Entry>::accessEntry(Entry *entry)
 {
-    replacementPolicy->touch(entry->replacementData);
+    replacementPolicy->touch(entry);
 }
 
 template<class Entry>
@@ -83,9 +91,10 @@ Entry*
 AssociativeSet<Entry>::findVictim(Addr addr)
 {
     // Get possible entries to be victimized
-    const std::vector<ReplaceableEntry*> selected_entries =
-        indexingPolicy->getPossibleEntries(addr);
-    Entry* victim = static_cast<Entry*>(replacementPolicy->getVictim(
+    std::vector<ReplaceableEntry*> scratch;
+    const std::vector<ReplaceableEntry*> &selected_entries =
+        indexingPolicy->getPossibleEntries(addr, scratch);
+    Entry* victim = static_cast<Entry*>(replacementPolicy->selectVictim(
                             selected_entries));
     // There is only one eviction for this replacement
     invalidate(victim);
@@ -97,8 +106,9 @@ template<class Entry>
 std::vector<Entry *>
 AssociativeSet<Entry>::getPossibleEntries(const Addr addr) const
 {
-    std::vector<ReplaceableEntry *> selected_entries =
-        indexingPolicy->getPossibleEntries(addr);
+    std::vector<ReplaceableEntry *> scratch;
+    const std::vector<ReplaceableEntry *> &selected_entries =
+        indexingPolicy->getPossibleEntries(addr, scratch);
     std::vector<Entry *> entries(selected_entries.size(), nullptr);
 
     unsigned int idx = 0;
@@ -113,7 +123,7 @@ void
 AssociativeSet<Entry>::insertEntry(Addr addr, bool is_secure, Entry* entry)
 {
    entry->insert(indexingPolicy->extractTag(addr), is_secure);
-   replacementPolicy->reset(entry->replacementData);
+   replacementPolicy->reset(entry);
 }
 
 template<class Entry>
@@ -121,7 +131,7 @@ void
 AssociativeSet<Entry>::invalidate(Entry* entry)
 {
     entry->invalidate();
-    replacementPolicy->invalidate(entry->replacementData);
+    replacementPolicy->invalidate(entry);
 }
 
 } // namespace gem5
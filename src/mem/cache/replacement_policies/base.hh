@@ -29,9 +29,13 @@
 #ifndef __MEM_CACHE_REPLACEMENT_POLICIES_BASE_HH__
 #define __MEM_CACHE_REPLACEMENT_POLICIES_BASE_HH__
 
+#include <cassert>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "base/compiler.hh"
+#include "base/logging.hh"
 #include "mem/cache/replacement_policies/replaceable_entry.hh"
 #include "mem/packet.hh"
 #include "params/BaseReplacementPolicy.hh"
@@ -49,6 +53,45 @@ GEM5_DEPRECATED_NAMESPACE(ReplacementPolicy, replacement_policy);
 namespace replacement_policy
 {
 
+/**
+ * The replacement data of all the entries of a table, kept by a policy in
+ * an array per set instead of by each entry. The data of the ways of a set
+ * are contiguous, so choosing a victim reads one or two host cache lines
+ * rather than following a pointer to each candidate's data.
+ */
+template <typename T>
+class SetArray
+{
+  public:
+    /** Whether the array holds the data of a table */
+    bool initialized() const { return !data.empty(); }
+
+    /**
+     * Size the array for a table, and set all its data.
+     *
+     * @param num_sets The number of sets of the table.
+     * @param assoc The number of ways of each set.
+     * @param value The initial data of each entry.
+     */
+    void
+    init(uint32_t num_sets, uint32_t assoc, const T &value)
+    {
+        _assoc = assoc;
+        data.assign(num_sets * assoc, value);
+    }
+
+    /** The number of ways of each set */
+    uint32_t assoc() const { return _assoc; }
+
+    /** The data of a set, indexed by way */
+    T *operator[](uint32_t set) { return &data[set * _assoc]; }
+    const T *operator[](uint32_t set) const { return &data[set * _assoc]; }
+
+  private:
+    uint32_t _assoc = 0;
+    std::vector<T> data;
+};
+
 /**
  * A common base class of cache replacement policy objects.
  */
@@ -95,6 +138,30 @@ class Base : public SimObject
     virtual void reset(const std::shared_ptr<ReplacementData>&
         replacement_data) const = 0;
 
+    /**
+     * @{
+     * Update or reset replacement data for an access known only by its
+     * address, as a functionally warmed one is. Policies that use more of
+     * the packet of an access must make do with the address.
+     *
+     * @param replacement_data Replacement data to be updated.
+     * @param addr Address of the access.
+     */
+    virtual void
+    warmTouch(const std::shared_ptr<ReplacementData>& replacement_data,
+        Addr addr)
+    {
+        touch(replacement_data);
+    }
+
+    virtual void
+    warmReset(const std::shared_ptr<ReplacementData>& replacement_data,
+        Addr addr)
+    {
+        reset(replacement_data);
+    }
+    /** @} */
+
     /**
      * Find replacement victim among candidates.
      *
@@ -110,6 +177,155 @@ class Base : public SimObject
      * @return A shared pointer to the new replacement data.
      */
     virtual std::shared_ptr<ReplacementData> instantiateEntry() = 0;
+
+    /**
+     * Instantiate the replacement data of all the entries of a table at
+     * once, in arrays per set kept by the policy. Entries are then referred
+     * to by their set and way, and have no replacement data of their own.
+     * This is only valid for tables whose replacement candidates are always
+     * all the ways of a single set, in order.
+     *
+     * @param num_sets The number of sets of the table.
+     * @param assoc The number of ways of each set.
+     * @return Whether the policy keeps the data of the table; if not, each
+     *         entry must instantiate its own.
+     */
+    virtual bool
+    instantiateSets(uint32_t num_sets, uint32_t assoc)
+    {
+        return false;
+    }
+
+    /**
+     * @{
+     * Set granular versions of the functions above, for the entries of a
+     * table instantiated with instantiateSets().
+     *
+     * @param set The set of the entry.
+     * @param way The way of the entry.
+     * @param pkt Packet that generated this access, or nullptr if unknown.
+     */
+    virtual void
+    invalidate(uint32_t set, uint32_t way)
+    {
+        panic("%s doesn't keep replacement data by set", name());
+    }
+
+    virtual void
+    touch(uint32_t set, uint32_t way, const PacketPtr pkt)
+    {
+        panic("%s doesn't keep replacement data by set", name());
+    }
+
+    virtual void
+    reset(uint32_t set, uint32_t way, const PacketPtr pkt)
+    {
+        panic("%s doesn't keep replacement data by set", name());
+    }
+
+    virtual void
+    warmTouch(uint32_t set, uint32_t way, Addr addr)
+    {
+        touch(set, way, nullptr);
+    }
+
+    virtual void
+    warmReset(uint32_t set, uint32_t way, Addr addr)
+    {
+        reset(set, way, nullptr);
+    }
+    /** @} */
+
+    /**
+     * Find replacement victim among the ways of a set of a table
+     * instantiated with instantiateSets().
+     *
+     * @param set The set to find a victim in.
+     * @return The way to be replaced.
+     */
+    virtual uint32_t
+    getVictim(uint32_t set)
+    {
+        panic("%s doesn't keep replacement data by set", name());
+    }
+
+    /**
+     * @{
+     * Update the replacement data of an entry, or find a victim among
+     * entries, whether their data are their own or kept by set.
+     */
+    void
+    invalidate(const ReplaceableEntry *entry)
+    {
+        if (entry->replacementData)
+            invalidate(entry->replacementData);
+        else
+            invalidate(entry->getSet(), entry->getWay());
+    }
+
+    void
+    touch(const ReplaceableEntry *entry, const PacketPtr pkt)
+    {
+        if (entry->replacementData)
+            touch(entry->replacementData, pkt);
+        else
+            touch(entry->getSet(), entry->getWay(), pkt);
+    }
+
+    void
+    touch(const ReplaceableEntry *entry)
+    {
+        if (entry->replacementData)
+            touch(entry->replacementData);
+        else
+            touch(entry->getSet(), entry->getWay(), nullptr);
+    }
+
+    void
+    reset(const ReplaceableEntry *entry, const PacketPtr pkt)
+    {
+        if (entry->replacementData)
+            reset(entry->replacementData, pkt);
+        else
+            reset(entry->getSet(), entry->getWay(), pkt);
+    }
+
+    void
+    reset(const ReplaceableEntry *entry)
+    {
+        if (entry->replacementData)
+            reset(entry->replacementData);
+        else
+            reset(entry->getSet(), entry->getWay(), nullptr);
+    }
+
+    void
+    warmTouch(const ReplaceableEntry *entry, Addr addr)
+    {
+        if (entry->replacementData)
+            warmTouch(entry->replacementData, addr);
+        else
+            warmTouch(entry->getSet(), entry->getWay(), addr);
+    }
+
+    void
+    warmReset(const ReplaceableEntry *entry, Addr addr)
+    {
+        if (entry->replacementData)
+            warmReset(entry->replacementData, addr);
+        else
+            warmReset(entry->getSet(), entry->getWay(), addr);
+    }
+
+    ReplaceableEntry*
+    selectVictim(const ReplacementCandidates& candidates)
+    {
+        assert(candidates.size() > 0);
+        if (candidates[0]->replacementData)
+            return getVictim(candidates);
+        return candidates[getVictim(candidates[0]->getSet())];
+    }
+    /** @} */
 };
 
 } // namespace replacement_policy
@@ -61,5 +61,16 @@ BIP::reset(const std::shared_ptr<ReplacementData>& replacement_data) const
     }
 }
 
+void
+BIP::reset(uint32_t set, uint32_t way, const PacketPtr pkt)
+{
+    // Entries are inserted as MRU if lower than btp, LRU otherwise
+    if (random_mt.random<unsigned>(1, 100) <= btp) {
+        lastTouchTicks[set][way] = curTick();
+    } else {
+        lastTouchTicks[set][way] = 1;
+    }
+}
+
 } // namespace replacement_policy
 } // namespace gem5
@@ -76,6 +76,7 @@ class BIP : public LRU
      */
     void reset(const std::shared_ptr<ReplacementData>& replacement_data) const
                                                                      override;
+    void reset(uint32_t set, uint32_t way, const PacketPtr pkt) override;
 };
 
 } // namespace replacement_policy
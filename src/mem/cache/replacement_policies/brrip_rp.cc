@@ -28,9 +28,11 @@
 
 #include "mem/cache/replacement_policies/brrip_rp.hh"
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 
+#include "base/bitfield.hh"
 #include "base/logging.hh" // For fatal_if
 #include "base/random.hh"
 #include "params/BRRIPRP.hh"
@@ -44,9 +46,10 @@ namespace replacement_policy
 
 BRRIP::BRRIP(const Params &p)
   : Base(p), numRRPVBits(p.num_bits), hitPriority(p.hit_priority),
-    btp(p.btp)
+    btp(p.btp), maxRRPV(mask(numRRPVBits))
 {
     fatal_if(numRRPVBits <= 0, "There should be at least one bit per RRPV.\n");
+    fatal_if(numRRPVBits > 8, "There should be at most 8 bits per RRPV.\n");
 }
 
 void
@@ -148,5 +151,72 @@ BRRIP::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new BRRIPReplData(numRRPVBits));
 }
 
+bool
+BRRIP::instantiateSets(uint32_t num_sets, uint32_t assoc)
+{
+    if (setEntries.initialized())
+        return false;
+
+    setEntries.init(num_sets, assoc, SetEntry{0, false});
+    return true;
+}
+
+void
+BRRIP::invalidate(uint32_t set, uint32_t way)
+{
+    setEntries[set][way].valid = false;
+}
+
+void
+BRRIP::touch(uint32_t set, uint32_t way, const PacketPtr pkt)
+{
+    uint8_t &rrpv = setEntries[set][way].rrpv;
+    if (hitPriority) {
+        rrpv = 0;
+    } else if (rrpv > 0) {
+        rrpv--;
+    }
+}
+
+void
+BRRIP::reset(uint32_t set, uint32_t way, const PacketPtr pkt)
+{
+    SetEntry &entry = setEntries[set][way];
+    entry.rrpv = maxRRPV;
+    if (random_mt.random<unsigned>(1, 100) <= btp) {
+        entry.rrpv--;
+    }
+    entry.valid = true;
+}
+
+uint32_t
+BRRIP::getVictim(uint32_t set)
+{
+    SetEntry *entries = setEntries[set];
+    const uint32_t assoc = setEntries.assoc();
+
+    // The first invalid way, or else the first way with the highest RRPV
+    uint32_t victim = 0;
+    for (uint32_t way = 0; way < assoc; ++way) {
+        if (!entries[way].valid) {
+            return way;
+        }
+        if (entries[way].rrpv > entries[victim].rrpv) {
+            victim = way;
+        }
+    }
+
+    // Age all the ways until the victim's RRPV saturates
+    const uint8_t diff = maxRRPV - entries[victim].rrpv;
+    if (diff > 0) {
+        for (uint32_t way = 0; way < assoc; ++way) {
+            entries[way].rrpv = std::min<unsigned>(
+                entries[way].rrpv + diff, maxRRPV);
+        }
+    }
+
+    return victim;
+}
+
 } // namespace replacement_policy
 } // namespace gem5
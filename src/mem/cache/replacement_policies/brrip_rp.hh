@@ -112,6 +112,22 @@ class BRRIP : public Base
      */
     const unsigned btp;
 
+    /** The replacement data of an entry, when kept by set. */
+    struct SetEntry
+    {
+        /** Re-Reference Interval Prediction Value, as in BRRIPReplData. */
+        uint8_t rrpv;
+
+        /** Whether the entry is valid. */
+        bool valid;
+    };
+
+    /** The data of each entry of a table, when kept by set. */
+    SetArray<SetEntry> setEntries;
+
+    /** The most distant re-reference interval, i.e. a saturated RRPV. */
+    const uint8_t maxRRPV;
+
   public:
     typedef BRRIPRPParams Params;
     BRRIP(const Params &p);
@@ -158,6 +174,17 @@ class BRRIP : public Base
      * @return A shared pointer to the new replacement data.
      */
     std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    /**
+     * Keep the RRPVs of a table in an array per set. Only one table's data
+     * can be kept by set.
+     */
+    bool instantiateSets(uint32_t num_sets, uint32_t assoc) override;
+
+    void invalidate(uint32_t set, uint32_t way) override;
+    void touch(uint32_t set, uint32_t way, const PacketPtr pkt) override;
+    void reset(uint32_t set, uint32_t way, const PacketPtr pkt) override;
+    uint32_t getVictim(uint32_t set) override;
 };
 
 } // namespace replacement_policy
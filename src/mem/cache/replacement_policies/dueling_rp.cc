@@ -106,6 +106,29 @@ Dueling::reset(const std::shared_ptr<ReplacementData>& replacement_data) const
     duelingMonitor.sample(static_cast<Dueler*>(casted_replacement_data.get()));
 }
 
+void
+Dueling::warmTouch(const std::shared_ptr<ReplacementData>& replacement_data,
+    Addr addr)
+{
+    std::shared_ptr<DuelerReplData> casted_replacement_data =
+        std::static_pointer_cast<DuelerReplData>(replacement_data);
+    replPolicyA->warmTouch(casted_replacement_data->replDataA, addr);
+    replPolicyB->warmTouch(casted_replacement_data->replDataB, addr);
+}
+
+void
+Dueling::warmReset(const std::shared_ptr<ReplacementData>& replacement_data,
+    Addr addr)
+{
+    std::shared_ptr<DuelerReplData> casted_replacement_data =
+        std::static_pointer_cast<DuelerReplData>(replacement_data);
+    replPolicyA->warmReset(casted_replacement_data->replDataA, addr);
+    replPolicyB->warmReset(casted_replacement_data->replDataB, addr);
+
+    // A warmed miss is a sample to the duel too
+    duelingMonitor.sample(static_cast<Dueler*>(casted_replacement_data.get()));
+}
+
 ReplaceableEntry*
 Dueling::getVictim(const ReplacementCandidates& candidates) const
 {
@@ -108,6 +108,10 @@ class Dueling : public Base
         const PacketPtr pkt) override;
     void reset(const std::shared_ptr<ReplacementData>& replacement_data) const
                                                                      override;
+    void warmTouch(const std::shared_ptr<ReplacementData>& replacement_data,
+        Addr addr) override;
+    void warmReset(const std::shared_ptr<ReplacementData>& replacement_data,
+        Addr addr) override;
     ReplaceableEntry* getVictim(const ReplacementCandidates& candidates) const
                                                                      override;
     std::shared_ptr<ReplacementData> instantiateEntry() override;
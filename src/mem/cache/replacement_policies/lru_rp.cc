@@ -97,5 +97,46 @@ LRU::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new LRUReplData());
 }
 
+bool
+LRU::instantiateSets(uint32_t num_sets, uint32_t assoc)
+{
+    if (lastTouchTicks.initialized())
+        return false;
+
+    lastTouchTicks.init(num_sets, assoc, Tick(0));
+    return true;
+}
+
+void
+LRU::invalidate(uint32_t set, uint32_t way)
+{
+    lastTouchTicks[set][way] = Tick(0);
+}
+
+void
+LRU::touch(uint32_t set, uint32_t way, const PacketPtr pkt)
+{
+    lastTouchTicks[set][way] = curTick();
+}
+
+void
+LRU::reset(uint32_t set, uint32_t way, const PacketPtr pkt)
+{
+    lastTouchTicks[set][way] = curTick();
+}
+
+uint32_t
+LRU::getVictim(uint32_t set)
+{
+    // The first of the least recently touched ways, as with candidates
+    const Tick *ticks = lastTouchTicks[set];
+    uint32_t victim = 0;
+    for (uint32_t way = 1; way < lastTouchTicks.assoc(); ++way) {
+        if (ticks[way] < ticks[victim])
+            victim = way;
+    }
+    return victim;
+}
+
 } // namespace replacement_policy
 } // namespace gem5
@@ -61,6 +61,9 @@ class LRU : public Base
         LRUReplData() : lastTouchTick(0) {}
     };
 
+    /** The tick on which each entry was last touched, when kept by set. */
+    SetArray<Tick> lastTouchTicks;
+
   public:
     typedef LRURPParams Params;
     LRU(const Params &p);
@@ -108,6 +111,17 @@ class LRU : public Base
      * @return A shared pointer to the new replacement data.
      */
     std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    /**
+     * Keep the last touch ticks of a table in an array per set. Only one
+     * table's data can be kept by set.
+     */
+    bool instantiateSets(uint32_t num_sets, uint32_t assoc) override;
+
+    void invalidate(uint32_t set, uint32_t way) override;
+    void touch(uint32_t set, uint32_t way, const PacketPtr pkt) override;
+    void reset(uint32_t set, uint32_t way, const PacketPtr pkt) override;
+    uint32_t getVictim(uint32_t set) override;
 };
 
 } // namespace replacement_policy
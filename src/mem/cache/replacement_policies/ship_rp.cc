@@ -91,21 +91,35 @@ SHiP::invalidate(const std::shared_ptr<ReplacementData>& replacement_data)
 }
 
 void
-SHiP::touch(const std::shared_ptr<ReplacementData>& replacement_data,
-    const PacketPtr pkt)
+SHiP::hit(const std::shared_ptr<ReplacementData>& replacement_data,
+    SignatureType signature)
 {
     std::shared_ptr<SHiPReplData> casted_replacement_data =
         std::static_pointer_cast<SHiPReplData>(replacement_data);
 
     // When a hit happens the SHCT entry indexed by the signature is
     // incremented
-    SHCT[getSignature(pkt)]++;
+    SHCT[signature]++;
     casted_replacement_data->setReReferenced();
 
     // This was a hit; update replacement data accordingly
     BRRIP::touch(replacement_data);
 }
 
+void
+SHiP::touch(const std::shared_ptr<ReplacementData>& replacement_data,
+    const PacketPtr pkt)
+{
+    hit(replacement_data, getSignature(pkt));
+}
+
+void
+SHiP::warmTouch(const std::shared_ptr<ReplacementData>& replacement_data,
+    Addr addr)
+{
+    hit(replacement_data, getSignature(addr));
+}
+
 void
 SHiP::touch(const std::shared_ptr<ReplacementData>& replacement_data)
     const
@@ -114,15 +128,12 @@ SHiP::touch(const std::shared_ptr<ReplacementData>& replacement_data)
 }
 
 void
-SHiP::reset(const std::shared_ptr<ReplacementData>& replacement_data,
-    const PacketPtr pkt)
+SHiP::insert(const std::shared_ptr<ReplacementData>& replacement_data,
+    SignatureType signature)
 {
     std::shared_ptr<SHiPReplData> casted_replacement_data =
         std::static_pointer_cast<SHiPReplData>(replacement_data);
 
-    // Get signature
-    const SignatureType signature = getSignature(pkt);
-
     // Store signature
     casted_replacement_data->setSignature(signature);
 
@@ -134,6 +145,20 @@ SHiP::reset(const std::shared_ptr<ReplacementData>& replacement_data,
     }
 }
 
+void
+SHiP::reset(const std::shared_ptr<ReplacementData>& replacement_data,
+    const PacketPtr pkt)
+{
+    insert(replacement_data, getSignature(pkt));
+}
+
+void
+SHiP::warmReset(const std::shared_ptr<ReplacementData>& replacement_data,
+    Addr addr)
+{
+    insert(replacement_data, getSignature(addr));
+}
+
 void
 SHiP::reset(const std::shared_ptr<ReplacementData>& replacement_data)
     const
@@ -147,12 +172,86 @@ SHiP::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new SHiPReplData(numRRPVBits));
 }
 
+bool
+SHiP::instantiateSets(uint32_t num_sets, uint32_t assoc)
+{
+    if (!BRRIP::instantiateSets(num_sets, assoc))
+        return false;
+
+    insertions.init(num_sets, assoc, Insertion{0, false});
+    return true;
+}
+
+void
+SHiP::invalidate(uint32_t set, uint32_t way)
+{
+    const Insertion &insertion = insertions[set][way];
+    if (insertion.outcome) {
+        SHCT[insertion.signature]--;
+    }
+
+    BRRIP::invalidate(set, way);
+}
+
+void
+SHiP::hit(uint32_t set, uint32_t way, SignatureType signature)
+{
+    SHCT[signature]++;
+    insertions[set][way].outcome = true;
+
+    BRRIP::touch(set, way, nullptr);
+}
+
+void
+SHiP::insert(uint32_t set, uint32_t way, SignatureType signature)
+{
+    insertions[set][way] = Insertion{signature, false};
+
+    BRRIP::reset(set, way, nullptr);
+    uint8_t &rrpv = setEntries[set][way].rrpv;
+    if (SHCT[signature].calcSaturation() >= insertionThreshold && rrpv > 0) {
+        rrpv--;
+    }
+}
+
+void
+SHiP::touch(uint32_t set, uint32_t way, const PacketPtr pkt)
+{
+    panic_if(!pkt, "Cant train SHiP's predictor without access information.");
+    hit(set, way, getSignature(pkt));
+}
+
+void
+SHiP::reset(uint32_t set, uint32_t way, const PacketPtr pkt)
+{
+    panic_if(!pkt, "Cant train SHiP's predictor without access information.");
+    insert(set, way, getSignature(pkt));
+}
+
+void
+SHiP::warmTouch(uint32_t set, uint32_t way, Addr addr)
+{
+    hit(set, way, getSignature(addr));
+}
+
+void
+SHiP::warmReset(uint32_t set, uint32_t way, Addr addr)
+{
+    insert(set, way, getSignature(addr));
+}
+
 SHiPMem::SHiPMem(const SHiPMemRPParams &p) : SHiP(p) {}
 
 SHiP::SignatureType
 SHiPMem::getSignature(const PacketPtr pkt) const
 {
-    return static_cast<SignatureType>(pkt->getAddr() % SHCT.size());
+    return getSignature(pkt->getAddr());
+}
+
+SHiP::SignatureType
+SHiPMem::getSignature(Addr addr) const
+{
+    return static_cast<SignatureType>(addr % SHCT.size());
 }
 
 SHiPPC::SHiPPC(const SHiPPCRPParams &p) : SHiP(p) {}
@@ -171,5 +270,11 @@ SHiPPC::getSignature(const PacketPtr pkt) const
     return signature % SHCT.size();
 }
 
+SHiP::SignatureType
+SHiPPC::getSignature(Addr addr) const
+{
+    return NO_PC_SIGNATURE % SHCT.size();
+}
+
 } // namespace replacement_policy
 } // namespace gem5
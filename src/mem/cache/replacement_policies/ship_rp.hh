@@ -107,6 +107,19 @@ class SHiP : public BRRIP
      */
     std::vector<SatCounter8> SHCT;
 
+    /** The insertion of an entry, when kept by set. */
+    struct Insertion
+    {
+        /** Signature that caused the insertion of this entry. */
+        SignatureType signature;
+
+        /** Outcome of insertion; set to one if entry is re-referenced. */
+        bool outcome;
+    };
+
+    /** The insertion of each entry of a table, when kept by set. */
+    SetArray<Insertion> insertions;
+
     /**
      * Extract signature from packet.
      *
@@ -115,6 +128,27 @@ class SHiP : public BRRIP
      */
     virtual SignatureType getSignature(const PacketPtr pkt) const = 0;
 
+    /**
+     * Extract signature from the address of an access without a packet.
+     *
+     * @param addr The address of the access.
+     * @return The signature extracted.
+     */
+    virtual SignatureType getSignature(Addr addr) const = 0;
+
+    /**
+     * @{
+     * Train the predictor with a hit or an insertion of the given
+     * signature, and update the RRPV of the entry accordingly.
+     */
+    void hit(const std::shared_ptr<ReplacementData>& replacement_data,
+        SignatureType signature);
+    void insert(const std::shared_ptr<ReplacementData>& replacement_data,
+        SignatureType signature);
+    void hit(uint32_t set, uint32_t way, SignatureType signature);
+    void insert(uint32_t set, uint32_t way, SignatureType signature);
+    /** @} */
+
   public:
     typedef SHiPRPParams Params;
     SHiP(const Params &p);
@@ -153,12 +187,33 @@ class SHiP : public BRRIP
     void reset(const std::shared_ptr<ReplacementData>& replacement_data) const
         override;
 
+    /**
+     * Functionally warmed accesses are trained with the signature of
+     * their address.
+     */
+    void warmTouch(const std::shared_ptr<ReplacementData>& replacement_data,
+        Addr addr) override;
+    void warmReset(const std::shared_ptr<ReplacementData>& replacement_data,
+        Addr addr) override;
+
     /**
      * Instantiate a replacement data entry.
      *
      * @return A shared pointer to the new replacement data.
      */
     std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    /**
+     * Keep the RRPVs and the insertions of a table in arrays per set. Only
+     * one table's data can be kept by set.
+     */
+    bool instantiateSets(uint32_t num_sets, uint32_t assoc) override;
+
+    void invalidate(uint32_t set, uint32_t way) override;
+    void touch(uint32_t set, uint32_t way, const PacketPtr pkt) override;
+    void reset(uint32_t set, uint32_t way, const PacketPtr pkt) override;
+    void warmTouch(uint32_t set, uint32_t way, Addr addr) override;
+    void warmReset(uint32_t set, uint32_t way, Addr addr) override;
 };
 
 /** SHiP that Uses memory addresses as signatures. */
@@ -166,6 +221,7 @@ class SHiPMem : public SHiP
 {
   protected:
     SignatureType getSignature(const PacketPtr pkt) const override;
+    SignatureType getSignature(Addr addr) const override;
 
   public:
     SHiPMem(const SHiPMemRPParams &p);
@@ -182,6 +238,9 @@ class SHiPPC : public SHiP
   protected:
     SignatureType getSignature(const PacketPtr pkt) const override;
 
+    /** An access without a packet has no PC */
+    SignatureType getSignature(Addr addr) const override;
+
   public:
     SHiPPC(const SHiPPCRPParams &p);
     ~SHiPPC() = default;
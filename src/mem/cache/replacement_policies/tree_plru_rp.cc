@@ -36,6 +36,7 @@
 
 #include <cmath>
 
+#include "base/bitfield.hh"
 #include "base/intmath.hh"
 #include "base/logging.hh"
 #include "params/TreePLRURP.hh"
@@ -215,5 +216,61 @@ TreePLRU::instantiateEntry()
     return std::shared_ptr<ReplacementData>(treePLRUReplData);
 }
 
+void
+TreePLRU::updatePath(uint64_t &tree, uint32_t way, bool towards) const
+{
+    uint64_t tree_index = way + numLeaves - 1;
+    while (tree_index != 0) {
+        const bool right = isRightSubtree(tree_index);
+        tree_index = parentIndex(tree_index);
+        replaceBits(tree, tree_index, right == towards);
+    }
+}
+
+bool
+TreePLRU::instantiateSets(uint32_t num_sets, uint32_t assoc)
+{
+    if (trees.initialized() || assoc != numLeaves || numLeaves > 64)
+        return false;
+
+    // A single tree per set
+    trees.init(num_sets, 1, 0);
+    return true;
+}
+
+void
+TreePLRU::invalidate(uint32_t set, uint32_t way)
+{
+    updatePath(trees[set][0], way, true);
+}
+
+void
+TreePLRU::touch(uint32_t set, uint32_t way, const PacketPtr pkt)
+{
+    updatePath(trees[set][0], way, false);
+}
+
+void
+TreePLRU::reset(uint32_t set, uint32_t way, const PacketPtr pkt)
+{
+    // A reset has the same functionality of a touch
+    touch(set, way, pkt);
+}
+
+uint32_t
+TreePLRU::getVictim(uint32_t set)
+{
+    const uint64_t tree = trees[set][0];
+    uint64_t tree_index = 0;
+    while (tree_index < numLeaves - 1) {
+        if (bits(tree, tree_index)) {
+            tree_index = rightSubtreeIndex(tree_index);
+        } else {
+            tree_index = leftSubtreeIndex(tree_index);
+        }
+    }
+    return tree_index - (numLeaves - 1);
+}
+
 } // namespace replacement_policy
 } // namespace gem5
@@ -125,6 +125,22 @@ class TreePLRU : public Base
      */
     PLRUTree* treeInstance;
 
+    /**
+     * The tree of each set of a table, when kept by set, with the bit of
+     * each node at its index.
+     */
+    SetArray<uint64_t> trees;
+
+    /**
+     * Point the nodes on the path from a leaf to the root towards, or away
+     * from, the leaf.
+     *
+     * @param tree The tree of the leaf's set.
+     * @param way The way of the leaf.
+     * @param towards Whether to make the leaf the LRU, rather than the MRU.
+     */
+    void updatePath(uint64_t &tree, uint32_t way, bool towards) const;
+
   protected:
     /**
      * Tree-PLRU-specific implementation of replacement data. Each replacement
@@ -208,6 +224,18 @@ class TreePLRU : public Base
      * @return A shared pointer to the new replacement data.
      */
     std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    /**
+     * Keep a tree of bits per set of a table. Only one table's data can be
+     * kept by set, and only if its sets have as many ways as each tree has
+     * leaves.
+     */
+    bool instantiateSets(uint32_t num_sets, uint32_t assoc) override;
+
+    void invalidate(uint32_t set, uint32_t way) override;
+    void touch(uint32_t set, uint32_t way, const PacketPtr pkt) override;
+    void reset(uint32_t set, uint32_t way, const PacketPtr pkt) override;
+    uint32_t getVictim(uint32_t set) override;
 };
 
 } // namespace replacement_policy
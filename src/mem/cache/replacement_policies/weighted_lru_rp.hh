@@ -76,6 +76,13 @@ class WeightedLRU : public LRU
      */
     std::shared_ptr<ReplacementData> instantiateEntry() override;
 
+    /** The occupancies are only kept by entry, so neither are the ticks. */
+    bool
+    instantiateSets(uint32_t num_sets, uint32_t assoc) override
+    {
+        return false;
+    }
+
     /**
      * Find replacement victim using weight.
      *
@@ -76,30 +76,35 @@ BaseTags::findBlockBySetAndWay(int set, int way) const
     return indexingPolicy->getEntry(set, way);
 }
 
-CacheBlk*
-BaseTags::findBlock(Addr addr, bool is_secure) const
+void
+BaseTags::initTagStore()
 {
-    // Extract block tag
-    Addr tag = extractTag(addr);
-
-    // Find possible entries that may contain the given address
-    const std::vector<ReplaceableEntry*> entries =
-        indexingPolicy->getPossibleEntries(addr);
-
-    // Search for block
-    for (const auto& location : entries) {
-        CacheBlk* blk = static_cast<CacheBlk*>(location);
-        if (blk->matchTag(tag, is_secure)) {
-            return blk;
+    if (!indexingPolicy->inSingleSet() ||
+        indexingPolicy->getAssoc() > TagStore::maxAssoc) {
+        return;
+    }
+
+    tagStore.reset(new TagStore(indexingPolicy->getNumSets(),
+                                indexingPolicy->getAssoc()));
+    for (uint32_t set = 0; set < indexingPolicy->getNumSets(); ++set) {
+        for (unsigned way = 0; way < indexingPolicy->getAssoc(); ++way) {
+            tagStore->addEntry(static_cast<TaggedEntry *>(
+                indexingPolicy->getEntry(set, way)));
         }
     }
+}
 
-    // Did not find block
-    return nullptr;
+CacheBlk*
+BaseTags::findBlock(Addr addr, bool is_secure) const
+{
+    // Any valid entry holding the tag is the block
+    return static_cast<CacheBlk*>(findMatchingEntry(addr, is_secure,
+        [](ReplaceableEntry *entry) { return true; }));
 }
 
 void
-BaseTags::insertBlock(const PacketPtr pkt, CacheBlk *blk)
+BaseTags::insertTag(Addr addr, bool is_secure, RequestorID requestor_id,
+                    uint32_t task_id, CacheBlk *blk)
 {
     assert(!blk->isValid());
 
@@ -107,25 +112,38 @@ BaseTags::insertBlock(const PacketPtr pkt, CacheBlk *blk)
     // to insert the new one
 
     // Deal with what we are bringing in
-    RequestorID requestor_id = pkt->req->requestorId();
     assert(requestor_id < system->maxRequestors());
     stats.occupancies[requestor_id]++;
 
     // Insert block with tag, src requestor id and task id
-    blk->insert(extractTag(pkt->getAddr()), pkt->isSecure(), requestor_id,
-                pkt->req->taskId());
+    blk->insert(extractTag(addr), is_secure, requestor_id, task_id);
 
     // Check if cache warm up is done
     if (!warmedUp && stats.tagsInUse.value() >= warmupBound) {
         warmedUp = true;
         stats.warmupTick = curTick();
     }
+}
+
+void
+BaseTags::insertBlock(const PacketPtr pkt, CacheBlk *blk)
+{
+    insertTag(pkt->getAddr(), pkt->isSecure(), pkt->req->requestorId(),
+              pkt->req->taskId(), blk);
 
     // We only need to write into one tag and one data block.
     stats.tagAccesses += 1;
     stats.dataAccesses += 1;
 }
 
+void
+BaseTags::warmInsert(Addr addr, bool is_secure, RequestorID requestor_id,
+                     CacheBlk *blk)
+{
+    insertTag(addr, is_secure, requestor_id,
+              context_switch_task_id::Unknown, blk);
+}
+
 void
 BaseTags::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk)
 {
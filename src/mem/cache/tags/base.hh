@@ -49,13 +49,17 @@
 #include <cassert>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <string>
 
+#include "base/bitfield.hh"
 #include "base/callback.hh"
 #include "base/logging.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "mem/cache/cache_blk.hh"
+#include "mem/cache/tags/indexing_policies/base.hh"
+#include "mem/cache/tags/tag_store.hh"
 #include "mem/packet.hh"
 #include "params/BaseTags.hh"
 #include "sim/clocked_object.hh"
@@ -102,6 +106,12 @@ class BaseTags : public ClockedObject
     /** The data blocks, 1 per cache block. */
     std::unique_ptr<uint8_t[]> dataBlks;
 
+    /**
+     * The tags of the entries of the indexing policy, if it maps each
+     * address to a single set.
+     */
+    std::unique_ptr<TagStore> tagStore;
+
     /**
      * TODO: It would be good if these stats were acquired after warmup.
      */
@@ -157,6 +167,64 @@ class BaseTags : public ClockedObject
         statistics::Scalar dataAccesses;
     } stats;
 
+    /**
+     * Mirror the tags of the indexing policy's entries, which must all
+     * have been set, to a tag store if the policy maps each address to a
+     * single set.
+     */
+    void initTagStore();
+
+    /**
+     * Find a possible entry of an address which holds its tag, from the
+     * tag store if there is one.
+     *
+     * @param addr The address to look for.
+     * @param is_secure True if the target memory space is secure.
+     * @param accept Called with each matching entry until it returns true.
+     * @return The entry accepted, or nullptr.
+     */
+    template <typename Accept>
+    ReplaceableEntry *
+    findMatchingEntry(Addr addr, bool is_secure, Accept &&accept) const
+    {
+        const Addr tag = extractTag(addr);
+
+        if (tagStore) {
+            const uint32_t set = indexingPolicy->getSet(addr);
+            for (uint64_t ways = tagStore->match(set, tag, is_secure); ways;
+                    ways &= ways - 1) {
+                ReplaceableEntry *entry =
+                    indexingPolicy->getEntry(set, ctz64(ways));
+                if (accept(entry))
+                    return entry;
+            }
+            return nullptr;
+        }
+
+        std::vector<ReplaceableEntry*> scratch;
+        for (const auto &entry :
+                indexingPolicy->getPossibleEntries(addr, scratch)) {
+            if (static_cast<TaggedEntry *>(entry)->matchTag(tag, is_secure) &&
+                accept(entry)) {
+                return entry;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Insert the tag of a block and update the stats describing the
+     * contents of the tags, common to packets and functional warming.
+     *
+     * @param addr Address of the block.
+     * @param is_secure True if the block is in the secure memory space.
+     * @param requestor_id The requestor the block is brought in for.
+     * @param task_id The task the block is brought in for.
+     * @param blk The block to update.
+     */
+    void insertTag(Addr addr, bool is_secure, RequestorID requestor_id,
+                   uint32_t task_id, CacheBlk *blk);
+
   public:
     typedef BaseTagsParams Params;
     BaseTags(const Params &p);
@@ -310,6 +378,27 @@ class BaseTags : public ClockedObject
      */
     virtual void insertBlock(const PacketPtr pkt, CacheBlk *blk);
 
+    /**
+     * Update the replacement data of a block hit by a functionally
+     * warmed access, as accessBlock() does for a packet. Tag and data
+     * accesses are not counted.
+     *
+     * @param blk The block hit, which must be valid.
+     */
+    virtual void warmTouch(CacheBlk *blk) = 0;
+
+    /**
+     * Insert a block for a functionally warmed access, as insertBlock()
+     * does for a packet. Tag and data accesses are not counted.
+     *
+     * @param addr Address of the block.
+     * @param is_secure True if the block is in the secure memory space.
+     * @param requestor_id The requestor the block is brought in for.
+     * @param blk The block to update.
+     */
+    virtual void warmInsert(Addr addr, bool is_secure,
+                            RequestorID requestor_id, CacheBlk *blk);
+
     /**
      * Move a block's metadata to another location decided by the replacement
      * policy. It behaves as a swap, however, since the destination block
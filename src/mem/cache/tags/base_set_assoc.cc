@@ -69,6 +69,11 @@ BaseSetAssoc::BaseSetAssoc(const Params &p)
 void
 BaseSetAssoc::tagsInit()
 {
+    // Keep the replacement data in arrays per set, if the policies allow
+    const bool set_replacement = indexingPolicy->inSingleSet() &&
+        replacementPolicy->instantiateSets(indexingPolicy->getNumSets(),
+                                           indexingPolicy->getAssoc());
+
     // Initialize all blocks
     for (unsigned blk_index = 0; blk_index < numBlocks; blk_index++) {
         // Locate next cache block
@@ -81,8 +86,11 @@ BaseSetAssoc::tagsInit()
         blk->data = &dataBlks[blkSize*blk_index];
 
         // Associate a replacement data entry to the block
-        blk->replacementData = replacementPolicy->instantiateEntry();
+        if (!set_replacement)
+            blk->replacementData = replacementPolicy->instantiateEntry();
     }
+
+    initTagStore();
 }
 
 void
@@ -94,7 +102,7 @@ BaseSetAssoc::invalidate(CacheBlk *blk)
     stats.tagsInUse--;
 
     // Invalidate replacement data
-    replacementPolicy->invalidate(blk->replacementData);
+    replacementPolicy->invalidate(blk);
 }
 
 void
@@ -105,8 +113,8 @@ BaseSetAssoc::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk)
     // Since the blocks were using different replacement data pointers,
     // we must touch the replacement data of the new entry, and invalidate
     // the one that is being moved.
-    replacementPolicy->invalidate(src_blk->replacementData);
-    replacementPolicy->reset(dest_blk->replacementData);
+    replacementPolicy->invalidate(src_blk);
+    replacementPolicy->reset(dest_blk);
 }
 
 } // namespace gem5
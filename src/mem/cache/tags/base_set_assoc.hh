@@ -146,7 +146,7 @@ class BaseSetAssoc : public BaseTags
             blk->increaseRefCount();
 
             // Update replacement data of accessed block
-            replacementPolicy->touch(blk->replacementData, pkt);
+            replacementPolicy->touch(blk, pkt);
         }
 
         // The tag lookup latency is the same for a hit or a miss
@@ -170,12 +170,13 @@ class BaseSetAssoc : public BaseTags
                          std::vector<CacheBlk*>& evict_blks) override
     {
         // Get possible entries to be victimized
-        const std::vector<ReplaceableEntry*> entries =
-            indexingPolicy->getPossibleEntries(addr);
+        std::vector<ReplaceableEntry*> scratch;
+        const std::vector<ReplaceableEntry*> &entries =
+            indexingPolicy->getPossibleEntries(addr, scratch);
 
         // Choose replacement victim from replacement candidates
-        CacheBlk* victim = static_cast<CacheBlk*>(replacementPolicy->getVictim(
-                                entries));
+        CacheBlk* victim = static_cast<CacheBlk*>(
+            replacementPolicy->selectVictim(entries));
 
         // There is only one eviction for this replacement
         evict_blks.push_back(victim);
@@ -198,7 +199,21 @@ class BaseSetAssoc : public BaseTags
         stats.tagsInUse++;
 
         // Update replacement policy
-        replacementPolicy->reset(blk->replacementData, pkt);
+        replacementPolicy->reset(blk, pkt);
+    }
+
+    void warmTouch(CacheBlk *blk) override
+    {
+        blk->increaseRefCount();
+        replacementPolicy->warmTouch(blk, regenerateBlkAddr(blk));
+    }
+
+    void warmInsert(Addr addr, bool is_secure, RequestorID requestor_id,
+                    CacheBlk *blk) override
+    {
+        BaseTags::warmInsert(addr, is_secure, requestor_id, blk);
+        stats.tagsInUse++;
+        replacementPolicy->warmReset(blk, addr);
     }
 
     void moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk) override;
@@ -56,6 +56,11 @@ CompressedTags::tagsInit()
     blks = std::vector<CompressionBlk>(numBlocks);
     superBlks = std::vector<SuperBlk>(numSectors);
 
+    // Keep the replacement data in arrays per set, if the policies allow
+    const bool set_replacement = indexingPolicy->inSingleSet() &&
+        replacementPolicy->instantiateSets(indexingPolicy->getNumSets(),
+                                           indexingPolicy->getAssoc());
+
     // Initialize all blocks
     unsigned blk_index = 0;          // index into blks array
     for (unsigned superblock_index = 0; superblock_index < numSectors;
@@ -69,7 +74,10 @@ CompressedTags::tagsInit()
         superblock->setBlkSize(blkSize);
 
         // Associate a replacement data entry to the block
-        superblock->replacementData = replacementPolicy->instantiateEntry();
+        if (!set_replacement) {
+            superblock->replacementData =
+                replacementPolicy->instantiateEntry();
+        }
 
         // Initialize all blocks in this superblock
         superblock->blks.resize(numBlocksPerSector, nullptr);
@@ -99,6 +107,8 @@ CompressedTags::tagsInit()
         // Link block to indexing policy
         indexingPolicy->setEntry(superblock, superblock_index);
     }
+
+    initTagStore();
 }
 
 CacheBlk*
@@ -106,35 +116,29 @@ CompressedTags::findVictim(Addr addr, const bool is_secure,
                            const std::size_t compressed_size,
                            std::vector<CacheBlk*>& evict_blks)
 {
-    // Get all possible locations of this superblock
-    const std::vector<ReplaceableEntry*> superblock_entries =
-        indexingPolicy->getPossibleEntries(addr);
-
     // Check if the superblock this address belongs to has been allocated. If
     // so, try co-allocating
-    Addr tag = extractTag(addr);
-    SuperBlk* victim_superblock = nullptr;
-    bool is_co_allocation = false;
     const uint64_t offset = extractSectorOffset(addr);
-    for (const auto& entry : superblock_entries){
-        SuperBlk* superblock = static_cast<SuperBlk*>(entry);
-        if (superblock->matchTag(tag, is_secure) &&
-            !superblock->blks[offset]->isValid() &&
-            superblock->isCompressed() &&
-            superblock->canCoAllocate(compressed_size))
-        {
-            victim_superblock = superblock;
-            is_co_allocation = true;
-            break;
-        }
-    }
+    SuperBlk* victim_superblock = static_cast<SuperBlk*>(findMatchingEntry(
+        addr, is_secure, [&](ReplaceableEntry *entry) {
+            SuperBlk* superblock = static_cast<SuperBlk*>(entry);
+            return !superblock->blks[offset]->isValid() &&
+                superblock->isCompressed() &&
+                superblock->canCoAllocate(compressed_size);
+        }));
+    const bool is_co_allocation = victim_superblock != nullptr;
 
     // If the superblock is not present or cannot be co-allocated a
     // superblock must be replaced
     if (victim_superblock == nullptr){
+        // Get all possible locations of this superblock
+        std::vector<ReplaceableEntry*> scratch;
+        const std::vector<ReplaceableEntry*> &superblock_entries =
+            indexingPolicy->getPossibleEntries(addr, scratch);
+
         // Choose replacement victim from replacement candidates
         victim_superblock = static_cast<SuperBlk*>(
-            replacementPolicy->getVictim(superblock_entries));
+            replacementPolicy->selectVictim(superblock_entries));
 
         // The whole superblock must be evicted to make room for the new one
         for (const auto& blk : victim_superblock->blks){
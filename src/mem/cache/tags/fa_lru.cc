@@ -223,6 +223,25 @@ FALRU::insertBlock(const PacketPtr pkt, CacheBlk *blk)
     tagHash[std::make_pair(blk->getTag(), blk->isSecure())] = falruBlk;
 }
 
+void
+FALRU::warmTouch(CacheBlk *blk)
+{
+    moveToHead(static_cast<FALRUBlk*>(blk));
+}
+
+void
+FALRU::warmInsert(Addr addr, bool is_secure, RequestorID requestor_id,
+                  CacheBlk *blk)
+{
+    FALRUBlk* falruBlk = static_cast<FALRUBlk*>(blk);
+    assert(falruBlk->inCachesMask == 0);
+
+    BaseTags::warmInsert(addr, is_secure, requestor_id, blk);
+    stats.tagsInUse++;
+    moveToHead(falruBlk);
+    tagHash[std::make_pair(blk->getTag(), blk->isSecure())] = falruBlk;
+}
+
 void
 FALRU::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk)
 {
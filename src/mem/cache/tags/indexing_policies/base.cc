@@ -71,12 +71,6 @@ BaseIndexingPolicy::BaseIndexingPolicy(const Params &p)
     }
 }
 
-ReplaceableEntry*
-BaseIndexingPolicy::getEntry(const uint32_t set, const uint32_t way) const
-{
-    return sets[set][way];
-}
-
 void
 BaseIndexingPolicy::setEntry(ReplaceableEntry* entry, const uint64_t index)
 {
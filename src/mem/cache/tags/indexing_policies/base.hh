@@ -49,6 +49,7 @@
 
 #include <vector>
 
+#include "base/logging.hh"
 #include "params/BaseIndexingPolicy.hh"
 #include "sim/sim_object.hh"
 
@@ -128,7 +129,11 @@ class BaseIndexingPolicy : public SimObject
      * @param way The way of the desired entry.
      * @return entry The entry pointer.
      */
-    ReplaceableEntry* getEntry(const uint32_t set, const uint32_t way) const;
+    ReplaceableEntry*
+    getEntry(const uint32_t set, const uint32_t way) const
+    {
+        return sets[set][way];
+    }
 
     /**
      * Generate the tag from the given address.
@@ -143,11 +148,42 @@ class BaseIndexingPolicy : public SimObject
      * Should be called immediately before ReplacementPolicy's findVictim()
      * not to break cache resizing.
      *
+     * Policies whose possible entries are stored together return them
+     * without copying.  The others gather them into the caller's scratch
+     * vector, so concurrent lookups never share storage.
+     *
      * @param addr The addr to a find possible entries for.
+     * @param scratch Storage for the entries, if the policy needs it.
      * @return The possible entries.
      */
-    virtual std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr)
-                                                                    const = 0;
+    virtual const std::vector<ReplaceableEntry*> &
+    getPossibleEntries(const Addr addr,
+                       std::vector<ReplaceableEntry*> &scratch) const = 0;
+
+    /**
+     * Whether the possible entries of every address are all the ways of a
+     * single set, which lets their tags be looked up together.
+     */
+    virtual bool inSingleSet() const { return false; }
+
+    /**
+     * The set holding the possible entries of an address, if they are in
+     * a single set.
+     *
+     * @param addr The address to get the set of.
+     * @return The set index.
+     */
+    virtual uint32_t
+    getSet(const Addr addr) const
+    {
+        panic("%s doesn't map addresses to single sets", name());
+    }
+
+    /** The number of sets */
+    uint32_t getNumSets() const { return numSets; }
+
+    /** The number of ways of each set */
+    unsigned getAssoc() const { return assoc; }
 
     /**
      * Regenerate an entry's address from its tag and assigned indexing bits.
@@ -69,10 +69,17 @@ SetAssociative::regenerateAddr(const Addr tag, const ReplaceableEntry* entry)
     return (tag << tagShift) | (entry->getSet() << setShift);
 }
 
-std::vector<ReplaceableEntry*>
-SetAssociative::getPossibleEntries(const Addr addr) const
+const std::vector<ReplaceableEntry*> &
+SetAssociative::getPossibleEntries(const Addr addr,
+    std::vector<ReplaceableEntry*> &scratch) const
 {
     return sets[extractSet(addr)];
 }
 
+uint32_t
+SetAssociative::getSet(const Addr addr) const
+{
+    return extractSet(addr);
+}
+
 } // namespace gem5
@@ -113,10 +113,15 @@ class SetAssociative : public BaseIndexingPolicy
      * Returns entries in all ways belonging to the set of the address.
      *
      * @param addr The addr to a find possible entries for.
+     * @param scratch Unused, the set holds the entries.
      * @return The possible entries.
      */
-    std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr) const
-                                                                     override;
+    const std::vector<ReplaceableEntry*> &
+    getPossibleEntries(const Addr addr,
+                       std::vector<ReplaceableEntry*> &scratch) const override;
+
+    bool inSingleSet() const override { return true; }
+    uint32_t getSet(const Addr addr) const override;
 
     /**
      * Regenerate an entry's address from its tag and assigned set and way.
@@ -158,10 +158,12 @@ class SkewedAssociative : public BaseIndexingPolicy
      * not to break cache resizing.
      *
      * @param addr The addr to a find possible entries for.
-     * @return The possible entries.
+     * @param scratch Filled with the entry of each way.
+     * @return The possible entries, i.e. scratch.
      */
-    std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr) const
-                                                                   override;
+    const std::vector<ReplaceableEntry*> &
+    getPossibleEntries(const Addr addr,
+                       std::vector<ReplaceableEntry*> &scratch) const override;
 
     /**
      * Regenerate an entry's address from its tag and assigned set and way.
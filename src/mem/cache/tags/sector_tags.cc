@@ -74,6 +74,11 @@ SectorTags::tagsInit()
     blks = std::vector<SectorSubBlk>(numBlocks);
     secBlks = std::vector<SectorBlk>(numSectors);
 
+    // Keep the replacement data in arrays per set, if the policies allow
+    const bool set_replacement = indexingPolicy->inSingleSet() &&
+        replacementPolicy->instantiateSets(indexingPolicy->getNumSets(),
+                                           indexingPolicy->getAssoc());
+
     // Initialize all blocks
     unsigned blk_index = 0;       // index into blks array
     for (unsigned sec_blk_index = 0; sec_blk_index < numSectors;
@@ -83,7 +88,8 @@ SectorTags::tagsInit()
         SectorBlk* sec_blk = &secBlks[sec_blk_index];
 
         // Associate a replacement data entry to the sector
-        sec_blk->replacementData = replacementPolicy->instantiateEntry();
+        if (!set_replacement)
+            sec_blk->replacementData = replacementPolicy->instantiateEntry();
 
         // Initialize all blocks in this sector
         sec_blk->blks.resize(numBlocksPerSector);
@@ -113,6 +119,8 @@ SectorTags::tagsInit()
         // Link block to indexing policy
         indexingPolicy->setEntry(sec_blk, sec_blk_index);
     }
+
+    initTagStore();
 }
 
 void
@@ -134,7 +142,7 @@ SectorTags::invalidate(CacheBlk *blk)
         assert(stats.tagsInUse.value() >= 0);
 
         // Invalidate replacement data, as we're invalidating the sector
-        replacementPolicy->invalidate(sector_blk->replacementData);
+        replacementPolicy->invalidate(sector_blk);
     }
 }
 
@@ -166,7 +174,7 @@ SectorTags::accessBlock(const PacketPtr pkt, Cycles &lat)
 
         // Update replacement data of accessed block, which is shared with
         // the whole sector it belongs to
-        replacementPolicy->touch(sector_blk->replacementData, pkt);
+        replacementPolicy->touch(sector_blk, pkt);
     }
 
     // The tag lookup latency is the same for a hit or a miss
@@ -186,20 +194,48 @@ SectorTags::insertBlock(const PacketPtr pkt, CacheBlk *blk)
     // sector was not previously present in the cache.
     if (sector_blk->isValid()) {
         // An existing entry's replacement data is just updated
-        replacementPolicy->touch(sector_blk->replacementData, pkt);
+        replacementPolicy->touch(sector_blk, pkt);
     } else {
         // Increment tag counter
         stats.tagsInUse++;
         assert(stats.tagsInUse.value() <= numSectors);
 
         // A new entry resets the replacement data
-        replacementPolicy->reset(sector_blk->replacementData, pkt);
+        replacementPolicy->reset(sector_blk, pkt);
     }
 
     // Do common block insertion functionality
     BaseTags::insertBlock(pkt, blk);
 }
 
+void
+SectorTags::warmTouch(CacheBlk *blk)
+{
+    blk->increaseRefCount();
+    replacementPolicy->warmTouch(
+        static_cast<SectorSubBlk*>(blk)->getSectorBlock(),
+        regenerateBlkAddr(blk));
+}
+
+void
+SectorTags::warmInsert(Addr addr, bool is_secure, RequestorID requestor_id,
+                       CacheBlk *blk)
+{
+    const SectorBlk* sector_blk =
+        static_cast<SectorSubBlk*>(blk)->getSectorBlock();
+
+    // As in insertBlock(), only a new sector is a new tag
+    if (sector_blk->isValid()) {
+        replacementPolicy->warmTouch(sector_blk, addr);
+    } else {
+        stats.tagsInUse++;
+        assert(stats.tagsInUse.value() <= numSectors);
+        replacementPolicy->warmReset(sector_blk, addr);
+    }
+
+    BaseTags::warmInsert(addr, is_secure, requestor_id, blk);
+}
+
 void
 SectorTags::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk)
 {
@@ -224,7 +260,7 @@ SectorTags::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk)
     // in the sector.
     if (!src_sector_blk->isValid()) {
         // Invalidate replacement data, as we're invalidating the sector
-        replacementPolicy->invalidate(src_sector_blk->replacementData);
+        replacementPolicy->invalidate(src_sector_blk);
 
         if (dest_was_valid) {
             // If destination sector was valid, and the source sector became
@@ -240,9 +276,9 @@ SectorTags::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk)
     }
 
     if (dest_was_valid) {
-        replacementPolicy->touch(dest_sector_blk->replacementData);
+        replacementPolicy->touch(dest_sector_blk);
     } else {
-        replacementPolicy->reset(dest_sector_blk->replacementData);
+        replacementPolicy->reset(dest_sector_blk);
     }
 }
 
@@ -256,46 +292,39 @@ SectorTags::findBlock(Addr addr, bool is_secure) const
     // due to sectors being composed of contiguous-address entries
     const Addr offset = extractSectorOffset(addr);
 
-    // Find all possible sector entries that may contain the given address
-    const std::vector<ReplaceableEntry*> entries =
-        indexingPolicy->getPossibleEntries(addr);
-
-    // Search for block
-    for (const auto& sector : entries) {
-        auto blk = static_cast<SectorBlk*>(sector)->blks[offset];
-        if (blk->matchTag(tag, is_secure)) {
-            return blk;
+    // Search the sectors holding the tag for the block
+    SectorSubBlk* blk = nullptr;
+    findMatchingEntry(addr, is_secure, [&](ReplaceableEntry *sector) {
+        SectorSubBlk* sub_blk = static_cast<SectorBlk*>(sector)->blks[offset];
+        if (!sub_blk->matchTag(tag, is_secure)) {
+            return false;
         }
-    }
+        blk = sub_blk;
+        return true;
+    });
 
-    // Did not find block
-    return nullptr;
+    return blk;
 }
 
 CacheBlk*
 SectorTags::findVictim(Addr addr, const bool is_secure, const std::size_t size,
                        std::vector<CacheBlk*>& evict_blks)
 {
-    // Get possible entries to be victimized
-    const std::vector<ReplaceableEntry*> sector_entries =
-        indexingPolicy->getPossibleEntries(addr);
-
     // Check if the sector this address belongs to has been allocated
     Addr tag = extractTag(addr);
-    SectorBlk* victim_sector = nullptr;
-    for (const auto& sector : sector_entries) {
-        SectorBlk* sector_blk = static_cast<SectorBlk*>(sector);
-        if (sector_blk->matchTag(tag, is_secure)) {
-            victim_sector = sector_blk;
-            break;
-        }
-    }
+    SectorBlk* victim_sector = static_cast<SectorBlk*>(findMatchingEntry(
+        addr, is_secure, [](ReplaceableEntry *sector) { return true; }));
 
     // If the sector is not present
     if (victim_sector == nullptr){
+        // Get possible entries to be victimized
+        std::vector<ReplaceableEntry*> scratch;
+        const std::vector<ReplaceableEntry*> &sector_entries =
+            indexingPolicy->getPossibleEntries(addr, scratch);
+
         // Choose replacement victim from replacement candidates
-        victim_sector = static_cast<SectorBlk*>(replacementPolicy->getVictim(
-                                                sector_entries));
+        victim_sector = static_cast<SectorBlk*>(
+            replacementPolicy->selectVictim(sector_entries));
     }
 
     // Get the entry of the victim block within the sector
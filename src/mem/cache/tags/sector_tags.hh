@@ -153,6 +153,11 @@ class SectorTags : public BaseTags
      */
     void insertBlock(const PacketPtr pkt, CacheBlk *blk) override;
 
+    void warmTouch(CacheBlk *blk) override;
+
+    void warmInsert(Addr addr, bool is_secure, RequestorID requestor_id,
+                    CacheBlk *blk) override;
+
     void moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk) override;
 
     /**
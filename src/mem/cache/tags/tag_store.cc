@@ -0,0 +1,31 @@
+/**
+ * @file
+ * Definitions of a structure-of-arrays copy of a set associative table's
+ * tags.
+ */
+
+#include "mem/cache/tags/tag_store.hh"
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+TagStore::TagStore(uint32_t num_sets, unsigned assoc)
+    : stride(roundUp(assoc, waysPerBlock)),
+      keys(num_sets * stride, TaggedEntry::invalidKey)
+{
+    fatal_if(assoc > maxAssoc, "Tag stores hold at most %d ways per set",
+             maxAssoc);
+}
+
+void
+TagStore::addEntry(TaggedEntry *entry)
+{
+    const std::size_t index = entry->getSet() * stride + entry->getWay();
+    assert(index < keys.size());
+    entry->setStoreKey(&keys[index]);
+}
+
+} // namespace gem5
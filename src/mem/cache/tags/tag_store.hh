@@ -0,0 +1,84 @@
+/**
+ * @file
+ * Declaration of a structure-of-arrays copy of a set associative table's
+ * tags, for looking up the ways of a set together.
+ */
+
+#ifndef __MEM_CACHE_TAGS_TAG_STORE_HH__
+#define __MEM_CACHE_TAGS_TAG_STORE_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/cache/tags/tagged_entry.hh"
+
+namespace gem5
+{
+
+/**
+ * The tag, valid and secure bits of the entries of a set associative
+ * table, packed into a key per entry and laid out contiguously by set.
+ * Looking up an address then reads the keys of a set from one or two host
+ * cache lines and compares them all at once, instead of following a
+ * pointer to each entry and comparing its tag.
+ *
+ * The entries keep their keys up to date as they are inserted and
+ * invalidated, so the store only needs to be told about each once.
+ * Sets are padded to a multiple of waysPerBlock keys which never match,
+ * so the compare loop has a fixed trip count that compilers vectorize.
+ */
+class TagStore
+{
+  public:
+    /** The ways compared at a time */
+    static constexpr unsigned waysPerBlock = 8;
+
+    /** The most ways a set can have, one per bit of a match mask */
+    static constexpr unsigned maxAssoc = 64;
+
+    TagStore(uint32_t num_sets, unsigned assoc);
+
+    /**
+     * Mirror an entry's tag into the store, at its set and way.
+     *
+     * @param entry The entry, whose position must have been set.
+     */
+    void addEntry(TaggedEntry *entry);
+
+    /**
+     * Find the ways of a set whose entries are valid and hold the given
+     * tag in the given address space.
+     *
+     * @param set The set to look in.
+     * @param tag The tag to look for.
+     * @param is_secure Whether the tag is in the secure space.
+     * @return A mask with a bit set for each matching way.
+     */
+    uint64_t
+    match(uint32_t set, Addr tag, bool is_secure) const
+    {
+        const uint64_t key = TaggedEntry::storeKey(tag, is_secure);
+        const uint64_t *set_keys = &keys[set * stride];
+
+        uint64_t ways = 0;
+        for (unsigned first = 0; first < stride; first += waysPerBlock) {
+            // Without branches, so the compares can be done in parallel
+            uint64_t block = 0;
+            for (unsigned i = 0; i < waysPerBlock; ++i)
+                block |= uint64_t(set_keys[first + i] == key) << i;
+            ways |= block << first;
+        }
+        return ways;
+    }
+
+  private:
+    /** The keys of each set, the set's ways rounded up to a whole block */
+    const unsigned stride;
+
+    std::vector<uint64_t> keys;
+};
+
+} // namespace gem5
+
+#endif //__MEM_CACHE_TAGS_TAG_STORE_HH__
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "mem/cache/tags/tag_store.hh"
+#include "mem/cache/tags/tagged_entry.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+const uint32_t numSets = 4;
+const unsigned assoc = 12;
+
+/** A tag store and its entries, indexed by set and then way */
+struct Table
+{
+    Table() : store(numSets, assoc), entries(numSets * assoc)
+    {
+        for (uint32_t set = 0; set < numSets; set++) {
+            for (unsigned way = 0; way < assoc; way++) {
+                entry(set, way).setPosition(set, way);
+                store.addEntry(&entry(set, way));
+            }
+        }
+    }
+
+    TaggedEntry &entry(uint32_t set, unsigned way)
+    {
+        return entries[set * assoc + way];
+    }
+
+    TagStore store;
+    std::vector<TaggedEntry> entries;
+};
+
+} // anonymous namespace
+
+/** Only valid entries with the same tag and secure bit match */
+TEST(TagStoreTest, Match)
+{
+    Table table;
+    ASSERT_EQ(table.store.match(1, 0x10, false), 0);
+
+    table.entry(1, 3).insert(0x10, false);
+    table.entry(1, 11).insert(0x10, true);
+    table.entry(2, 3).insert(0x10, false);
+    ASSERT_EQ(table.store.match(1, 0x10, false), 1ULL << 3);
+    ASSERT_EQ(table.store.match(1, 0x10, true), 1ULL << 11);
+    ASSERT_EQ(table.store.match(2, 0x10, false), 1ULL << 3);
+    ASSERT_EQ(table.store.match(1, 0x11, false), 0);
+    ASSERT_EQ(table.store.match(3, 0x10, false), 0);
+
+    // Duplicate tags, e.g. of superblocks which couldn't co-allocate
+    table.entry(1, 7).insert(0x10, false);
+    ASSERT_EQ(table.store.match(1, 0x10, false), (1ULL << 3) | (1ULL << 7));
+}
+
+/** Invalidated entries stop matching until they are reinserted */
+TEST(TagStoreTest, Invalidate)
+{
+    Table table;
+    table.entry(0, 0).insert(0x20, false);
+    table.entry(0, 0).invalidate();
+    ASSERT_EQ(table.store.match(0, 0x20, false), 0);
+
+    table.entry(0, 0).insert(0x21, true);
+    ASSERT_EQ(table.store.match(0, 0x21, true), 1);
+}
+
+/** Assigning to an entry updates its key, but copies aren't mirrored */
+TEST(TagStoreTest, Copy)
+{
+    Table table;
+    TaggedEntry other;
+    other.insert(0x30, false);
+
+    table.entry(2, 5) = other;
+    ASSERT_EQ(table.store.match(2, 0x30, false), 1ULL << 5);
+
+    TaggedEntry copy(table.entry(2, 5));
+    copy.invalidate();
+    ASSERT_EQ(table.store.match(2, 0x30, false), 1ULL << 5);
+}
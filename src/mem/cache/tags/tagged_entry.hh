@@ -30,6 +30,7 @@
 #define __CACHE_TAGGED_ENTRY_HH__
 
 #include <cassert>
+#include <cstdint>
 
 #include "base/cprintf.hh"
 #include "base/types.hh"
@@ -46,9 +47,28 @@ namespace gem5
 class TaggedEntry : public ReplaceableEntry
 {
   public:
-    TaggedEntry() : _valid(false), _secure(false), _tag(MaxAddr) {}
+    TaggedEntry()
+      : _valid(false), _secure(false), _tag(MaxAddr), _storeKey(nullptr)
+    {}
     ~TaggedEntry() = default;
 
+    /** A copy isn't mirrored to the original's tag store key */
+    TaggedEntry(const TaggedEntry &other)
+      : ReplaceableEntry(other), _valid(other._valid),
+        _secure(other._secure), _tag(other._tag), _storeKey(nullptr)
+    {}
+
+    TaggedEntry &
+    operator=(const TaggedEntry &other)
+    {
+        ReplaceableEntry::operator=(other);
+        _valid = other._valid;
+        _secure = other._secure;
+        _tag = other._tag;
+        updateStoreKey();
+        return *this;
+    }
+
     /**
      * Checks if the entry is valid.
      *
@@ -107,6 +127,33 @@ class TaggedEntry : public ReplaceableEntry
         clearSecure();
     }
 
+    /**
+     * The key of an entry holding the given tag in a TagStore. Tags are
+     * shifted by at least the block offset, so their top bit is free for
+     * the secure bit, and no key is invalidKey.
+     */
+    static uint64_t
+    storeKey(Addr tag, bool is_secure)
+    {
+        return (tag << 1) | is_secure;
+    }
+
+    /** The key of invalid entries in a TagStore */
+    static constexpr uint64_t invalidKey = MaxAddr;
+
+    /**
+     * Keep the given TagStore key up to date with this entry's valid and
+     * secure bits and tag.
+     *
+     * @param key The entry's key in the store.
+     */
+    void
+    setStoreKey(uint64_t *key)
+    {
+        _storeKey = key;
+        updateStoreKey();
+    }
+
     std::string
     print() const override
     {
@@ -120,10 +167,20 @@ class TaggedEntry : public ReplaceableEntry
      *
      * @param tag The tag value.
      */
-    virtual void setTag(Addr tag) { _tag = tag; }
+    virtual void
+    setTag(Addr tag)
+    {
+        _tag = tag;
+        updateStoreKey();
+    }
 
     /** Set secure bit. */
-    virtual void setSecure() { _secure = true; }
+    virtual void
+    setSecure()
+    {
+        _secure = true;
+        updateStoreKey();
+    }
 
     /** Set valid bit. The block must be invalid beforehand. */
     virtual void
@@ -131,6 +188,7 @@ class TaggedEntry : public ReplaceableEntry
     {
         assert(!isValid());
         _valid = true;
+        updateStoreKey();
     }
 
   private:
@@ -150,8 +208,23 @@ class TaggedEntry : public ReplaceableEntry
     /** The entry's tag. */
     Addr _tag;
 
+    /** The entry's key in a TagStore, if it is in one */
+    uint64_t *_storeKey;
+
     /** Clear secure bit. Should be only used by the invalidation function. */
-    void clearSecure() { _secure = false; }
+    void
+    clearSecure()
+    {
+        _secure = false;
+        updateStoreKey();
+    }
+
+    void
+    updateStoreKey()
+    {
+        if (_storeKey)
+            *_storeKey = _valid ? storeKey(_tag, _secure) : invalidKey;
+    }
 };
 
 } // namespace gem5
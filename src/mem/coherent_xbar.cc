@@ -1076,6 +1076,119 @@ CoherentXBar::forwardFunctional(PacketPtr pkt, PortID exclude_cpu_side_port_id)
     }
 }
 
+WarmResponse
+CoherentXBar::recvWarmRequest(const WarmRequest &req,
+                              PortID cpu_side_port_id)
+{
+    DPRINTF(CoherentXBar, "%s: src %s addr %#llx writable %d\n", __func__,
+            cpuSidePorts[cpu_side_port_id]->name(), req.addr,
+            req.needsWritable);
+
+    const WarmSnoop snoop{req.addr, req.isSecure, req.needsWritable ?
+        WarmSnoop::Op::Invalidate : WarmSnoop::Op::Downgrade};
+    WarmSnoopResponse snoop_resp;
+    if (snoopFilter) {
+        snoop_resp = forwardWarmSnoop(snoop, cpu_side_port_id,
+            snoopFilter->warmRequest(req.addr, req.isSecure,
+                                     *cpuSidePorts[cpu_side_port_id],
+                                     req.needsWritable));
+    } else {
+        snoop_resp = forwardWarmSnoop(snoop, cpu_side_port_id, snoopPorts);
+    }
+
+    WarmRequest fwd_req = req;
+    WarmResponse resp{true, true};
+    if (snoop_resp.dirty && !req.cacheResponding) {
+        // A cache above passes the line on, so as with the atomic
+        // packet, only an invalidation of a line which wasn't Modified
+        // still has to go below
+        if (!req.needsWritable)
+            return WarmResponse{false, false};
+        if (snoop_resp.writable)
+            return resp;
+        fwd_req.cacheResponding = true;
+    } else if (snoop_resp.cached && !req.needsWritable) {
+        fwd_req.hasSharers = true;
+    }
+
+    PortID dest_id = findPort(RangeSize(req.addr, 1));
+    WarmResponse mem_resp = memSidePorts[dest_id]->sendWarmRequest(fwd_req);
+    if (fwd_req.cacheResponding)
+        return resp;
+    if (fwd_req.hasSharers)
+        mem_resp.writable = false;
+    return mem_resp;
+}
+
+void
+CoherentXBar::recvWarmEvict(const WarmEviction &evict,
+                            PortID cpu_side_port_id)
+{
+    DPRINTF(CoherentXBar, "%s: src %s addr %#llx data %d\n", __func__,
+            cpuSidePorts[cpu_side_port_id]->name(), evict.addr,
+            evict.withData);
+
+    // Other caches with a copy keep the line cached, as the snoop of an
+    // atomic eviction would find
+    const WarmSnoop snoop{evict.addr, evict.isSecure, WarmSnoop::Op::Query};
+    WarmSnoopResponse snoop_resp;
+    if (snoopFilter) {
+        snoop_resp = forwardWarmSnoop(snoop, cpu_side_port_id,
+            snoopFilter->warmEvict(evict.addr, evict.isSecure,
+                                   *cpuSidePorts[cpu_side_port_id],
+                                   evict.blockCached));
+    } else {
+        snoop_resp = forwardWarmSnoop(snoop, cpu_side_port_id, snoopPorts);
+    }
+
+    WarmEviction fwd_evict = evict;
+    fwd_evict.blockCached |= snoop_resp.cached;
+
+    // Sink clean evictions of lines that are still cached
+    if (!fwd_evict.withData && fwd_evict.blockCached)
+        return;
+
+    PortID dest_id = findPort(RangeSize(evict.addr, 1));
+    memSidePorts[dest_id]->sendWarmEvict(fwd_evict);
+}
+
+WarmSnoopResponse
+CoherentXBar::recvWarmSnoop(const WarmSnoop &snoop, PortID mem_side_port_id)
+{
+    DPRINTF(CoherentXBar, "%s: src %s addr %#llx\n", __func__,
+            memSidePorts[mem_side_port_id]->name(), snoop.addr);
+
+    if (snoopFilter) {
+        return forwardWarmSnoop(snoop, InvalidPortID,
+            snoopFilter->warmSnoop(snoop.addr, snoop.isSecure,
+                                   snoop.op == WarmSnoop::Op::Invalidate));
+    }
+    return forwardWarmSnoop(snoop, InvalidPortID, snoopPorts);
+}
+
+WarmSnoopResponse
+CoherentXBar::forwardWarmSnoop(const WarmSnoop &snoop,
+                               PortID exclude_cpu_side_port_id,
+                               const std::vector<QueuedResponsePort*>& dests)
+{
+    WarmSnoopResponse resp{false, false, false};
+    for (const auto& p: dests) {
+        // we could have gotten this request from a snooping requestor
+        // (corresponding to our own CPU-side port that is also in
+        // snoopPorts) and should not send it back to where it came
+        // from
+        if (exclude_cpu_side_port_id != InvalidPortID &&
+            p->getId() == exclude_cpu_side_port_id)
+            continue;
+
+        WarmSnoopResponse p_resp = p->sendWarmSnoop(snoop);
+        resp.cached |= p_resp.cached;
+        resp.dirty |= p_resp.dirty;
+        resp.writable |= p_resp.writable;
+    }
+    return resp;
+}
+
 bool
 CoherentXBar::sinkPacket(const PacketPtr pkt) const
 {
@@ -136,6 +136,18 @@ class CoherentXBar : public BaseXBar
             xbar.recvFunctional(pkt, id);
         }
 
+        WarmResponse
+        recvWarmRequest(const WarmRequest &req) override
+        {
+            return xbar.recvWarmRequest(req, id);
+        }
+
+        void
+        recvWarmEvict(const WarmEviction &evict) override
+        {
+            xbar.recvWarmEvict(evict, id);
+        }
+
         AddrRangeList
         getAddrRanges() const override
         {
@@ -196,6 +208,12 @@ class CoherentXBar : public BaseXBar
             xbar.recvFunctionalSnoop(pkt, id);
         }
 
+        WarmSnoopResponse
+        recvWarmSnoop(const WarmSnoop &snoop) override
+        {
+            return xbar.recvWarmSnoop(snoop, id);
+        }
+
         void recvRangeChange() override { xbar.recvRangeChange(id); }
         void recvReqRetry() override { xbar.recvReqRetry(id); }
 
@@ -388,6 +406,29 @@ class CoherentXBar : public BaseXBar
      */
     void forwardFunctional(PacketPtr pkt, PortID exclude_cpu_side_port_id);
 
+    /**
+     * Functional warming counterparts of the atomic transactions, which
+     * snoop and forward as the atomic packets for the line would, even
+     * though the system is bypassing the caches.
+     */
+    WarmResponse recvWarmRequest(const WarmRequest &req,
+                                 PortID cpu_side_port_id);
+    void recvWarmEvict(const WarmEviction &evict, PortID cpu_side_port_id);
+    WarmSnoopResponse recvWarmSnoop(const WarmSnoop &snoop,
+                                    PortID mem_side_port_id);
+
+    /**
+     * Send a functional warming snoop to a selected list of snoopers,
+     * excluding a CPU-side port, and combine their responses.
+     *
+     * @param snoop The snoop to forward
+     * @param exclude_cpu_side_port_id Id of CPU-side port to exclude
+     * @param dests Vector of destination ports for the snoop
+     */
+    WarmSnoopResponse forwardWarmSnoop(const WarmSnoop &snoop,
+        PortID exclude_cpu_side_port_id,
+        const std::vector<QueuedResponsePort*>& dests);
+
     /**
      * Determine if the crossbar should sink the packet, as opposed to
      * forwarding it, or responding.
@@ -101,6 +101,24 @@ CommMonitor::recvFunctionalSnoop(PacketPtr pkt)
     cpuSidePort.sendFunctionalSnoop(pkt);
 }
 
+WarmResponse
+CommMonitor::recvWarmRequest(const WarmRequest &req)
+{
+    return memSidePort.sendWarmRequest(req);
+}
+
+void
+CommMonitor::recvWarmEvict(const WarmEviction &evict)
+{
+    memSidePort.sendWarmEvict(evict);
+}
+
+WarmSnoopResponse
+CommMonitor::recvWarmSnoop(const WarmSnoop &snoop)
+{
+    return cpuSidePort.sendWarmSnoop(snoop);
+}
+
 CommMonitor::MonitorStats::MonitorStats(statistics::Group *parent,
                                         const CommMonitorParams &params)
     : statistics::Group(parent),
@@ -139,6 +139,11 @@ class CommMonitor : public SimObject
             return mon.recvAtomicSnoop(pkt);
         }
 
+        WarmSnoopResponse recvWarmSnoop(const WarmSnoop &snoop)
+        {
+            return mon.recvWarmSnoop(snoop);
+        }
+
         bool recvTimingResp(PacketPtr pkt)
         {
             return mon.recvTimingResp(pkt);
@@ -205,6 +210,16 @@ class CommMonitor : public SimObject
             return mon.recvAtomic(pkt);
         }
 
+        WarmResponse recvWarmRequest(const WarmRequest &req)
+        {
+            return mon.recvWarmRequest(req);
+        }
+
+        void recvWarmEvict(const WarmEviction &evict)
+        {
+            mon.recvWarmEvict(evict);
+        }
+
         bool recvTimingReq(PacketPtr pkt)
         {
             return mon.recvTimingReq(pkt);
@@ -247,6 +262,12 @@ class CommMonitor : public SimObject
 
     Tick recvAtomicSnoop(PacketPtr pkt);
 
+    WarmResponse recvWarmRequest(const WarmRequest &req);
+
+    void recvWarmEvict(const WarmEviction &evict);
+
+    WarmSnoopResponse recvWarmSnoop(const WarmSnoop &snoop);
+
     bool recvTimingReq(PacketPtr pkt);
 
     bool recvTimingResp(PacketPtr pkt);
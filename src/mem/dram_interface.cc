@@ -66,109 +66,115 @@ DRAMInterface::chooseNextFRFCFS(MemPacketQueue& queue, Tick min_col_at) const
     // can the PRE/ACT sequence be done without impacting utlization?
     bool hidden_bank_prep = false;
 
-    // search for seamless row hits first, if no seamless row hit is
-    // found then determine if there are other packets that can be issued
-    // without incurring additional bus delay due to bank timing
-    // Will select closed rows first to enable more open row possibilies
-    // in future selections
-    bool found_hidden_bank = false;
+    // Look for the oldest seamless row hit first. If there is none, the
+    // oldest packet to a closed row of one of the banks that can be
+    // prepped the earliest is chosen if the PRE/ACT can be hidden,
+    // otherwise the oldest row hit that is prepped but not seamless, and
+    // failing that the earliest packet to a closed row. The queue keeps
+    // the packets to each row of a bank in order, so only the oldest hit
+    // and the oldest miss of each bank need to be considered.
+    MemPacket* seamless_pkt = nullptr;
+    MemPacket* prepped_pkt = nullptr;
+    MemPacket* earliest_pkt = nullptr;
+    Tick seamless_col_at = MaxTick;
+    Tick prepped_col_at = MaxTick;
+    Tick earliest_col_at = MaxTick;
+
+    auto older = [](const MemPacket* pkt, const MemPacket* than) {
+        return !than || pkt->queueOrder < than->queueOrder;
+    };
 
-    // remember if we found a row hit, not seamless, but bank prepped
-    // and ready
-    bool found_prepped_pkt = false;
-
-    // if we have no row hit, prepped or not, and no seamless packet,
-    // just go for the earliest possible
-    bool found_earliest_pkt = false;
+    for (int i = 0; i < ranksPerChannel; i++) {
+        // check if rank is not doing a refresh and thus is available,
+        // if not, skip its banks
+        if (!ranks[i]->inRefIdleState()) {
+            DPRINTF(DRAM, "%s Rank %d not available\n", __func__, i);
+            continue;
+        }
 
-    Tick selected_col_at = MaxTick;
-    auto selected_pkt_it = queue.end();
-
-    for (auto i = queue.begin(); i != queue.end() ; ++i) {
-        MemPacket* pkt = *i;
-
-        // select optimal DRAM packet in Q
-        if (pkt->isDram() && (pkt->pseudoChannel == pseudoChannel)) {
-            const Bank& bank = ranks[pkt->rank]->banks[pkt->bank];
-            const Tick col_allowed_at = pkt->isRead() ? bank.rdAllowedAt :
-                                                        bank.wrAllowedAt;
-
-            DPRINTF(DRAM, "%s checking DRAM packet in bank %d, row %d\n",
-                    __func__, pkt->bank, pkt->row);
-
-            // check if rank is not doing a refresh and thus is available,
-            // if not, jump to the next packet
-            if (burstReady(pkt)) {
-
-                DPRINTF(DRAM,
-                        "%s bank %d - Rank %d available\n", __func__,
-                        pkt->bank, pkt->rank);
-
-                // check if it is a row hit
-                if (bank.openRow == pkt->row) {
-                    // no additional rank-to-rank or same bank-group
-                    // delays, or we switched read/write and might as well
-                    // go for the row hit
-                    if (col_allowed_at <= min_col_at) {
-                        // FCFS within the hits, giving priority to
-                        // commands that can issue seamlessly, without
-                        // additional delay, such as same rank accesses
-                        // and/or different bank-group accesses
-                        DPRINTF(DRAM, "%s Seamless buffer hit\n", __func__);
-                        selected_pkt_it = i;
-                        selected_col_at = col_allowed_at;
-                        // no need to look through the remaining queue entries
-                        break;
-                    } else if (!found_hidden_bank && !found_prepped_pkt) {
-                        // if we did not find a packet to a closed row that can
-                        // issue the bank commands without incurring delay, and
-                        // did not yet find a packet to a prepped row, remember
-                        // the current one
-                        selected_pkt_it = i;
-                        selected_col_at = col_allowed_at;
-                        found_prepped_pkt = true;
-                        DPRINTF(DRAM, "%s Prepped row buffer hit\n", __func__);
-                    }
-                } else if (!found_earliest_pkt) {
-                    // if we have not initialised the bank status, do it
-                    // now, and only once per scheduling decisions
-                    if (!filled_earliest_banks) {
-                        // determine entries with earliest bank delay
-                        std::tie(earliest_banks, hidden_bank_prep) =
-                            minBankPrep(queue, min_col_at);
-                        filled_earliest_banks = true;
+        for (int j = 0; j < banksPerRank; j++) {
+            const MemPacketQueue::BankQueue* bank_queue =
+                queue.bank(true, pseudoChannel, i * banksPerRank + j);
+            if (!bank_queue || bank_queue->empty())
+                continue;
+
+            const Bank& bank = ranks[i]->banks[j];
+
+            DPRINTF(DRAM, "%s checking DRAM packets in bank %d, rank %d\n",
+                    __func__, j, i);
+
+            MemPacket* hit = bank_queue->oldestHit(bank.openRow);
+            if (hit) {
+                const Tick col_allowed_at = hit->isRead() ?
+                    bank.rdAllowedAt : bank.wrAllowedAt;
+
+                // no additional rank-to-rank or same bank-group delays,
+                // or we switched read/write and might as well go for the
+                // row hit
+                if (col_allowed_at <= min_col_at) {
+                    if (older(hit, seamless_pkt)) {
+                        seamless_pkt = hit;
+                        seamless_col_at = col_allowed_at;
                     }
+                } else if (older(hit, prepped_pkt)) {
+                    prepped_pkt = hit;
+                    prepped_col_at = col_allowed_at;
+                }
+            }
 
-                    // bank is amongst first available banks
-                    // minBankPrep will give priority to packets that can
-                    // issue seamlessly
-                    if (bits(earliest_banks[pkt->rank],
-                             pkt->bank, pkt->bank)) {
-                        found_earliest_pkt = true;
-                        found_hidden_bank = hidden_bank_prep;
-
-                        // give priority to packets that can issue
-                        // bank commands 'behind the scenes'
-                        // any additional delay if any will be due to
-                        // col-to-col command requirements
-                        if (hidden_bank_prep || !found_prepped_pkt) {
-                            selected_pkt_it = i;
-                            selected_col_at = col_allowed_at;
-                        }
-                    }
+            // a seamless row hit beats any miss
+            if (seamless_pkt)
+                continue;
+
+            MemPacket* miss = bank_queue->oldestMiss(bank.openRow);
+            if (miss) {
+                // if we have not initialised the bank status, do it
+                // now, and only once per scheduling decisions
+                if (!filled_earliest_banks) {
+                    // determine entries with earliest bank delay
+                    std::tie(earliest_banks, hidden_bank_prep) =
+                        minBankPrep(queue, min_col_at);
+                    filled_earliest_banks = true;
+                }
+
+                // bank is amongst first available banks
+                // minBankPrep will give priority to packets that can
+                // issue seamlessly
+                if (bits(earliest_banks[i], j, j) &&
+                    older(miss, earliest_pkt)) {
+                    earliest_pkt = miss;
+                    earliest_col_at = miss->isRead() ?
+                        bank.rdAllowedAt : bank.wrAllowedAt;
                 }
-            } else {
-                DPRINTF(DRAM, "%s bank %d - Rank %d not available\n", __func__,
-                        pkt->bank, pkt->rank);
             }
         }
     }
 
-    if (selected_pkt_it == queue.end()) {
+    MemPacket* selected_pkt = nullptr;
+    Tick selected_col_at = MaxTick;
+
+    if (seamless_pkt) {
+        DPRINTF(DRAM, "%s Seamless buffer hit\n", __func__);
+        selected_pkt = seamless_pkt;
+        selected_col_at = seamless_col_at;
+    } else if (earliest_pkt && (hidden_bank_prep || !prepped_pkt)) {
+        // give priority to packets that can issue bank commands 'behind
+        // the scenes', any additional delay if any will be due to
+        // col-to-col command requirements
+        selected_pkt = earliest_pkt;
+        selected_col_at = earliest_col_at;
+    } else if (prepped_pkt) {
+        DPRINTF(DRAM, "%s Prepped row buffer hit\n", __func__);
+        selected_pkt = prepped_pkt;
+        selected_col_at = prepped_col_at;
+    }
+
+    if (!selected_pkt) {
         DPRINTF(DRAM, "%s no available DRAM ranks found\n", __func__);
+        return std::make_pair(queue.end(), selected_col_at);
     }
 
-    return std::make_pair(selected_pkt_it, selected_col_at);
+    return std::make_pair(queue.find(selected_pkt), selected_col_at);
 }
 
 void
@@ -508,33 +514,19 @@ DRAMInterface::doBurstAccess(MemPacket* mem_pkt, Tick next_burst_at,
         bool got_bank_conflict = false;
 
         for (uint8_t i = 0; i < ctrl->numPriorities(); ++i) {
-            auto p = queue[i].begin();
-            // keep on looking until we find a hit or reach the end of the
-            // queue
             // 1) if a hit is found, then both open and close adaptive
             //    policies keep the page open
             // 2) if no hit is found, got_bank_conflict is set to true if a
             //    bank conflict request is waiting in the queue
             // 3) make sure we are not considering the packet that we are
             //    currently dealing with
-            while (!got_more_hits && p != queue[i].end()) {
+            const MemPacketQueue::BankQueue* bank_queue =
+                queue[i].bank(true, pseudoChannel, mem_pkt->bankId);
+            if (!bank_queue)
+                continue;
 
-                if ((*p)->pseudoChannel != pseudoChannel) {
-                    // only consider if this pkt belongs to this interface
-                    ++p;
-                    continue;
-                }
-
-                if (mem_pkt != (*p)) {
-                    bool same_rank_bank = (mem_pkt->rank == (*p)->rank) &&
-                                          (mem_pkt->bank == (*p)->bank);
-
-                    bool same_row = mem_pkt->row == (*p)->row;
-                    got_more_hits |= same_rank_bank && same_row;
-                    got_bank_conflict |= same_rank_bank && !same_row;
-                }
-                ++p;
-            }
+            got_more_hits = bank_queue->hasHit(mem_pkt->row, mem_pkt);
+            got_bank_conflict |= bank_queue->hasMiss(mem_pkt->row);
 
             if (got_more_hits)
                 break;
@@ -1041,11 +1033,15 @@ DRAMInterface::minBankPrep(const MemPacketQueue& queue,
     // determine if we have queued transactions targetting the
     // bank in question
     std::vector<bool> got_waiting(ranksPerChannel * banksPerRank, false);
-    for (const auto& p : queue) {
-        if (p->pseudoChannel != pseudoChannel)
+    for (int i = 0; i < ranksPerChannel; i++) {
+        if (!ranks[i]->inRefIdleState())
             continue;
-        if (p->isDram() && ranks[p->rank]->inRefIdleState())
-            got_waiting[p->bankId] = true;
+        for (int j = 0; j < banksPerRank; j++) {
+            uint16_t bank_id = i * banksPerRank + j;
+            const MemPacketQueue::BankQueue* bank_queue =
+                queue.bank(true, pseudoChannel, bank_id);
+            got_waiting[bank_id] = bank_queue && !bank_queue->empty();
+        }
     }
 
     // Find command with optimal bank timing
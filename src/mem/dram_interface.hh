@@ -705,7 +705,8 @@ class DRAMInterface : public MemInterface
     Tick accessLatency() const override { return (tRP + tRCD_RD + tRL); }
 
     /**
-     * For FR-FCFS policy, find first DRAM command that can issue
+     * For FR-FCFS policy, find first DRAM command that can issue,
+     * considering the oldest packets to each bank of the queue
      *
      * @param queue Queued requests to consider
      * @param min_col_at Minimum tick for 'seamless' issue
@@ -40,6 +40,8 @@
 
 #include "mem/mem_ctrl.hh"
 
+#include <algorithm>
+
 #include "base/trace.hh"
 #include "debug/DRAM.hh"
 #include "debug/Drain.hh"
@@ -57,6 +59,68 @@ namespace gem5
 namespace memory
 {
 
+MemPacket*
+MemPacketQueue::BankQueue::oldestMiss(uint32_t row) const
+{
+    MemPacket* oldest = nullptr;
+    for (const auto& [r, pkts] : rows) {
+        if (r != row &&
+            (!oldest || pkts.front()->queueOrder < oldest->queueOrder)) {
+            oldest = pkts.front();
+        }
+    }
+    return oldest;
+}
+
+bool
+MemPacketQueue::BankQueue::hasHit(uint32_t row, const MemPacket* except) const
+{
+    auto it = rows.find(row);
+    if (it == rows.end())
+        return false;
+    return it->second.size() > 1 || it->second.front() != except;
+}
+
+void
+MemPacketQueue::push_back(MemPacket* pkt)
+{
+    pkt->queueOrder = nextOrder++;
+    packets.push_back(pkt);
+
+    BankQueue& bank_queue =
+        banks[bankKey(pkt->isDram(), pkt->pseudoChannel, pkt->bankId)];
+    bank_queue.rows[pkt->row].push_back(pkt);
+}
+
+MemPacketQueue::iterator
+MemPacketQueue::erase(iterator pos)
+{
+    MemPacket* pkt = *pos;
+
+    BankQueue& bank_queue =
+        banks.at(bankKey(pkt->isDram(), pkt->pseudoChannel, pkt->bankId));
+    auto row = bank_queue.rows.find(pkt->row);
+    assert(row != bank_queue.rows.end());
+    // Usually the oldest packet to the row is the one serviced
+    auto& row_pkts = row->second;
+    row_pkts.erase(std::find(row_pkts.begin(), row_pkts.end(), pkt));
+    if (row_pkts.empty())
+        bank_queue.rows.erase(row);
+
+    return packets.erase(pos);
+}
+
+MemPacketQueue::iterator
+MemPacketQueue::find(const MemPacket* pkt) const
+{
+    // The packets are in the order they were added
+    auto it = std::lower_bound(packets.begin(), packets.end(), pkt,
+        [](const MemPacket* a, const MemPacket* b)
+        { return a->queueOrder < b->queueOrder; });
+    assert(it != packets.end() && *it == pkt);
+    return it;
+}
+
 MemCtrl::MemCtrl(const MemCtrlParams &p) :
     qos::MemCtrl(p),
     port(name() + ".port", *this), isTimingMode(false),
@@ -480,7 +544,7 @@ MemCtrl::recvTimingReq(PacketPtr pkt)
 
 void
 MemCtrl::processRespondEvent(MemInterface* mem_intr,
-                        MemPacketQueue& queue,
+                        std::deque<MemPacket*>& queue,
                         EventFunctionWrapper& resp_event,
                         bool& retry_rd_req)
 {
@@ -870,7 +934,7 @@ MemCtrl::nonDetermReads(MemInterface* mem_intr) {
 
 void
 MemCtrl::processNextReqEvent(MemInterface* mem_intr,
-                        MemPacketQueue& resp_queue,
+                        std::deque<MemPacket*>& resp_queue,
                         EventFunctionWrapper& resp_event,
                         EventFunctionWrapper& next_req_event,
                         bool& retry_wr_req) {
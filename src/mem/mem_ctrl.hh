@@ -48,6 +48,7 @@
 
 #include <deque>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -156,6 +157,11 @@ class MemPacket
      */
     uint8_t _qosValue;
 
+    /**
+     * The order the packet was added to its queue in, set by the queue
+     */
+    uint64_t queueOrder;
+
     /**
      * Set the packet QoS value
      * (interface compatibility with Packet)
@@ -210,14 +216,122 @@ class MemPacket
           _requestorId(pkt->requestorId()),
           read(is_read), dram(is_dram), pseudoChannel(_channel), rank(_rank),
           bank(_bank), row(_row), bankId(bank_id), addr(_addr), size(_size),
-          burstHelper(NULL), _qosValue(_pkt->qosValue())
+          burstHelper(NULL), _qosValue(_pkt->qosValue()), queueOrder(0)
     { }
 
 };
 
-// The memory packets are store in a multiple dequeue structure,
-// based on their QoS priority
-typedef std::deque<MemPacket*> MemPacketQueue;
+/**
+ * A queue of memory packets in the order they were added, with the
+ * packets to each bank also kept by row. The schedulers look up the
+ * oldest packet to a bank's open row, or to any of its other rows, in
+ * the bank's sub-queues instead of walking the whole queue, so picking a
+ * packet takes time in proportion to the banks rather than the queue.
+ *
+ * The memory packets are stored in a queue per QoS priority.
+ */
+class MemPacketQueue
+{
+  private:
+    typedef std::deque<MemPacket*> Packets;
+
+  public:
+    /** Packets are only added and removed through the queue */
+    typedef Packets::const_iterator iterator;
+    typedef Packets::const_iterator const_iterator;
+
+    /** The packets to a bank, by row, each row's in queue order */
+    class BankQueue
+    {
+      public:
+        bool empty() const { return rows.empty(); }
+
+        /**
+         * The oldest packet to a row, or nullptr if there are none.
+         */
+        MemPacket*
+        oldestHit(uint32_t row) const
+        {
+            auto it = rows.find(row);
+            return it == rows.end() ? nullptr : it->second.front();
+        }
+
+        /**
+         * The oldest packet to any other row than the given one, or
+         * nullptr if there are none.
+         */
+        MemPacket* oldestMiss(uint32_t row) const;
+
+        /**
+         * Is there a packet to the row, other than the given one?
+         */
+        bool hasHit(uint32_t row, const MemPacket* except) const;
+
+        /**
+         * Is there a packet to any other row than the given one?
+         */
+        bool
+        hasMiss(uint32_t row) const
+        {
+            return rows.size() > rows.count(row);
+        }
+
+      private:
+        friend class MemPacketQueue;
+
+        std::unordered_map<uint32_t, std::vector<MemPacket*>> rows;
+    };
+
+    iterator begin() const { return packets.begin(); }
+    iterator end() const { return packets.end(); }
+    size_t size() const { return packets.size(); }
+    bool empty() const { return packets.empty(); }
+    MemPacket* front() const { return packets.front(); }
+    MemPacket* back() const { return packets.back(); }
+
+    void push_back(MemPacket* pkt);
+    void pop_front() { erase(packets.begin()); }
+    iterator erase(iterator pos);
+
+    /**
+     * Find a packet in the queue, by its order.
+     *
+     * @param pkt A packet which is in the queue.
+     * @return The position of the packet.
+     */
+    iterator find(const MemPacket* pkt) const;
+
+    /**
+     * Get the sub-queue of a bank.
+     *
+     * @param dram Whether the bank is in a DRAM rather than an NVM.
+     * @param pseudo_channel The pseudo channel of the bank.
+     * @param bank_id The bank, amongst those of all the ranks.
+     * @return The sub-queue, or nullptr if no packet was ever to the bank.
+     */
+    const BankQueue*
+    bank(bool dram, uint8_t pseudo_channel, uint16_t bank_id) const
+    {
+        auto it = banks.find(bankKey(dram, pseudo_channel, bank_id));
+        return it == banks.end() ? nullptr : &it->second;
+    }
+
+  private:
+    static uint32_t
+    bankKey(bool dram, uint8_t pseudo_channel, uint16_t bank_id)
+    {
+        return (uint32_t(pseudo_channel) << 17) | (uint32_t(dram) << 16) |
+            bank_id;
+    }
+
+    Packets packets;
+
+    /** The sub-queues of the banks, which are kept once emptied */
+    std::unordered_map<uint32_t, BankQueue> banks;
+
+    /** The order of the next packet added */
+    uint64_t nextOrder = 0;
+};
 
 
 /**
@@ -297,14 +411,14 @@ class MemCtrl : public qos::MemCtrl
      * in these methods
      */
     virtual void processNextReqEvent(MemInterface* mem_intr,
-                          MemPacketQueue& resp_queue,
+                          std::deque<MemPacket*>& resp_queue,
                           EventFunctionWrapper& resp_event,
                           EventFunctionWrapper& next_req_event,
                           bool& retry_wr_req);
     EventFunctionWrapper nextReqEvent;
 
     virtual void processRespondEvent(MemInterface* mem_intr,
-                        MemPacketQueue& queue,
+                        std::deque<MemPacket*>& queue,
                         EventFunctionWrapper& resp_event,
                         bool& retry_rd_req);
     EventFunctionWrapper respondEvent;
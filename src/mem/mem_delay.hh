@@ -86,6 +86,10 @@ class MemDelay : public ClockedObject
 
         Tick recvAtomicSnoop(PacketPtr pkt) override;
 
+        WarmSnoopResponse recvWarmSnoop(const WarmSnoop &snoop) override {
+            return parent.responsePort.sendWarmSnoop(snoop);
+        }
+
         void recvTimingSnoopReq(PacketPtr pkt) override;
 
         void recvRangeChange() override {
@@ -111,6 +115,14 @@ class MemDelay : public ClockedObject
         void recvFunctional(PacketPtr pkt) override;
         bool recvTimingSnoopResp(PacketPtr pkt) override;
 
+        WarmResponse recvWarmRequest(const WarmRequest &req) override {
+            return parent.requestPort.sendWarmRequest(req);
+        }
+
+        void recvWarmEvict(const WarmEviction &evict) override {
+            parent.requestPort.sendWarmEvict(evict);
+        }
+
         AddrRangeList getAddrRanges() const override {
             return parent.requestPort.getAddrRanges();
         }
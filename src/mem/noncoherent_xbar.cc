@@ -314,4 +314,26 @@ NoncoherentXBar::recvFunctional(PacketPtr pkt, PortID cpu_side_port_id)
     memSidePorts[dest_id]->sendFunctional(pkt);
 }
 
+WarmResponse
+NoncoherentXBar::recvWarmRequest(const WarmRequest &req,
+                                 PortID cpu_side_port_id)
+{
+    DPRINTF(NoncoherentXBar, "recvWarmRequest: src %s addr 0x%x\n",
+            cpuSidePorts[cpu_side_port_id]->name(), req.addr);
+
+    PortID dest_id = findPort(RangeSize(req.addr, 1));
+    return memSidePorts[dest_id]->sendWarmRequest(req);
+}
+
+void
+NoncoherentXBar::recvWarmEvict(const WarmEviction &evict,
+                               PortID cpu_side_port_id)
+{
+    DPRINTF(NoncoherentXBar, "recvWarmEvict: src %s addr 0x%x\n",
+            cpuSidePorts[cpu_side_port_id]->name(), evict.addr);
+
+    PortID dest_id = findPort(RangeSize(evict.addr, 1));
+    memSidePorts[dest_id]->sendWarmEvict(evict);
+}
+
 } // namespace gem5
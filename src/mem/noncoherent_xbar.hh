@@ -126,6 +126,18 @@ class NoncoherentXBar : public BaseXBar
             xbar.recvFunctional(pkt, id);
         }
 
+        WarmResponse
+        recvWarmRequest(const WarmRequest &req) override
+        {
+            return xbar.recvWarmRequest(req, id);
+        }
+
+        void
+        recvWarmEvict(const WarmEviction &evict) override
+        {
+            xbar.recvWarmEvict(evict, id);
+        }
+
         AddrRangeList
         getAddrRanges() const override
         {
@@ -179,6 +191,9 @@ class NoncoherentXBar : public BaseXBar
     Tick recvAtomicBackdoor(PacketPtr pkt, PortID cpu_side_port_id,
                             MemBackdoorPtr *backdoor=nullptr);
     void recvFunctional(PacketPtr pkt, PortID cpu_side_port_id);
+    WarmResponse recvWarmRequest(const WarmRequest &req,
+                                 PortID cpu_side_port_id);
+    void recvWarmEvict(const WarmEviction &evict, PortID cpu_side_port_id);
 
   public:
 
@@ -235,6 +235,20 @@ MemCmd::commandInfo[] =
     { {IsRequest}, InvalidCmd, "TlbiExtSync" },
 };
 
+SlabPool &
+Packet::pool()
+{
+    static SlabPool *packets = new SlabPool;
+    return *packets;
+}
+
+SlabPool &
+Packet::dataPool()
+{
+    static SlabPool *data = new SlabPool;
+    return *data;
+}
+
 AddrRange
 Packet::getAddrRange() const
 {
@@ -58,6 +58,7 @@
 #include "base/flags.hh"
 #include "base/logging.hh"
 #include "base/printable.hh"
+#include "base/slab_pool.hh"
 #include "base/types.hh"
 #include "mem/htm.hh"
 #include "mem/request.hh"
@@ -350,6 +351,8 @@ class Packet : public Printable
         /// the packet is destroyed. The pointer is assumed to be pointing
         /// to an array, and delete [] is consequently called
         DYNAMIC_DATA           = 0x00002000,
+        /// The data is small enough to be held in the packet itself
+        INLINE_DATA            = 0x00004000,
 
         /// suppress the error if this packet encounters a functional
         /// access failure.
@@ -357,7 +360,14 @@ class Packet : public Printable
 
         // Signal block present to squash prefetch and cache evict packets
         // through express snoop flag
-        BLOCK_CACHED          = 0x00010000
+        BLOCK_CACHED          = 0x00010000,
+
+        /// The data was allocated from the data pool by allocate(),
+        /// and is freed to it when the packet is destroyed
+        POOLED_DATA            = 0x00020000,
+
+        /// Any of the ways the packet can hold data
+        DATA_FLAGS = STATIC_DATA | DYNAMIC_DATA | INLINE_DATA | POOLED_DATA
     };
 
     Flags flags;
@@ -1036,6 +1046,28 @@ class Packet : public Printable
         deleteData();
     }
 
+    /**
+     * Packets are allocated from a pool, as the memory system creates
+     * and deletes them at high rates. Packets on the stack are not.
+     */
+    static void *
+    operator new(std::size_t size)
+    {
+        return pool().allocate(size);
+    }
+
+    static void
+    operator delete(void *block, std::size_t size)
+    {
+        pool().deallocate(block, size);
+    }
+
+    /** The pool of packets */
+    static SlabPool &pool();
+
+    /** The pool of data too large to be held in a packet */
+    static SlabPool &dataPool();
+
     /**
      * Take a request packet and modify it in place to be suitable for
      * returning as a response to that request.
@@ -1146,7 +1178,7 @@ class Packet : public Printable
     void
     dataStatic(T *p)
     {
-        assert(flags.noneSet(STATIC_DATA|DYNAMIC_DATA));
+        assert(flags.noneSet(DATA_FLAGS));
         data = (PacketDataPtr)p;
         flags.set(STATIC_DATA);
     }
@@ -1163,7 +1195,7 @@ class Packet : public Printable
     void
     dataStaticConst(const T *p)
     {
-        assert(flags.noneSet(STATIC_DATA|DYNAMIC_DATA));
+        assert(flags.noneSet(DATA_FLAGS));
         data = const_cast<PacketDataPtr>(p);
         flags.set(STATIC_DATA);
     }
@@ -1184,7 +1216,7 @@ class Packet : public Printable
     void
     dataDynamic(T *p)
     {
-        assert(flags.noneSet(STATIC_DATA|DYNAMIC_DATA));
+        assert(flags.noneSet(DATA_FLAGS));
         data = (PacketDataPtr)p;
         flags.set(DYNAMIC_DATA);
     }
@@ -1196,7 +1228,7 @@ class Packet : public Printable
     T*
     getPtr()
     {
-        assert(flags.isSet(STATIC_DATA|DYNAMIC_DATA));
+        assert(flags.isSet(DATA_FLAGS));
         assert(!isMaskedWrite());
         return (T*)data;
     }
@@ -1205,7 +1237,7 @@ class Packet : public Printable
     const T*
     getConstPtr() const
     {
-        assert(flags.isSet(STATIC_DATA|DYNAMIC_DATA));
+        assert(flags.isSet(DATA_FLAGS));
         return (const T*)data;
     }
 
@@ -1329,21 +1361,32 @@ class Packet : public Printable
     {
         if (flags.isSet(DYNAMIC_DATA))
             delete [] data;
+        else if (flags.isSet(POOLED_DATA))
+            dataPool().deallocate(data, getSize());
 
-        flags.clear(STATIC_DATA|DYNAMIC_DATA);
+        flags.clear(DATA_FLAGS);
         data = NULL;
     }
 
-    /** Allocate memory for the packet. */
+    /**
+     * Allocate memory for the packet, in the packet itself if the data
+     * is no larger than a typical cache line.
+     */
     void
     allocate()
     {
         // if either this command or the response command has a data
         // payload, actually allocate space
         if (hasData() || hasRespData()) {
-            assert(flags.noneSet(STATIC_DATA|DYNAMIC_DATA));
-            flags.set(DYNAMIC_DATA);
-            data = new uint8_t[getSize()];
+            assert(flags.noneSet(DATA_FLAGS));
+            if (getSize() <= sizeof(inlineData)) {
+                flags.set(INLINE_DATA);
+                data = inlineData;
+            } else {
+                flags.set(POOLED_DATA);
+                data = static_cast<PacketDataPtr>(
+                    dataPool().allocate(getSize()));
+            }
         }
     }
 
@@ -1508,6 +1551,13 @@ class Packet : public Printable
      * failed transaction, this function returns the failure reason.
      */
     HtmCacheFailure getHtmTransactionFailedInCacheRC() const;
+
+  private:
+    /**
+     * Storage for the data of packets of up to a 64 byte cache line,
+     * last as it isn't always used.
+     */
+    alignas(16) uint8_t inlineData[64];
 };
 
 } // namespace gem5
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "base/gtest/cur_tick_fake.hh"
+#include "mem/packet.hh"
+#include "mem/packet_access.hh"
+#include "mem/request.hh"
+
+using namespace gem5;
+
+// Requests record the tick they are made at
+GTestTickHandler tickHandler;
+
+namespace
+{
+
+PacketPtr
+makeRead(unsigned size)
+{
+    RequestPtr req = std::make_shared<Request>(0x1000, size, 0, 0);
+    PacketPtr pkt = Packet::createRead(req);
+    pkt->allocate();
+    return pkt;
+}
+
+} // anonymous namespace
+
+/** Data small enough to be kept in the packet can be read and written */
+TEST(PacketTest, InlineData)
+{
+    PacketPtr pkt = makeRead(8);
+    pkt->setLE<uint64_t>(0x0123456789abcdef);
+    ASSERT_EQ(pkt->getLE<uint64_t>(), 0x0123456789abcdef);
+    pkt->setBE<uint32_t>(0x01020304);
+    ASSERT_EQ(pkt->getBE<uint32_t>(), 0x01020304);
+    ASSERT_EQ(pkt->getPtr<uint8_t>()[0], 0x01);
+    delete pkt;
+}
+
+/** Data allocated from the data pool can be read and written */
+TEST(PacketTest, PooledData)
+{
+    PacketPtr pkt = makeRead(128);
+    uint8_t *data = pkt->getPtr<uint8_t>();
+    for (unsigned i = 0; i < 128; i++)
+        data[i] = i;
+    ASSERT_EQ(pkt->getLE<uint64_t>(), 0x0706050403020100);
+    pkt->setLE<uint16_t>(0xbeef);
+    ASSERT_EQ(pkt->getLE<uint16_t>(), 0xbeef);
+    ASSERT_EQ(data[127], 127);
+    delete pkt;
+}
+
+/** Copies of a packet get their own data */
+TEST(PacketTest, Copy)
+{
+    PacketPtr pkt = makeRead(8);
+    pkt->setLE<uint64_t>(42);
+
+    PacketPtr copy = new Packet(pkt, false, true);
+    ASSERT_NE(copy->getConstPtr<uint8_t>(), pkt->getConstPtr<uint8_t>());
+    copy->setData(pkt->getConstPtr<uint8_t>());
+    copy->setLE<uint64_t>(43);
+    ASSERT_EQ(pkt->getLE<uint64_t>(), 42);
+    ASSERT_EQ(copy->getLE<uint64_t>(), 43);
+
+    delete copy;
+    delete pkt;
+}
@@ -0,0 +1,360 @@
+/**
+ * @file
+ * Definition of a channel connecting two ports whose objects run on
+ * different event queues.
+ */
+
+#include "mem/partition_channel.hh"
+
+#include <algorithm>
+
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/Drain.hh"
+#include "debug/PartitionChannel.hh"
+
+namespace gem5
+{
+
+PartitionChannel::Link::Link(PartitionChannel &_channel,
+                             const std::string &_name,
+                             EventQueue *_target, Tick _delay,
+                             std::function<bool(PacketPtr)> _send,
+                             statistics::Scalar &_delivered)
+    : channel(_channel), linkName(_name), target(_target), delay(_delay),
+      send(_send), lastArrival(0), waitingForRetry(false),
+      delivered(_delivered)
+{
+}
+
+void
+PartitionChannel::Link::push(PacketPtr pkt)
+{
+    // Like a bridge, the channel takes on the delays the packet has
+    // accumulated so far
+    Tick receive_delay = pkt->headerDelay + pkt->payloadDelay;
+    pkt->headerDelay = pkt->payloadDelay = 0;
+
+    Tick when;
+    {
+        std::lock_guard<std::mutex> lock(inboxMutex);
+        // Arrivals are kept in order so one event can deliver all the
+        // packets that are due
+        when = std::max(curTick() + delay + receive_delay, lastArrival);
+        lastArrival = when;
+        inbox.emplace_back(when, pkt);
+    }
+
+    DPRINTF(PartitionChannel, "%s arrives at %d\n", pkt->print(), when);
+
+    // Scheduled through the target queue's asynchronous insertions when it
+    // is run by another thread
+    target->schedule(new DeliverEvent(*this), when);
+}
+
+void
+PartitionChannel::Link::deliver()
+{
+    {
+        std::lock_guard<std::mutex> lock(inboxMutex);
+        while (!inbox.empty() && inbox.front().first <= curTick()) {
+            ready.push_back(inbox.front().second);
+            inbox.pop_front();
+        }
+    }
+
+    trySend();
+}
+
+void
+PartitionChannel::Link::retry()
+{
+    assert(waitingForRetry);
+    waitingForRetry = false;
+    trySend();
+}
+
+void
+PartitionChannel::Link::trySend()
+{
+    while (!waitingForRetry && !ready.empty()) {
+        PacketPtr pkt = ready.front();
+        if (!send(pkt)) {
+            DPRINTF(PartitionChannel, "%s refused, waiting for retry\n",
+                    pkt->print());
+            waitingForRetry = true;
+            return;
+        }
+        ready.pop_front();
+        delivered++;
+    }
+
+    channel.checkDrained();
+}
+
+bool
+PartitionChannel::Link::empty()
+{
+    std::lock_guard<std::mutex> lock(inboxMutex);
+    return inbox.empty() && ready.empty();
+}
+
+bool
+PartitionChannel::Link::trySatisfyFunctional(PacketPtr pkt)
+{
+    std::lock_guard<std::mutex> lock(inboxMutex);
+    for (auto &arriving : inbox) {
+        if (pkt->trySatisfyFunctional(arriving.second))
+            return true;
+    }
+    for (PacketPtr queued : ready) {
+        if (pkt->trySatisfyFunctional(queued))
+            return true;
+    }
+    return false;
+}
+
+PartitionChannel::ChannelResponsePort::ChannelResponsePort(
+        const std::string &_name, PartitionChannel &_channel)
+    : ResponsePort(_name, &_channel), channel(_channel)
+{
+}
+
+bool
+PartitionChannel::ChannelResponsePort::recvTimingReq(PacketPtr pkt)
+{
+    channel.reqLink.push(pkt);
+    return true;
+}
+
+bool
+PartitionChannel::ChannelResponsePort::tryTiming(PacketPtr pkt)
+{
+    return true;
+}
+
+bool
+PartitionChannel::ChannelResponsePort::recvTimingSnoopResp(PacketPtr pkt)
+{
+    channel.snoopRespLink.push(pkt);
+    return true;
+}
+
+void
+PartitionChannel::ChannelResponsePort::recvRespRetry()
+{
+    channel.respLink.retry();
+}
+
+Tick
+PartitionChannel::ChannelResponsePort::recvAtomic(PacketPtr pkt)
+{
+    EventQueue::ScopedMigration migrate(channel.memSideQueue);
+    return channel.memSidePort.sendAtomic(pkt);
+}
+
+void
+PartitionChannel::ChannelResponsePort::recvFunctional(PacketPtr pkt)
+{
+    pkt->pushLabel(name());
+
+    // Migrating first holds off the mem side's thread, which also
+    // delivers the requests
+    EventQueue::ScopedMigration migrate(channel.memSideQueue);
+    if (!channel.respLink.trySatisfyFunctional(pkt) &&
+        !channel.reqLink.trySatisfyFunctional(pkt)) {
+        channel.memSidePort.sendFunctional(pkt);
+    }
+
+    pkt->popLabel();
+}
+
+WarmResponse
+PartitionChannel::ChannelResponsePort::recvWarmRequest(const WarmRequest &req)
+{
+    EventQueue::ScopedMigration migrate(channel.memSideQueue);
+    return channel.memSidePort.sendWarmRequest(req);
+}
+
+void
+PartitionChannel::ChannelResponsePort::recvWarmEvict(
+        const WarmEviction &evict)
+{
+    EventQueue::ScopedMigration migrate(channel.memSideQueue);
+    channel.memSidePort.sendWarmEvict(evict);
+}
+
+AddrRangeList
+PartitionChannel::ChannelResponsePort::getAddrRanges() const
+{
+    return channel.memSidePort.getAddrRanges();
+}
+
+PartitionChannel::ChannelRequestPort::ChannelRequestPort(
+        const std::string &_name, PartitionChannel &_channel)
+    : RequestPort(_name, &_channel), channel(_channel)
+{
+}
+
+bool
+PartitionChannel::ChannelRequestPort::recvTimingResp(PacketPtr pkt)
+{
+    channel.respLink.push(pkt);
+    return true;
+}
+
+void
+PartitionChannel::ChannelRequestPort::recvTimingSnoopReq(PacketPtr pkt)
+{
+    channel.stats.migratedSnoops++;
+
+    EventQueue::ScopedMigration migrate(channel.cpuSideQueue);
+    channel.cpuSidePort.sendTimingSnoopReq(pkt);
+}
+
+void
+PartitionChannel::ChannelRequestPort::recvReqRetry()
+{
+    channel.reqLink.retry();
+}
+
+void
+PartitionChannel::ChannelRequestPort::recvRetrySnoopResp()
+{
+    channel.snoopRespLink.retry();
+}
+
+Tick
+PartitionChannel::ChannelRequestPort::recvAtomicSnoop(PacketPtr pkt)
+{
+    EventQueue::ScopedMigration migrate(channel.cpuSideQueue);
+    return channel.cpuSidePort.sendAtomicSnoop(pkt);
+}
+
+void
+PartitionChannel::ChannelRequestPort::recvFunctionalSnoop(PacketPtr pkt)
+{
+    EventQueue::ScopedMigration migrate(channel.cpuSideQueue);
+    channel.cpuSidePort.sendFunctionalSnoop(pkt);
+}
+
+WarmSnoopResponse
+PartitionChannel::ChannelRequestPort::recvWarmSnoop(const WarmSnoop &snoop)
+{
+    EventQueue::ScopedMigration migrate(channel.cpuSideQueue);
+    return channel.cpuSidePort.sendWarmSnoop(snoop);
+}
+
+void
+PartitionChannel::ChannelRequestPort::recvRangeChange()
+{
+    channel.cpuSidePort.sendRangeChange();
+}
+
+bool
+PartitionChannel::ChannelRequestPort::isSnooping() const
+{
+    return channel.cpuSidePort.isSnooping();
+}
+
+PartitionChannel::PartitionChannel(const Params &p)
+    : ClockedObject(p),
+      cpuSidePort(p.name + ".cpu_side_port", *this),
+      memSidePort(p.name + ".mem_side_port", *this),
+      cpuSideQueue(getEventQueue(p.cpu_side_eventq)),
+      memSideQueue(getEventQueue(p.mem_side_eventq)),
+      stats(this),
+      reqLink(*this, p.name + ".reqLink", memSideQueue,
+              cyclesToTicks(p.delay),
+              [this](PacketPtr pkt)
+              { return memSidePort.sendTimingReq(pkt); },
+              stats.reqs),
+      snoopRespLink(*this, p.name + ".snoopRespLink", memSideQueue,
+                    cyclesToTicks(p.delay),
+                    [this](PacketPtr pkt)
+                    { return memSidePort.sendTimingSnoopResp(pkt); },
+                    stats.snoopResps),
+      respLink(*this, p.name + ".respLink", cpuSideQueue,
+               cyclesToTicks(p.response_delay),
+               [this](PacketPtr pkt)
+               { return cpuSidePort.sendTimingResp(pkt); },
+               stats.resps)
+{
+}
+
+Port &
+PartitionChannel::getPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "mem_side_port")
+        return memSidePort;
+    else if (if_name == "cpu_side_port")
+        return cpuSidePort;
+    else
+        return ClockedObject::getPort(if_name, idx);
+}
+
+Tick
+PartitionChannel::lookahead() const
+{
+    return cyclesToTicks(std::min(params().delay, params().response_delay));
+}
+
+void
+PartitionChannel::init()
+{
+    if (!cpuSidePort.isConnected() || !memSidePort.isConnected())
+        fatal("Both ports of a partition channel must be connected.\n");
+
+    cpuSidePort.sendRangeChange();
+
+    if (cpuSideQueue == memSideQueue)
+        return;
+
+    // Nothing sent through the channel may arrive before the queues next
+    // synchronise
+    fatal_if(lookahead() == 0, "%s joins event queues %d and %d, so needs "
+             "non-zero delays.\n", name(), params().cpu_side_eventq,
+             params().mem_side_eventq);
+
+    if (simQuantum == 0 || simQuantum > lookahead()) {
+        DPRINTF(PartitionChannel, "Lowering the quantum from %d to %d\n",
+                simQuantum, lookahead());
+        simQuantum = lookahead();
+    }
+}
+
+void
+PartitionChannel::checkDrained()
+{
+    if (drainState() == DrainState::Draining && reqLink.empty() &&
+        snoopRespLink.empty() && respLink.empty()) {
+        DPRINTF(Drain, "PartitionChannel done draining, signaling drain "
+                "manager\n");
+        signalDrainDone();
+    }
+}
+
+DrainState
+PartitionChannel::drain()
+{
+    if (reqLink.empty() && snoopRespLink.empty() && respLink.empty())
+        return DrainState::Drained;
+    else
+        return DrainState::Draining;
+}
+
+PartitionChannel::PartitionChannelStats::PartitionChannelStats(
+        statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(reqs, statistics::units::Count::get(),
+               "Requests delivered to the mem side"),
+      ADD_STAT(snoopResps, statistics::units::Count::get(),
+               "Snoop responses delivered to the mem side"),
+      ADD_STAT(resps, statistics::units::Count::get(),
+               "Responses delivered to the cpu side"),
+      ADD_STAT(migratedSnoops, statistics::units::Count::get(),
+               "Timing snoop requests made on the cpu side's event queue")
+{
+}
+
+} // namespace gem5
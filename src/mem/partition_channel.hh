@@ -0,0 +1,221 @@
+/**
+ * @file
+ * Declaration of a channel connecting two ports whose objects run on
+ * different event queues, for conservative parallel simulation.
+ */
+
+#ifndef __MEM_PARTITION_CHANNEL_HH__
+#define __MEM_PARTITION_CHANNEL_HH__
+
+#include <deque>
+#include <functional>
+#include <mutex>
+
+#include "base/statistics.hh"
+#include "mem/port.hh"
+#include "params/PartitionChannel.hh"
+#include "sim/clocked_object.hh"
+#include "sim/event_pool.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+/**
+ * A PartitionChannel joins a requestor running on one event queue (the
+ * cpu side) to a responder running on another (the mem side), e.g. a
+ * core's private caches to the shared crossbar, when a system is split
+ * into partitions simulated by different host threads.
+ *
+ * Timing requests, responses and snoop responses cross the channel as
+ * events on the receiving side's queue, at least delay or responseDelay
+ * cycles after they were sent.  Those delays are the channel's lookahead:
+ * the event queues synchronise every simQuantum ticks and only then take
+ * in events from other queues, so simQuantum must not exceed the
+ * shortest delay for no event to arrive in its queue's past.  Each
+ * channel lowers simQuantum to its lookahead at init, so the quantum is
+ * derived from the link latencies.
+ *
+ * Snoop requests must be answered as they are sent, as whether a cache
+ * will respond decides where the request goes next.  They, and atomic,
+ * functional and warm accesses, are made synchronously by migrating to the
+ * other side's event queue, which waits for that queue's thread to
+ * finish its current event.  The snooped caches are seen as they are at
+ * their own queue's time, which may be up to a quantum away from the
+ * snooper's.
+ *
+ * Timing packets are always accepted, and are held in the channel until
+ * the receiving side accepts them.
+ */
+class PartitionChannel : public ClockedObject
+{
+  protected:
+
+    class ChannelRequestPort;
+    class ChannelResponsePort;
+
+    /**
+     * One direction of one kind of timing traffic.  Packets are pushed by
+     * the sending side's thread and delivered, in order, by an event on
+     * the receiving side's queue.
+     */
+    class Link
+    {
+      public:
+
+        Link(PartitionChannel &_channel, const std::string &_name,
+             EventQueue *_target, Tick _delay,
+             std::function<bool(PacketPtr)> _send,
+             statistics::Scalar &_delivered);
+
+        /** Send pkt to the other side, called by the sending thread */
+        void push(PacketPtr pkt);
+
+        /** The receiving side is ready for another packet */
+        void retry();
+
+        /** No packets in flight or waiting to be sent */
+        bool empty();
+
+        /** Check a functional access against the packets in flight */
+        bool trySatisfyFunctional(PacketPtr pkt);
+
+        const std::string &name() const { return linkName; }
+
+      protected:
+
+        /** Delivers the packets that are due, one per push */
+        class DeliverEvent : public PooledEvent
+        {
+          public:
+            DeliverEvent(Link &_link)
+                : PooledEvent(Default_Pri, AutoDelete), link(_link)
+            {}
+
+            void process() override { link.deliver(); }
+            const std::string name() const override { return link.name(); }
+
+          private:
+            Link &link;
+        };
+
+        /** Move the packets that have arrived to the ready queue and send
+         *  what the receiver will take */
+        void deliver();
+
+        void trySend();
+
+        PartitionChannel &channel;
+
+        const std::string linkName;
+
+        /** The receiving side's queue */
+        EventQueue *target;
+
+        const Tick delay;
+
+        const std::function<bool(PacketPtr)> send;
+
+        /** Packets in flight and their arrival ticks, which are kept in
+         *  order.  Shared by the sending and receiving threads */
+        std::mutex inboxMutex;
+        std::deque<std::pair<Tick, PacketPtr>> inbox;
+        Tick lastArrival;
+
+        /** Arrived packets the receiver hasn't taken yet, only touched by
+         *  the receiving thread */
+        std::deque<PacketPtr> ready;
+        bool waitingForRetry;
+
+        statistics::Scalar &delivered;
+    };
+
+    class ChannelResponsePort : public ResponsePort
+    {
+      public:
+
+        ChannelResponsePort(const std::string &_name,
+                            PartitionChannel &_channel);
+
+      protected:
+
+        PartitionChannel &channel;
+
+        bool recvTimingReq(PacketPtr pkt) override;
+        bool tryTiming(PacketPtr pkt) override;
+        bool recvTimingSnoopResp(PacketPtr pkt) override;
+        void recvRespRetry() override;
+        Tick recvAtomic(PacketPtr pkt) override;
+        void recvFunctional(PacketPtr pkt) override;
+        WarmResponse recvWarmRequest(const WarmRequest &req) override;
+        void recvWarmEvict(const WarmEviction &evict) override;
+        AddrRangeList getAddrRanges() const override;
+    };
+
+    class ChannelRequestPort : public RequestPort
+    {
+      public:
+
+        ChannelRequestPort(const std::string &_name,
+                           PartitionChannel &_channel);
+
+      protected:
+
+        PartitionChannel &channel;
+
+        bool recvTimingResp(PacketPtr pkt) override;
+        void recvTimingSnoopReq(PacketPtr pkt) override;
+        void recvReqRetry() override;
+        void recvRetrySnoopResp() override;
+        Tick recvAtomicSnoop(PacketPtr pkt) override;
+        void recvFunctionalSnoop(PacketPtr pkt) override;
+        WarmSnoopResponse recvWarmSnoop(const WarmSnoop &snoop) override;
+        void recvRangeChange() override;
+        bool isSnooping() const override;
+    };
+
+    ChannelResponsePort cpuSidePort;
+    ChannelRequestPort memSidePort;
+
+    /** The queues the cpu side and mem side objects run on */
+    EventQueue *cpuSideQueue;
+    EventQueue *memSideQueue;
+
+    struct PartitionChannelStats : public statistics::Group
+    {
+        PartitionChannelStats(statistics::Group *parent);
+
+        statistics::Scalar reqs;
+        statistics::Scalar snoopResps;
+        statistics::Scalar resps;
+        statistics::Scalar migratedSnoops;
+    } stats;
+
+    /** Requests and snoop responses to the mem side */
+    Link reqLink;
+    Link snoopRespLink;
+    /** Responses to the cpu side */
+    Link respLink;
+
+    /** Signal a pending drain once no packets remain */
+    void checkDrained();
+
+  public:
+
+    PARAMS(PartitionChannel);
+    PartitionChannel(const Params &p);
+
+    Port &getPort(const std::string &if_name,
+                  PortID idx=InvalidPortID) override;
+
+    void init() override;
+
+    DrainState drain() override;
+
+    /** The shortest time a packet takes to cross the channel */
+    Tick lookahead() const;
+};
+
+} // namespace gem5
+
+#endif //__MEM_PARTITION_CHANNEL_HH__
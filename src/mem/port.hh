@@ -51,6 +51,7 @@
 #include "mem/protocol/atomic.hh"
 #include "mem/protocol/functional.hh"
 #include "mem/protocol/timing.hh"
+#include "mem/protocol/warm.hh"
 #include "sim/port.hh"
 
 namespace gem5
@@ -72,10 +73,12 @@ class ResponsePort;
  * determine if the port is snooping or not.
  *
  * The three protocols are atomic, timing, and functional, each with its own
- * header file.
+ * header file. Functional warming has a fourth, which by default treats
+ * the peer as memory.
  */
 class RequestPort: public Port, public AtomicRequestProtocol,
-    public TimingRequestProtocol, public FunctionalRequestProtocol
+    public TimingRequestProtocol, public FunctionalRequestProtocol,
+    public WarmRequestProtocol
 {
     friend class ResponsePort;
 
@@ -209,6 +212,26 @@ class RequestPort: public Port, public AtomicRequestProtocol,
      */
     virtual void sendRetryResp();
 
+  public:
+    /* The functional warming protocol. */
+
+    /**
+     * Send a warm request, updating the state of the caches below as an
+     * atomic request for the line would, without a packet.
+     *
+     * @param req The request to send.
+     * @return The state the line is got in.
+     */
+    WarmResponse sendWarmRequest(const WarmRequest &req);
+
+    /**
+     * Send a warm eviction, updating the state of the caches below as
+     * an atomic writeback or clean eviction would, without a packet.
+     *
+     * @param evict The eviction to send.
+     */
+    void sendWarmEvict(const WarmEviction &evict);
+
   protected:
     /**
      * Called to receive an address range change from the peer response
@@ -246,6 +269,13 @@ class RequestPort: public Port, public AtomicRequestProtocol,
     {
         panic("%s was not expecting a snoop retry.\n", name());
     }
+
+    /** A requestor without a cache holds no lines */
+    WarmSnoopResponse
+    recvWarmSnoop(const WarmSnoop &snoop) override
+    {
+        return WarmSnoopResponse{false, false, false};
+    }
 };
 
 class [[deprecated]] MasterPort : public RequestPort
@@ -263,10 +293,12 @@ class [[deprecated]] MasterPort : public RequestPort
  * and get the address ranges that the port responds to.
  *
  * The three protocols are atomic, timing, and functional, each with its own
- * header file.
+ * header file. Functional warming has a fourth, which by default makes the
+ * port act as memory.
  */
 class ResponsePort : public Port, public AtomicResponseProtocol,
-    public TimingResponseProtocol, public FunctionalResponseProtocol
+    public TimingResponseProtocol, public FunctionalResponseProtocol,
+    public WarmResponseProtocol
 {
     friend class RequestPort;
 
@@ -352,6 +384,26 @@ class ResponsePort : public Port, public AtomicResponseProtocol,
         }
     }
 
+  public:
+    /* The functional warming protocol. */
+
+    /**
+     * Send a warm snoop, updating the state of the caches above as an
+     * atomic snoop of the line would, without a packet.
+     *
+     * @param snoop The snoop to send.
+     * @return What the caches above found.
+     */
+    WarmSnoopResponse
+    sendWarmSnoop(const WarmSnoop &snoop)
+    {
+        try {
+            return WarmResponseProtocol::sendSnoop(_requestPort, snoop);
+        } catch (UnboundPortException) {
+            reportUnbound();
+        }
+    }
+
   public:
     /* The timing protocol. */
 
@@ -450,6 +502,20 @@ class ResponsePort : public Port, public AtomicResponseProtocol,
     {
         panic("%s was not expecting a timing snoop response\n", name());
     }
+
+    /**
+     * A responder without a cache acts as memory, which gives a line
+     * writable if no cache keeps a copy, and ignores evictions.
+     * Responders that pass requests on must forward these too, or the
+     * caches beyond them are not warmed.
+     */
+    WarmResponse
+    recvWarmRequest(const WarmRequest &req) override
+    {
+        return WarmResponse{!req.hasSharers, false};
+    }
+
+    void recvWarmEvict(const WarmEviction &evict) override { }
 };
 
 class [[deprecated]] SlavePort : public ResponsePort
@@ -531,6 +597,26 @@ RequestPort::sendRetryResp()
     }
 }
 
+inline WarmResponse
+RequestPort::sendWarmRequest(const WarmRequest &req)
+{
+    try {
+        return WarmRequestProtocol::send(_responsePort, req);
+    } catch (UnboundPortException) {
+        reportUnbound();
+    }
+}
+
+inline void
+RequestPort::sendWarmEvict(const WarmEviction &evict)
+{
+    try {
+        WarmRequestProtocol::sendEvict(_responsePort, evict);
+    } catch (UnboundPortException) {
+        reportUnbound();
+    }
+}
+
 } // namespace gem5
 
 #endif //__MEM_PORT_HH__
@@ -0,0 +1,36 @@
+/**
+ * @file
+ * Definitions of the functional warming protocol.
+ */
+
+#include "mem/protocol/warm.hh"
+
+namespace gem5
+{
+
+/* The request protocol. */
+
+WarmResponse
+WarmRequestProtocol::send(WarmResponseProtocol *peer,
+                          const WarmRequest &req) const
+{
+    return peer->recvWarmRequest(req);
+}
+
+void
+WarmRequestProtocol::sendEvict(WarmResponseProtocol *peer,
+                               const WarmEviction &evict) const
+{
+    peer->recvWarmEvict(evict);
+}
+
+/* The response protocol. */
+
+WarmSnoopResponse
+WarmResponseProtocol::sendSnoop(WarmRequestProtocol *peer,
+                                const WarmSnoop &snoop) const
+{
+    return peer->recvWarmSnoop(snoop);
+}
+
+} // namespace gem5
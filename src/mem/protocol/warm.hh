@@ -0,0 +1,151 @@
+/**
+ * @file
+ * Declaration of the functional warming protocol, which updates the
+ * state of the caches on the path of an access as an atomic access
+ * would, without packets, data or timing.
+ */
+
+#ifndef __MEM_GEM5_PROTOCOL_WARM_HH__
+#define __MEM_GEM5_PROTOCOL_WARM_HH__
+
+#include "base/types.hh"
+#include "mem/request.hh"
+
+namespace gem5
+{
+
+/**
+ * A request for a line sent below by a cache that misses, the analog of
+ * a ReadSharedReq, ReadCleanReq or ReadExReq.
+ */
+struct WarmRequest
+{
+    Addr addr;
+    bool isSecure;
+    RequestorID requestorId;
+    /** The requestor will write the line, as for a ReadExReq */
+    bool needsWritable;
+    /** The requestor only holds clean lines, as for a ReadCleanReq */
+    bool clean;
+    /** Set on the way down if a cache which was snooped keeps a copy */
+    bool hasSharers;
+    /**
+     * Set on the way down if a cache which was snooped passes the line
+     * on, so the request only invalidates the copies in other branches
+     */
+    bool cacheResponding;
+};
+
+/** The state a WarmRequest's requestor gets the line in */
+struct WarmResponse
+{
+    bool writable;
+    bool dirty;
+};
+
+/**
+ * An eviction sent below, the analog of a WritebackDirty, WritebackClean
+ * or CleanEvict.
+ */
+struct WarmEviction
+{
+    Addr addr;
+    bool isSecure;
+    /** The line is passed on, as by a writeback rather than CleanEvict */
+    bool withData;
+    bool dirty;
+    bool writable;
+    /** A cache above the one evicting still has a copy */
+    bool blockCached;
+};
+
+/** A snoop sent above, to keep the caches coherent */
+struct WarmSnoop
+{
+    enum class Op
+    {
+        /** Only check for copies, as for the snoop of an eviction */
+        Query,
+        /** Give up write permission, as for the snoop of a read */
+        Downgrade,
+        /** Give up the line, as for the snoop of a ReadExReq */
+        Invalidate,
+    };
+
+    Addr addr;
+    bool isSecure;
+    Op op;
+};
+
+/** What the caches above found when snooped */
+struct WarmSnoopResponse
+{
+    /** A copy is cached */
+    bool cached;
+    /** A copy was dirty, and is passed to the requestor on invalidation */
+    bool dirty;
+    /** The dirty copy was writable, i.e. the line was Modified */
+    bool writable;
+};
+
+class WarmResponseProtocol;
+
+class WarmRequestProtocol
+{
+    friend class WarmResponseProtocol;
+
+  protected:
+    /**
+     * Send a warm request, updating the state of the caches below as an
+     * atomic request for the line would.
+     *
+     * @param req The request to send.
+     * @return The state the requestor gets the line in.
+     */
+    WarmResponse send(WarmResponseProtocol *peer,
+                      const WarmRequest &req) const;
+
+    /**
+     * Send a warm eviction, updating the state of the caches below as an
+     * atomic writeback or clean eviction would.
+     *
+     * @param evict The eviction to send.
+     */
+    void sendEvict(WarmResponseProtocol *peer,
+                   const WarmEviction &evict) const;
+
+    /**
+     * Receive a warm snoop from the peer.
+     */
+    virtual WarmSnoopResponse recvWarmSnoop(const WarmSnoop &snoop) = 0;
+};
+
+class WarmResponseProtocol
+{
+    friend class WarmRequestProtocol;
+
+  protected:
+    /**
+     * Send a warm snoop, updating the state of the caches above as an
+     * atomic snoop of the line would.
+     *
+     * @param snoop The snoop to send.
+     * @return What the caches above found.
+     */
+    WarmSnoopResponse sendSnoop(WarmRequestProtocol *peer,
+                                const WarmSnoop &snoop) const;
+
+    /**
+     * Receive a warm request from the peer.
+     */
+    virtual WarmResponse recvWarmRequest(const WarmRequest &req) = 0;
+
+    /**
+     * Receive a warm eviction from the peer.
+     */
+    virtual void recvWarmEvict(const WarmEviction &evict) = 0;
+};
+
+} // namespace gem5
+
+#endif //__MEM_GEM5_PROTOCOL_WARM_HH__
@@ -0,0 +1,13 @@
+#include "mem/request.hh"
+
+namespace gem5
+{
+
+SlabPool &
+Request::pool()
+{
+    static SlabPool *requests = new SlabPool;
+    return *requests;
+}
+
+} // namespace gem5
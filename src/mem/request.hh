@@ -54,11 +54,13 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "base/amo.hh"
 #include "base/compiler.hh"
 #include "base/flags.hh"
+#include "base/slab_pool.hh"
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
 #include "mem/htm.hh"
@@ -522,6 +524,17 @@ class Request
 
     ~Request() {}
 
+    /**
+     * Make a shared request, as std::make_shared would, but from the
+     * request pool rather than the heap. Requests made at high rates,
+     * e.g. for each access or writeback, should be made this way.
+     */
+    template <typename... Args>
+    static RequestPtr make(Args&&... args);
+
+    /** The pool of requests made by make(), with their reference counts */
+    static SlabPool &pool();
+
     /**
      * Factory method for creating memory management requests, with
      * unspecified addr and size.
@@ -529,7 +542,7 @@ class Request
     static RequestPtr
     createMemManagement(Flags flags, RequestorID id)
     {
-        auto mgmt_req = std::make_shared<Request>();
+        auto mgmt_req = make();
         mgmt_req->_flags.set(flags);
         mgmt_req->_requestorId = id;
         mgmt_req->_time = curTick();
@@ -611,8 +624,8 @@ class Request
         assert(hasVaddr());
         assert(!hasPaddr());
         assert(split_addr > _vaddr && split_addr < _vaddr + _size);
-        req1 = std::make_shared<Request>(*this);
-        req2 = std::make_shared<Request>(*this);
+        req1 = make(*this);
+        req2 = make(*this);
         req1->_size = split_addr - _vaddr;
         req2->_vaddr = split_addr;
         req2->_size = _size - req1->_size;
@@ -1102,6 +1115,56 @@ class Request
     /** @} */
 };
 
+/**
+ * An allocator taking a shared request and its reference counts together
+ * from the request pool.
+ */
+template <typename T>
+class PooledRequestAllocator
+{
+  public:
+    typedef T value_type;
+
+    PooledRequestAllocator() = default;
+
+    template <typename U>
+    PooledRequestAllocator(const PooledRequestAllocator<U> &other) {}
+
+    T *
+    allocate(std::size_t n)
+    {
+        return static_cast<T *>(Request::pool().allocate(n * sizeof(T)));
+    }
+
+    void
+    deallocate(T *p, std::size_t n)
+    {
+        Request::pool().deallocate(p, n * sizeof(T));
+    }
+
+    template <typename U>
+    bool
+    operator==(const PooledRequestAllocator<U> &other) const
+    {
+        return true;
+    }
+
+    template <typename U>
+    bool
+    operator!=(const PooledRequestAllocator<U> &other) const
+    {
+        return false;
+    }
+};
+
+template <typename... Args>
+RequestPtr
+Request::make(Args&&... args)
+{
+    return std::allocate_shared<Request>(PooledRequestAllocator<Request>(),
+                                         std::forward<Args>(args)...);
+}
+
 } // namespace gem5
 
 #endif // __MEM_REQUEST_HH__
@@ -55,15 +55,22 @@ Consumer::Consumer(ClockedObject *_em, Event::Priority ev_prio)
 void
 Consumer::scheduleEvent(Cycles timeDelta)
 {
-    m_wakeup_ticks.insert(em->clockEdge(timeDelta));
-    scheduleNextWakeup();
+    addWakeup(em->clockEdge(timeDelta));
 }
 
 void
 Consumer::scheduleEventAbsolute(Tick evt_time)
 {
-    m_wakeup_ticks.insert(
-        divCeil(evt_time, em->clockPeriod()) * em->clockPeriod());
+    addWakeup(divCeil(evt_time, em->clockPeriod()) * em->clockPeriod());
+}
+
+void
+Consumer::addWakeup(Tick when)
+{
+    auto it = std::lower_bound(m_wakeup_ticks.begin(), m_wakeup_ticks.end(),
+                               when);
+    if (it == m_wakeup_ticks.end() || *it != when)
+        m_wakeup_ticks.insert(it, when);
     scheduleNextWakeup();
 }
 
@@ -71,14 +78,12 @@ void
 Consumer::scheduleNextWakeup()
 {
     // look for the next tick in the future to schedule
-    auto it = m_wakeup_ticks.lower_bound(em->clockEdge());
+    auto it = std::lower_bound(m_wakeup_ticks.begin(), m_wakeup_ticks.end(),
+                               em->clockEdge());
     if (it != m_wakeup_ticks.end()) {
         Tick when = *it;
         assert(when >= em->clockEdge());
-        if (m_wakeup_event.scheduled() && (when < m_wakeup_event.when()))
-            em->reschedule(m_wakeup_event, when, true);
-        else if (!m_wakeup_event.scheduled())
-            em->schedule(m_wakeup_event, when);
+        em->scheduleBy(m_wakeup_event, when);
     }
 }
 
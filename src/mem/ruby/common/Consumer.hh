@@ -47,8 +47,9 @@
 #ifndef __MEM_RUBY_COMMON_CONSUMER_HH__
 #define __MEM_RUBY_COMMON_CONSUMER_HH__
 
+#include <algorithm>
 #include <iostream>
-#include <set>
+#include <vector>
 
 #include "sim/clocked_object.hh"
 
@@ -75,7 +76,8 @@ class Consumer
     bool
     alreadyScheduled(Tick time)
     {
-        return m_wakeup_ticks.find(time) != m_wakeup_ticks.end();
+        return std::binary_search(m_wakeup_ticks.begin(),
+                                  m_wakeup_ticks.end(), time);
     }
 
     ClockedObject *
@@ -88,10 +90,14 @@ class Consumer
     void scheduleEvent(Cycles timeDelta);
 
   private:
-    std::set<Tick> m_wakeup_ticks;
+    // The pending wakeups, in order.  There are few of them, so a vector
+    // whose storage is reused is cheaper than a set allocating a node for
+    // each
+    std::vector<Tick> m_wakeup_ticks;
     EventFunctionWrapper m_wakeup_event;
     ClockedObject *em;
 
+    void addWakeup(Tick when);
     void scheduleNextWakeup();
     void processCurrentEvent();
 };
@@ -401,6 +401,18 @@ SerialLink::SerialLinkResponsePort::recvFunctional(PacketPtr pkt)
     mem_side_port.sendFunctional(pkt);
 }
 
+WarmResponse
+SerialLink::SerialLinkResponsePort::recvWarmRequest(const WarmRequest &req)
+{
+    return mem_side_port.sendWarmRequest(req);
+}
+
+void
+SerialLink::SerialLinkResponsePort::recvWarmEvict(const WarmEviction &evict)
+{
+    mem_side_port.sendWarmEvict(evict);
+}
+
 bool
 SerialLink::SerialLinkRequestPort::trySatisfyFunctional(PacketPtr pkt)
 {
@@ -199,6 +199,11 @@ class SerialLink : public ClockedObject
             pass it to the serial_link. */
         void recvFunctional(PacketPtr pkt);
 
+        /** When receiving a warm request or eviction from the peer
+            port, pass it through the serial_link. */
+        WarmResponse recvWarmRequest(const WarmRequest &req);
+        void recvWarmEvict(const WarmEviction &evict);
+
         /** When receiving a address range request the peer port,
             pass it to the serial_link. */
         AddrRangeList getAddrRanges() const;
@@ -390,6 +390,85 @@ SnoopFilter::updateResponse(const Packet* cpkt, const ResponsePort&
             __func__, sf_item.requested, sf_item.holder);
 }
 
+SnoopFilter::SnoopList
+SnoopFilter::warmRequest(Addr addr, bool is_secure,
+                         const ResponsePort& cpu_side_port, bool invalidate)
+{
+    Addr line_addr = addr & ~(Addr(linesize - 1));
+    if (is_secure) {
+        line_addr |= LineSecure;
+    }
+    SnoopMask req_port = portToMask(cpu_side_port);
+    auto sf_it = cachedLocations.find(line_addr);
+    if (sf_it == cachedLocations.end()) {
+        if (req_port.any())
+            cachedLocations.emplace(line_addr, SnoopItem{0, req_port});
+        return SnoopList();
+    }
+
+    // Warming only happens while no timing requests are in flight, so
+    // the requested bits can be ignored
+    SnoopItem& sf_item = sf_it->second;
+    SnoopMask interested = (sf_item.holder | sf_item.requested) & ~req_port;
+    if (invalidate)
+        sf_item.holder = req_port;
+    else
+        sf_item.holder |= req_port;
+    DPRINTF(SnoopFilter, "%s: %#x new SF value %x.%x\n", __func__, addr,
+            sf_item.requested, sf_item.holder);
+    eraseIfNullEntry(sf_it);
+
+    return maskToPortList(interested);
+}
+
+SnoopFilter::SnoopList
+SnoopFilter::warmEvict(Addr addr, bool is_secure,
+                       const ResponsePort& cpu_side_port, bool block_cached)
+{
+    Addr line_addr = addr & ~(Addr(linesize - 1));
+    if (is_secure) {
+        line_addr |= LineSecure;
+    }
+    auto sf_it = cachedLocations.find(line_addr);
+    if (sf_it == cachedLocations.end())
+        return SnoopList();
+
+    SnoopMask req_port = portToMask(cpu_side_port);
+    SnoopItem& sf_item = sf_it->second;
+    SnoopMask interested = (sf_item.holder | sf_item.requested) & ~req_port;
+    if (!block_cached) {
+        sf_item.holder &= ~req_port;
+        DPRINTF(SnoopFilter, "%s: %#x new SF value %x.%x\n", __func__, addr,
+                sf_item.requested, sf_item.holder);
+        eraseIfNullEntry(sf_it);
+    }
+
+    return maskToPortList(interested);
+}
+
+SnoopFilter::SnoopList
+SnoopFilter::warmSnoop(Addr addr, bool is_secure, bool invalidate)
+{
+    Addr line_addr = addr & ~(Addr(linesize - 1));
+    if (is_secure) {
+        line_addr |= LineSecure;
+    }
+    auto sf_it = cachedLocations.find(line_addr);
+    if (sf_it == cachedLocations.end())
+        return SnoopList();
+
+    SnoopItem& sf_item = sf_it->second;
+    SnoopMask interested = sf_item.holder | sf_item.requested;
+    if (invalidate) {
+        sf_item.holder = 0;
+        DPRINTF(SnoopFilter, "%s: %#x new SF value %x.%x\n", __func__, addr,
+                sf_item.requested, sf_item.holder);
+        eraseIfNullEntry(sf_it);
+    }
+
+    return maskToPortList(interested);
+}
+
 SnoopFilter::SnoopFilterStats::SnoopFilterStats(statistics::Group *parent)
     : statistics::Group(parent),
       ADD_STAT(totRequests, statistics::units::Count::get(),
@@ -200,6 +200,43 @@ class SnoopFilter : public SimObject
      */
     void updateResponse(const Packet *cpkt, const ResponsePort& cpu_side_port);
 
+    /**
+     * Update the snoop filter with a functional warming request from
+     * above. As warming completes straight away, the requestor becomes a
+     * holder of the line without ever having a request in flight.
+     *
+     * @param addr          Address of the line.
+     * @param is_secure     Whether the line is in the secure space.
+     * @param cpu_side_port ResponsePort the request came from.
+     * @param invalidate    Whether the request invalidates other copies.
+     * @return The other CPU-side ports that need snooping.
+     */
+    SnoopList warmRequest(Addr addr, bool is_secure,
+                          const ResponsePort& cpu_side_port, bool invalidate);
+
+    /**
+     * Update the snoop filter with a functional warming eviction from
+     * above.
+     *
+     * @param addr          Address of the line.
+     * @param is_secure     Whether the line is in the secure space.
+     * @param cpu_side_port ResponsePort the eviction came from.
+     * @param block_cached  Whether the line is still cached above the port.
+     * @return The other CPU-side ports that may still hold the line.
+     */
+    SnoopList warmEvict(Addr addr, bool is_secure,
+                        const ResponsePort& cpu_side_port, bool block_cached);
+
+    /**
+     * Look up a functional warming snoop from below.
+     *
+     * @param addr       Address of the line.
+     * @param is_secure  Whether the line is in the secure space.
+     * @param invalidate Whether the snoop invalidates the line above.
+     * @return The CPU-side ports that need snooping.
+     */
+    SnoopList warmSnoop(Addr addr, bool is_secure, bool invalidate);
+
     virtual void regStats();
 
   protected:
@@ -0,0 +1,125 @@
+"""Automatic partitioning of a system for parallel simulation.
+
+partition_cores() puts each core, and everything under it such as its
+private caches, MMU and interrupt controller, on an event queue of its
+own, leaving the rest of the system on queue 0.  Each event queue is
+simulated by its own host thread.  Every port connection between two
+partitions is then spliced with a PartitionChannel, which carries timing
+packets across as events on the other queue.  The channels take their
+delays from the crossbar they connect to, and the simulation quantum, the
+lookahead of this conservative scheme, is the shortest channel delay.
+
+Where all the cores connect to a crossbar through channels, the channels
+take over the crossbar's frontend and response latencies, so the latency
+of an uncontended access is unchanged.  Otherwise the channel delays are
+added to those of the crossbar.  Channel delays are at least a cycle, as
+the partitions need a lookahead, so a latency of 0, such as the forward
+latency of an L2XBar, becomes a cycle across a channel.
+
+The configuration must be partitioned before m5.instantiate().
+"""
+
+from m5.params import PortRef, VectorPortRef
+from m5.proxy import isproxy
+from m5.util import inform, warn
+
+def eventq_index(obj):
+    """The event queue obj will be simulated on, following the Parent
+    proxies of the objects that don't set one"""
+    while obj is not None:
+        value = obj._values.get('eventq_index')
+        if value is not None and not isproxy(value):
+            return int(value)
+        obj = obj.get_parent()
+    return 0
+
+def _request_refs(obj):
+    for ref in obj._port_refs.values():
+        elements = ref.elements if isinstance(ref, VectorPortRef) else [ref]
+        for element in elements:
+            if element.is_source and isinstance(element.peer, PortRef):
+                yield element
+
+def _crossings(root):
+    """The connections between objects on different event queues, as
+    (requestor ref, responder ref, requestor queue, responder queue)"""
+    crossings = []
+    for obj in root.descendants():
+        for req in _request_refs(obj):
+            resp = req.peer
+            req_eventq = eventq_index(req.simobj)
+            resp_eventq = eventq_index(resp.simobj)
+            if req_eventq != resp_eventq:
+                crossings.append((req, resp, req_eventq, resp_eventq))
+    return crossings
+
+def _channel_delay(latency):
+    """The delay of a channel taking over a crossbar latency"""
+    return max(int(latency), 1)
+
+def partition_cores(root, cpu_lists):
+    """Give each core its own event queue and join the partitions with
+    PartitionChannels.  cpu_lists is a list of lists of CPUs, where the
+    ith CPU of each list shares partition i + 1, e.g. the CPUs simulated
+    first and the CPUs switched to.  Returns the number of partitions"""
+    from m5.objects import BaseXBar, PartitionChannel, System
+
+    num_partitions = 1
+    for cpus in cpu_lists:
+        for i, cpu in enumerate(cpus):
+            cpu.eventq_index = i + 1
+            num_partitions = max(num_partitions, i + 2)
+
+    crossings = _crossings(root)
+
+    # Crossbars whose requestors are all in other partitions can hand
+    # their latencies over to the channels.  System ports are ignored as
+    # they only make functional accesses
+    absorbing = {}
+    for req, resp, req_eventq, resp_eventq in crossings:
+        if isinstance(resp.simobj, BaseXBar):
+            absorbing[resp.simobj] = True
+    for xbar in list(absorbing):
+        xbar_eventq = eventq_index(xbar)
+        for element in xbar._port_refs['cpu_side_ports'].elements:
+            requestor = element.peer
+            if (isinstance(requestor, PortRef) and
+                not isinstance(requestor.simobj, System) and
+                eventq_index(requestor.simobj) == xbar_eventq):
+                absorbing[xbar] = False
+
+    channels = {}
+    for req, resp, req_eventq, resp_eventq in crossings:
+        channel = PartitionChannel(cpu_side_eventq = req_eventq,
+                                   mem_side_eventq = resp_eventq,
+                                   eventq_index = resp_eventq)
+
+        # The channel lives with, and is clocked by, the crossbar it
+        # connects to
+        if isinstance(resp.simobj, BaseXBar):
+            xbar = resp.simobj
+            channel.delay = _channel_delay(xbar.frontend_latency)
+            channel.response_delay = _channel_delay(xbar.response_latency)
+        elif isinstance(req.simobj, BaseXBar):
+            xbar = req.simobj
+            channel.delay = _channel_delay(xbar.forward_latency)
+            channel.response_delay = _channel_delay(xbar.frontend_latency)
+        else:
+            xbar = resp.simobj
+            warn("%s and %s are in different partitions but neither is a "
+                 "crossbar, their channel has a 1 cycle lookahead" %
+                 (req, resp))
+        channels.setdefault(xbar, []).append(channel)
+
+        req.splice(channel.mem_side_port, channel.cpu_side_port)
+
+    for xbar, xbar_channels in channels.items():
+        xbar.partition_channels = xbar_channels
+        if absorbing.get(xbar, False):
+            xbar.frontend_latency = 0
+            xbar.response_latency = 0
+
+    inform("Partitioned the system into %d event queues joined by %d "
+           "channels" % (num_partitions, len(crossings)))
+
+    return num_partitions
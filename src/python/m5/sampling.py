@@ -0,0 +1,244 @@
+"""Sampled simulation.
+
+A Sampler runs a workload mostly on fast, functional CPUs, such as
+AtomicSimpleCPU or a KVM CPU, and switches to detailed CPUs, such as
+Minor or O3, only for short windows of instructions.  The detailed CPUs
+first run warmup instructions, which warm their pipelines and predictors
+and are not measured.  The stats are then reset and the window's
+instructions are measured.  Between windows, an AtomicSimpleCPU with
+caches keeps the caches warm as it runs (functional warming).  A KVM CPU
+runs with the caches bypassed, so they are only warmed by the detailed
+warmup.
+
+The windows can be taken SMARTS style, one every period instructions,
+optionally stopping once the CPI is known to within a target error.  They
+can also be taken at given regions, e.g. the simulation points chosen by
+SimPoint, each with a weight.
+
+The stats are dumped at the end of each window.  The mean CPI, weighted
+for regions, and its confidence interval are printed and written to a
+report in the output directory.
+
+The configuration must have the detailed CPUs switched out.  Sampling
+starts after m5.instantiate(), with the fast CPUs running.
+"""
+
+import math
+import os
+import re
+from statistics import NormalDist
+
+import m5
+from m5.util import fatal, inform, warn
+
+_cause = "sampling phase complete"
+
+def read_simpoints(simpoint_file, weight_file, interval_length):
+    """The regions chosen by SimPoint 3.2, as (first instruction, weight)
+    pairs"""
+    regions = []
+    with open(simpoint_file) as points, open(weight_file) as weights:
+        for point, weight in zip(points, weights):
+            point_match = re.match(r"(\d+)\s+(\d+)", point)
+            weight_match = re.match(r"([0-9\.e\-]+)\s+(\d+)", weight)
+            if not point_match or not weight_match:
+                fatal("Unrecognized line in the simpoint or weight file")
+            regions.append((int(point_match.group(1)) * interval_length,
+                            float(weight_match.group(1))))
+    return sorted(regions)
+
+def _clock_period(cpu):
+    domain = cpu.clk_domain
+    divider = 1
+    while not hasattr(domain, "clock"):
+        divider *= domain.clk_divider
+        domain = domain.clk_domain
+    return domain.clock[0].getValue() * divider
+
+def _critical_value(confidence, samples):
+    """The two sided critical value of Student's t distribution for
+    samples samples, from the normal one by a Cornish-Fisher expansion"""
+    z = NormalDist().inv_cdf(0.5 + confidence / 2)
+    dof = samples - 1
+    return (z + (z ** 3 + z) / (4 * dof) +
+            (5 * z ** 5 + 16 * z ** 3 + 3 * z) / (96 * dof ** 2) +
+            (3 * z ** 7 + 19 * z ** 5 + 17 * z ** 3 - 15 * z) /
+            (384 * dof ** 3))
+
+class Sampler(object):
+    """Alternate between fast and detailed CPUs to estimate the CPI.
+
+    system -- the System, or Root, the CPUs are in
+    cpu_pairs -- (fast CPU, detailed CPU) pairs, the fast ones running
+    window -- instructions measured in each window
+    warmup -- detailed instructions run before each window
+    period -- instructions from the start of one window to the next
+    regions -- (first instruction, weight) pairs to measure instead
+    max_samples -- stop after this many windows, 0 for no limit
+    target_error -- stop once the confidence interval is within this
+                    fraction of the mean, 0 to sample the whole workload
+    min_samples -- windows to take before the error is trusted
+    confidence -- the confidence level of the interval
+    report -- file in the output directory to write the results to
+    warm_caches -- run the fast CPUs with the caches bypassed, for them to
+                   be functionally warmed (see m5.switchCpus)
+
+    Instructions are counted on the first thread of the first CPU.
+    """
+
+    def __init__(self, system, cpu_pairs, window, warmup=0, period=None,
+                 regions=None, max_samples=0, target_error=0.0,
+                 min_samples=30, confidence=0.95, report="sampling.txt",
+                 warm_caches=False):
+        if (period is None) == (regions is None):
+            fatal("A sampler needs either a period or regions")
+        if period is not None and period < window + warmup:
+            fatal("The sampling period (%d) must be at least the window "
+                  "plus the warmup (%d)" % (period, window + warmup))
+
+        self.system = system
+        self.fast_to_detailed = list(cpu_pairs)
+        self.detailed_to_fast = [(detailed, fast)
+                                 for fast, detailed in cpu_pairs]
+        self.window = window
+        self.warmup = warmup
+        self.period = period
+        self.regions = regions
+        self.max_samples = max_samples
+        self.target_error = target_error
+        self.min_samples = max(min_samples, 2)
+        self.confidence = confidence
+        self.report = report
+        self.warm_caches = warm_caches
+
+        # Instructions committed by the first thread so far
+        self.position = 0
+        # (CPI, weight) of each window
+        self.samples = []
+
+    def _region_starts(self):
+        if self.regions is not None:
+            for start, weight in self.regions:
+                yield start, weight
+        else:
+            start = self.period - self.window
+            while True:
+                yield start, 1.0
+                start += self.period
+
+    def _simulate(self, cpu, insts):
+        """Run insts instructions on cpu, or until something else stops
+        the simulation.  Returns the exit event if that happened"""
+        if insts > 0:
+            cpu.scheduleInstStop(0, insts, _cause)
+            exit_event = m5.simulate()
+            if exit_event.getCause() != _cause:
+                return exit_event
+            self.position += insts
+        return None
+
+    def _switch(self, cpu_list):
+        m5.switchCpus(self.system, cpu_list, verbose=False,
+                      warm_caches=self.warm_caches)
+
+    def run(self):
+        """Sample the workload.  Returns the event the simulation exited
+        on, if the workload ended, or None if sampling finished first"""
+        exit_event = None
+        fast_cpu = self.fast_to_detailed[0][0]
+        detailed_cpu = self.fast_to_detailed[0][1]
+        detailed_cpus = [detailed for fast, detailed in self.fast_to_detailed]
+        clock_period = _clock_period(detailed_cpu)
+
+        for start, weight in self._region_starts():
+            if self.max_samples and len(self.samples) >= self.max_samples:
+                break
+            if self._converged():
+                break
+
+            if start < self.position:
+                warn("Skipping the region at instruction %d, which overlaps "
+                     "the last" % start)
+                continue
+            warmup_start = max(start - self.warmup, self.position)
+
+            exit_event = self._simulate(fast_cpu,
+                                        warmup_start - self.position)
+            if exit_event:
+                break
+
+            self._switch(self.fast_to_detailed)
+            exit_event = self._simulate(detailed_cpu, start - self.position)
+            if exit_event:
+                break
+
+            m5.stats.reset()
+            start_tick = m5.curTick()
+            start_insts = [cpu.totalInsts() for cpu in detailed_cpus]
+            exit_event = self._simulate(detailed_cpu, self.window)
+            if exit_event:
+                # The workload ended part way through the window
+                break
+
+            cycles = (m5.curTick() - start_tick) / clock_period
+            insts = sum(cpu.totalInsts() - first
+                        for cpu, first in zip(detailed_cpus, start_insts))
+            cpi = cycles * len(detailed_cpus) / insts
+            self.samples.append((cpi, weight))
+            m5.stats.dump()
+
+            self._switch(self.detailed_to_fast)
+
+        self._write_report(exit_event)
+        return exit_event
+
+    def estimate(self):
+        """The mean CPI and the half width of its confidence interval"""
+        if not self.samples:
+            return 0.0, 0.0
+
+        total_weight = sum(weight for cpi, weight in self.samples)
+        weights = [weight / total_weight for cpi, weight in self.samples]
+        cpis = [cpi for cpi, weight in self.samples]
+        mean = sum(w * cpi for w, cpi in zip(weights, cpis))
+        if len(cpis) < 2:
+            return mean, float("inf")
+
+        # The standard error of a weighted mean, which is the usual one
+        # for equal weights
+        variance = (sum(w * (cpi - mean) ** 2 for w, cpi in zip(weights, cpis))
+                    * len(cpis) / (len(cpis) - 1))
+        std_error = math.sqrt(variance * sum(w * w for w in weights))
+        return mean, _critical_value(self.confidence, len(cpis)) * std_error
+
+    def _converged(self):
+        if not self.target_error or len(self.samples) < self.min_samples:
+            return False
+        mean, half_width = self.estimate()
+        return half_width <= self.target_error * mean
+
+    def _write_report(self, exit_event):
+        mean, half_width = self.estimate()
+        lines = [
+            "samples: %d" % len(self.samples),
+            "window: %d instructions" % self.window,
+            "warmup: %d instructions" % self.warmup,
+            "instructions: %d" % self.position,
+            "cpi: %f" % mean,
+            "cpi %g%% confidence interval: [%f, %f]" %
+                (self.confidence * 100, mean - half_width, mean + half_width),
+            "relative error: %f" %
+                (half_width / mean if mean else float("inf")),
+            "ended by: %s" %
+                (exit_event.getCause() if exit_event else "sampler"),
+        ]
+        if self.regions is None and self.samples:
+            lines.insert(3, "period: %d instructions" % self.period)
+
+        for line in lines:
+            inform("Sampling %s" % line)
+        with open(os.path.join(m5.options.outdir, self.report), "w") as f:
+            f.write("\n".join(lines) + "\n")
+            f.write("\n%10s %12s\n" % ("weight", "cpi"))
+            for cpi, weight in self.samples:
+                f.write("%10.6f %12.6f\n" % (weight, cpi))
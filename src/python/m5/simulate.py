@@ -251,7 +251,7 @@ def _changeMemoryMode(system, mode):
     else:
         print("System already in target mode. Memory mode unchanged.")
 
-def switchCpus(system, cpuList, verbose=True):
+def switchCpus(system, cpuList, verbose=True, warm_caches=False):
     """Switch CPUs in a system.
 
     Note: This method may switch the memory mode of the system if that
@@ -261,6 +261,9 @@ def switchCpus(system, cpuList, verbose=True):
     Arguments:
       system -- Simulated system.
       cpuList -- (old_cpu, new_cpu) tuples
+      warm_caches -- Run CPUs needing the atomic mode with the caches
+                     bypassed instead, keeping the caches' contents so
+                     they can be functionally warmed (see CacheWarmer).
     """
 
     if verbose:
@@ -299,6 +302,9 @@ def switchCpus(system, cpuList, verbose=True):
             raise RuntimeError(
                 "Old CPU (%s) does not support CPU handover." % (old_cpu,))
 
+    if warm_caches and memory_mode_name == "atomic":
+        memory_mode_name = "atomic_noncaching"
+
     MemoryMode = params.allEnums["MemoryMode"]
     try:
         memory_mode = MemoryMode(memory_mode_name).getValue()
@@ -316,10 +322,11 @@ def switchCpus(system, cpuList, verbose=True):
     if system.getMemoryMode() != memory_mode:
         # Flush the memory system if we are switching to a memory mode
         # that disables caches. This typically happens when switching to a
-        # hardware virtualized CPU.
+        # hardware virtualized CPU. Caches being warmed keep their tags.
         if memory_mode == MemoryMode("atomic_noncaching").getValue():
             memWriteback(system)
-            memInvalidate(system)
+            if not warm_caches:
+                memInvalidate(system)
 
         _changeMemoryMode(system, memory_mode)
 
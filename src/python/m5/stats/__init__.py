@@ -183,6 +183,29 @@ def _hdf5Factory(fn, chunking=10, desc=True, formulas=True):
 
     return _m5.stats.initHDF5(fn, chunking, desc, formulas)
 
+@_url_factory([ "columnar", ])
+def _columnarFactory(fn, desc=True):
+    """Output stats in a binary columnar format.
+
+    The names of the stats are written once, then each dump appends a
+    row with the raw value of every stat.  Dumps are much cheaper than
+    with the text format, which makes frequent periodic dumps practical.
+    The file is read with m5.stats.columnar.ColumnarStats.
+
+    Known limitations:
+      * Sparse histograms are left out.
+      * Each dump holds all the stats, even if only some were asked for.
+
+    Parameters:
+      * desc (bool): Output stat descriptions (default: True)
+
+    Example:
+      columnar://stats.cols?desc=False
+
+    """
+
+    return _m5.stats.initColumnar(fn, desc)
+
 @_url_factory(["json"])
 def _jsonFactory(fn):
     """Output stats in JSON format.
@@ -385,6 +408,11 @@ def dump(roots=None):
     if not new_dump and not all_roots:
         return
 
+    # Columnar outputs which have recorded their stats prepare and dump
+    # them without walking the stat groups from Python
+    def recorded(output):
+        return isinstance(output, _m5.stats.Columnar) and output.recorded()
+
     # Only prepare stats the first time we dump them in the same tick.
     if new_dump:
         _m5.stats.processDumpQueue()
@@ -392,10 +420,21 @@ def dump(roots=None):
         sim_root = Root.getInstance()
         if sim_root:
             sim_root.preDumpStats();
-        prepare()
+        if not all(recorded(output) for output in outputList):
+            prepare()
 
     for output in outputList:
-        if isinstance(output, JsonOutputVistor):
+        if recorded(output):
+            # A columnar output dumps every stat, once per tick
+            if new_dump:
+                output.dumpRecorded()
+        elif isinstance(output, _m5.stats.Columnar):
+            # The first dump records all the stats
+            if output.valid():
+                output.begin()
+                _dump_to_visitor(output)
+                output.end()
+        elif isinstance(output, JsonOutputVistor):
             if not all_roots:
                 output.dump(Root.getInstance())
             else:
@@ -420,6 +459,19 @@ def reset():
 
     _m5.stats.processResetQueue()
 
+def host_profile(by_event=False):
+    '''The host time spent on the events of each SimObject, or on each
+    event, most first, if the simulation is being host profiled.  Each
+    entry has the sim_object, the event (empty for totals), the count of
+    events processed and the host_ns spent on them since the stats were
+    last reset.'''
+
+    if not _m5.stats.hostProfileEnabled():
+        fatal("Host profiling isn't enabled, set Root.host_profile")
+    if by_event:
+        return _m5.stats.hostProfileByEvent()
+    return _m5.stats.hostProfileBySimObject()
+
 flags = attrdict({
     'none'    : 0x0000,
     'init'    : 0x0001,
@@ -0,0 +1,132 @@
+"""Reader for columnar stat files.
+
+Columnar stat files, written by the columnar:// stat output, hold the
+names of the stats once, followed by a row of raw values for each dump.
+They are meant for frequent periodic dumps, which would take a long time
+to format as text.
+
+    stats = ColumnarStats("m5out/stats.cols")
+    stats.ticks                       # the tick of each dump
+    stats["system.cpu.numCycles"]     # its value at each dump
+    stats["system.cpu.op_class"]      # a list of values at each dump
+    stats.column("system.cpu.op_class", "IntAlu")
+
+The reader only needs the Python standard library, so it can be used
+outside gem5, e.g. "python3 columnar.py m5out/stats.cols" prints a stat
+per line, with its values at each dump.
+"""
+
+from array import array
+from collections import namedtuple
+import struct
+import sys
+
+_magic = b"gem5col\0"
+_version = 1
+
+Stat = namedtuple("Stat", "name kind unit desc labels first")
+
+class ColumnarStats(object):
+    """The contents of a columnar stat file.
+
+    stats -- the Stat of each name, with the index of its first column
+    ticks -- the tick of each dump
+    rows -- the values of all the columns at each dump, as arrays
+    """
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            data = f.read()
+
+        if data[:len(_magic)] != _magic:
+            raise ValueError("%s isn't a columnar stat file" % path)
+        offset = len(_magic)
+        version, = struct.unpack_from("=I", data, offset)
+        if version != _version:
+            raise ValueError("%s is of version %d, or of another byte "
+                             "order, rather than %d" %
+                             (path, version, _version))
+        offset += 4
+
+        def read_uint32():
+            nonlocal offset
+            value, = struct.unpack_from("=I", data, offset)
+            offset += 4
+            return value
+
+        def read_string():
+            nonlocal offset
+            length = read_uint32()
+            value = data[offset:offset + length].decode()
+            offset += length
+            return value
+
+        self.stats = {}
+        columns = 0
+        for i in range(read_uint32()):
+            name = read_string()
+            kind = read_string()
+            unit = read_string()
+            desc = read_string()
+            labels = [ read_string() for j in range(read_uint32()) ]
+            self.stats[name] = Stat(name, kind, unit, desc, labels, columns)
+            columns += len(labels)
+        self.columns = columns
+
+        # A dump still being written is left out
+        row_size = 8 + 8 * columns
+        self.ticks = []
+        self.rows = []
+        while offset + row_size <= len(data):
+            tick, = struct.unpack_from("=Q", data, offset)
+            values = array("d")
+            values.frombytes(data[offset + 8:offset + row_size])
+            self.ticks.append(tick)
+            self.rows.append(values)
+            offset += row_size
+
+    def __len__(self):
+        return len(self.rows)
+
+    def __contains__(self, name):
+        return name in self.stats
+
+    def __getitem__(self, name):
+        """The values of a stat at each dump, a number for scalars and a
+        list in the order of its labels for the others"""
+        stat = self.stats[name]
+        if stat.kind == "scalar":
+            return [ row[stat.first] for row in self.rows ]
+        last = stat.first + len(stat.labels)
+        return [ list(row[stat.first:last]) for row in self.rows ]
+
+    def column(self, name, label):
+        """The value of one column of a stat, e.g. a vector's element or a
+        distribution's "samples", at each dump"""
+        stat = self.stats[name]
+        index = stat.first + stat.labels.index(label)
+        return [ row[index] for row in self.rows ]
+
+    def dump(self, index):
+        """The value of each stat at a dump, as a dict"""
+        return dict((name, self[name][index]) for name in self.stats)
+
+    def to_numpy(self):
+        """The ticks and a dumps by columns array of the values"""
+        import numpy
+
+        ticks = numpy.array(self.ticks, dtype=numpy.uint64)
+        values = numpy.array(self.rows, dtype=numpy.float64)
+        return ticks, values.reshape(len(self.rows), self.columns)
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        sys.exit("Usage: %s <stat file>" % sys.argv[0])
+
+    stats = ColumnarStats(sys.argv[1])
+    print("tick %s" % " ".join(str(tick) for tick in stats.ticks))
+    for name, stat in stats.stats.items():
+        for label in stat.labels:
+            full_name = "%s::%s" % (name, label) if label else name
+            print("%s %s" % (full_name, " ".join(
+                "%g" % value for value in stats.column(name, label))))
@@ -42,6 +42,7 @@
 #include "pybind11/stl.h"
 
 #include "base/statistics.hh"
+#include "base/stats/columnar.hh"
 #include "base/stats/text.hh"
 #include "config/have_hdf5.hh"
 
@@ -49,6 +50,7 @@
 #include "base/stats/hdf5.hh"
 
 #endif
+#include "sim/host_profile.hh"
 #include "sim/stat_control.hh"
 #include "sim/stat_register.hh"
 
@@ -112,6 +114,7 @@ pybind_init_stats(py::module_ &m_native)
         .def("initSimStats", &statistics::initSimStats)
         .def("initText", &statistics::initText,
             py::return_value_policy::reference)
+        .def("initColumnar", &statistics::initColumnar)
 #if HAVE_HDF5
         .def("initHDF5", &statistics::initHDF5)
 #endif
@@ -125,6 +128,16 @@ pybind_init_stats(py::module_ &m_native)
         .def("enable", &statistics::enable)
         .def("enabled", &statistics::enabled)
         .def("statsList", &statistics::statsList)
+        .def("hostProfileEnabled", &host_profile::enabled)
+        .def("hostProfileBySimObject", &host_profile::bySimObject)
+        .def("hostProfileByEvent", &host_profile::byEvent)
+        ;
+
+    py::class_<host_profile::Entry>(m, "HostProfileEntry")
+        .def_readonly("sim_object", &host_profile::Entry::simObject)
+        .def_readonly("event", &host_profile::Entry::event)
+        .def_readonly("count", &host_profile::Entry::count)
+        .def_readonly("host_ns", &host_profile::Entry::hostNs)
         ;
 
     py::class_<statistics::Output>(m, "Output")
@@ -135,6 +148,11 @@ pybind_init_stats(py::module_ &m_native)
         .def("endGroup", &statistics::Output::endGroup)
         ;
 
+    py::class_<statistics::Columnar, statistics::Output>(m, "Columnar")
+        .def("recorded", &statistics::Columnar::recorded)
+        .def("dumpRecorded", &statistics::Columnar::dumpRecorded)
+        ;
+
     py::class_<statistics::Info,
         std::unique_ptr<statistics::Info, py::nodelete>>(m, "Info")
         .def_readwrite("name", &statistics::Info::name)
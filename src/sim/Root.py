@@ -67,6 +67,19 @@ class Root(SimObject):
     # Needs to be set explicitly for a multi-eventq simulation.
     sim_quantum = Param.Tick(0, "simulation quantum")
 
+    # Indexing the event queues with calendars speeds up scheduling when
+    # they hold many distinct ticks, but slows down short queues.
+    eventq_calendar_buckets = Param.Unsigned(0, "number of buckets of the "
+        "event queues' calendars, a power of two, or 0 for none")
+    eventq_calendar_bucket_width = Param.Latency("1ns",
+        "time covered by each bucket of the event queues' calendars")
+
+    # Host profiling times each event processed, which slows down the
+    # simulation a little.
+    host_profile = Param.String("", "file in the output directory to "
+        "report the host time spent on each SimObject's events to when the "
+        "stats are dumped, or empty not to profile")
+
     full_system = Param.Bool("if this is a full system simulation")
 
     # Time syncing prevents the simulation from running faster than real time.
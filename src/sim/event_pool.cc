@@ -0,0 +1,49 @@
+#include "sim/event_pool.hh"
+
+#include "base/slab_pool.hh"
+
+namespace gem5
+{
+
+namespace event_pool
+{
+
+namespace
+{
+
+SlabPool &
+pool()
+{
+    static SlabPool *events = new SlabPool;
+    return *events;
+}
+
+} // anonymous namespace
+
+void *
+allocate(std::size_t size)
+{
+    return pool().allocate(size);
+}
+
+void
+deallocate(void *block, std::size_t size)
+{
+    pool().deallocate(block, size);
+}
+
+Counter
+allocations()
+{
+    return pool().allocations();
+}
+
+Counter
+reuses()
+{
+    return pool().reuses();
+}
+
+} // namespace event_pool
+
+} // namespace gem5
@@ -0,0 +1,60 @@
+/**
+ * @file
+ * Pooled storage for events created and deleted at high rates.
+ */
+
+#ifndef __SIM_EVENT_POOL_HH__
+#define __SIM_EVENT_POOL_HH__
+
+#include <cstddef>
+
+#include "base/types.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+/**
+ * Storage for events that are created with new and deleted once
+ * processed, often one per packet or instruction, from a SlabPool of its
+ * own.  Each host thread has its own slabs and free lists, so an event
+ * scheduled on another thread's queue joins that thread's free lists
+ * once it is deleted.
+ */
+namespace event_pool
+{
+
+void *allocate(std::size_t size);
+void deallocate(void *block, std::size_t size);
+
+/** Blocks allocated by all threads, and those reused from free lists */
+Counter allocations();
+Counter reuses();
+
+} // namespace event_pool
+
+/**
+ * An event allocated from the event pool when created with new, e.g. an
+ * AutoDelete event scheduled for each request.
+ */
+class PooledEvent : public Event
+{
+  public:
+    using Event::Event;
+
+    static void *
+    operator new(std::size_t size)
+    {
+        return event_pool::allocate(size);
+    }
+
+    static void
+    operator delete(void *block, std::size_t size)
+    {
+        event_pool::deallocate(block, size);
+    }
+};
+
+} // namespace gem5
+
+#endif // __SIM_EVENT_POOL_HH__
@@ -31,12 +31,15 @@
 #include "sim/eventq.hh"
 
 #include <cassert>
+#include <chrono>
 #include <iostream>
 #include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "cpu/smt.hh"
@@ -58,6 +61,18 @@ std::vector<EventQueue *> mainEventQueue;
 __thread EventQueue *_curEventQueue = NULL;
 bool inParallelMode = false;
 
+namespace
+{
+
+// The calendar every main event queue is to use
+Tick calendarBucketWidth = 0;
+unsigned calendarBuckets = 0;
+
+// Whether the main event queues are to be profiled
+bool profiling = false;
+
+} // anonymous namespace
+
 EventQueue *
 getEventQueue(uint32_t index)
 {
@@ -65,11 +80,33 @@ getEventQueue(uint32_t index)
         numMainEventQueues++;
         mainEventQueue.push_back(
             new EventQueue(csprintf("MainEventQueue-%d", index)));
+        if (calendarBuckets)
+            mainEventQueue.back()->useCalendar(calendarBucketWidth,
+                                               calendarBuckets);
+        if (profiling)
+            mainEventQueue.back()->startProfiling();
     }
 
     return mainEventQueue[index];
 }
 
+void
+useEventCalendars(Tick bucket_width, unsigned num_buckets)
+{
+    calendarBucketWidth = bucket_width;
+    calendarBuckets = num_buckets;
+    for (uint32_t i = 0; i < numMainEventQueues; ++i)
+        mainEventQueue[i]->useCalendar(bucket_width, num_buckets);
+}
+
+void
+profileEventQueues()
+{
+    profiling = true;
+    for (uint32_t i = 0; i < numMainEventQueues; ++i)
+        mainEventQueue[i]->startProfiling();
+}
+
 #ifndef NDEBUG
 Counter Event::instanceCounter = 0;
 #endif
@@ -111,24 +148,37 @@ Event::insertBefore(Event *event, Event *curr)
 void
 EventQueue::insert(Event *event)
 {
-    // Deal with the head case
-    if (!head || *event <= *head) {
-        head = Event::insertBefore(event, head);
-        return;
-    }
-
-    // Figure out either which 'in bin' list we are on, or where a new list
-    // needs to be inserted
-    Event *prev = head;
-    Event *curr = head->nextBin;
-    while (curr && *curr < *event) {
-        prev = curr;
-        curr = curr->nextBin;
+    Event *prev = NULL;
+    Event *curr = head;
+
+    // Unless this is the head case, figure out either which 'in bin' list
+    // we are on, or where a new list needs to be inserted, starting as
+    // close to it as the calendar knows
+    if (head && *head < *event) {
+        prev = calendar ? calendar->binBefore(event, _curTick) : NULL;
+        if (!prev)
+            prev = head;
+        curr = prev->nextBin;
+        while (curr && *curr < *event) {
+            prev = curr;
+            curr = curr->nextBin;
+        }
     }
 
     // Note: this operation may render all nextBin pointers on the
     // prev 'in bin' list stale (except for the top one)
-    prev->nextBin = Event::insertBefore(event, curr);
+    Event *top = Event::insertBefore(event, curr);
+    if (prev)
+        prev->nextBin = top;
+    else
+        head = top;
+
+    if (calendar) {
+        if (curr && *curr == *event)
+            calendar->replaceTop(curr, event);
+        else
+            calendar->addBin(event, _curTick);
+    }
 }
 
 Event *
@@ -170,28 +220,42 @@ EventQueue::remove(Event *event)
 
     assert(event->queue == this);
 
-    // deal with an event on the head's 'in bin' list (event has the same
-    // time as the head)
-    if (*head == *event) {
-        head = Event::removeItem(event, head);
-        return;
-    }
+    Event *prev = NULL;
+    Event *curr = head;
+
+    // Unless the event is on the head's 'in bin' list (event has the same
+    // time as the head), find the 'in bin' list that this event belongs on
+    if (*head != *event) {
+        prev = calendar ? calendar->binBefore(event, _curTick) : NULL;
+        if (!prev)
+            prev = head;
+        curr = prev->nextBin;
+        while (curr && *curr < *event) {
+            prev = curr;
+            curr = curr->nextBin;
+        }
 
-    // Find the 'in bin' list that this event belongs on
-    Event *prev = head;
-    Event *curr = head->nextBin;
-    while (curr && *curr < *event) {
-        prev = curr;
-        curr = curr->nextBin;
+        if (!curr || *curr != *event)
+            panic("event not found!");
     }
 
-    if (!curr || *curr != *event)
-        panic("event not found!");
+    bool last_in_bin = event == curr && !event->nextInBin;
 
     // curr points to the top item of the the correct 'in bin' list, when
     // we remove an item, it returns the new top item (which may be
     // unchanged)
-    prev->nextBin = Event::removeItem(event, curr);
+    Event *top = Event::removeItem(event, curr);
+    if (prev)
+        prev->nextBin = top;
+    else
+        head = top;
+
+    if (calendar && event == curr) {
+        if (last_in_bin)
+            calendar->removeBin(event, prev, top);
+        else
+            calendar->replaceTop(event, top);
+    }
 }
 
 Event *
@@ -208,10 +272,16 @@ EventQueue::serviceOne()
 
         // pop the stack
         head = next;
+
+        if (calendar)
+            calendar->replaceTop(event, next);
     } else {
         // this was the only element on the 'in bin' list, so get rid of
         // the 'in bin' list and point to the next bin list
         head = head->nextBin;
+
+        if (calendar)
+            calendar->removeBin(event, NULL, head);
     }
 
     // handle action
@@ -220,7 +290,18 @@ EventQueue::serviceOne()
         setCurTick(event->when());
         if (debug::Event)
             event->trace("executed");
-        event->process();
+        if (profile) {
+            // The event may be deleted as it is processed
+            EventProfile::Record &record = profile->record(event);
+            auto start = std::chrono::steady_clock::now();
+            event->process();
+            record.hostNs += std::chrono::duration_cast<
+                std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+            record.count++;
+        } else {
+            event->process();
+        }
         if (event->isExitEvent()) {
             assert(!event->flags.isSet(Event::Managed) ||
                    !event->flags.isSet(Event::IsMainQueue)); // would be silly
@@ -357,6 +438,11 @@ EventQueue::replaceHead(Event* s)
 {
     Event* t = head;
     head = s;
+
+    // The calendar would point into the list being replaced
+    if (calendar)
+        calendar->clear();
+
     return t;
 }
 
@@ -416,8 +502,194 @@ Event::dump() const
 }
 
 EventQueue::EventQueue(const std::string &n)
-    : objName(n), head(NULL), _curTick(0)
+    : objName(n), head(NULL), _curTick(0), numScheduled(0), numCoalesced(0)
+{
+}
+
+void
+EventQueue::startProfiling()
+{
+    if (!profile)
+        profile.reset(new EventProfile);
+}
+
+EventProfile::Record &
+EventProfile::record(const Event *event)
+{
+    if (event->isManaged()) {
+        Record *&by_description = byDescription[event->description()];
+        if (!by_description) {
+            _records.emplace_back();
+            by_description = &_records.back();
+            by_description->description = event->description();
+        }
+        return *by_description;
+    }
+
+    auto &by_event = byEvent[event];
+    if (by_event.first != event->description()) {
+        by_event.first = event->description();
+        Record *&by_name = byName[{event->name(), event->description()}];
+        if (!by_name) {
+            _records.emplace_back();
+            by_name = &_records.back();
+            by_name->name = event->name();
+            by_name->description = event->description();
+        }
+        by_event.second = by_name;
+    }
+    return *by_event.second;
+}
+
+void
+EventProfile::reset()
+{
+    for (auto &record : _records) {
+        record.count = 0;
+        record.hostNs = 0;
+    }
+}
+
+void
+EventQueue::useCalendar(Tick bucket_width, unsigned num_buckets)
+{
+    if (num_buckets)
+        calendar.reset(new EventCalendar(bucket_width, num_buckets));
+    else
+        calendar.reset();
+}
+
+EventCalendar::EventCalendar(Tick bucket_width, unsigned num_buckets)
+    : bucketWidth(bucket_width), numBuckets(num_buckets),
+      bucketMask(num_buckets - 1), buckets(num_buckets),
+      occupancy(divCeil(num_buckets, 64), 0)
+{
+    fatal_if(bucket_width == 0, "Event calendar buckets must cover at "
+             "least one tick.\n");
+    fatal_if(num_buckets < 64 || !isPowerOf2(num_buckets),
+             "Event calendars must have a power of two, and at least 64, "
+             "buckets, not %d.\n", num_buckets);
+}
+
+int
+EventCalendar::lastOccupied(unsigned bucket, unsigned count) const
+{
+    while (count > 0) {
+        unsigned bit = bucket % 64;
+        uint64_t bits = occupancy[bucket / 64] & mask(bit + 1);
+        if (bits) {
+            unsigned found = bucket - bit + findMsbSet(bits);
+            return bucket - found < count ? found : -1;
+        }
+        if (count <= bit + 1)
+            return -1;
+        count -= bit + 1;
+        bucket = (bucket - bit - 1) & bucketMask;
+    }
+    return -1;
+}
+
+Event *
+EventCalendar::binBefore(const Event *event, Tick cur_tick) const
+{
+    // Look back from event's bucket to the current tick's, or through
+    // the whole wheel for events beyond it
+    Tick event_window = window(event);
+    Tick cur_window = cur_tick / bucketWidth;
+    unsigned bucket, count;
+    if (event_window < cur_window + numBuckets) {
+        bucket = bucketOf(event_window);
+        count = event_window > cur_window ? event_window - cur_window + 1 : 1;
+    } else {
+        bucket = bucketOf(cur_window + numBuckets - 1);
+        count = numBuckets;
+    }
+
+    while (count > 0) {
+        int found = lastOccupied(bucket, count);
+        if (found < 0)
+            return nullptr;
+
+        // The bins a bucket points to may be in a later window if they
+        // were indexed before the current tick moved on
+        const Bucket &b = buckets[found];
+        Event *before = nullptr;
+        if (*b.first < *event)
+            before = b.first;
+        if (*b.last < *event && (!before || *before < *b.last))
+            before = b.last;
+        if (before)
+            return before;
+
+        unsigned skipped = ((bucket - found) & bucketMask) + 1;
+        if (count <= skipped)
+            return nullptr;
+        count -= skipped;
+        bucket = (found - 1) & bucketMask;
+    }
+    return nullptr;
+}
+
+void
+EventCalendar::addBin(Event *top, Tick cur_tick)
+{
+    Tick top_window = window(top);
+    if (top_window >= cur_tick / bucketWidth + numBuckets)
+        return;
+
+    unsigned bucket = bucketOf(top_window);
+    Bucket &b = buckets[bucket];
+    if (!occupied(bucket) || b.window != top_window) {
+        // Anything still in the bucket is in an earlier window, so of no
+        // more use
+        b.window = top_window;
+        b.first = b.last = top;
+        occupancy[bucket / 64] |= 1ULL << (bucket % 64);
+    } else if (*top < *b.first) {
+        b.first = top;
+    } else if (*b.last < *top) {
+        b.last = top;
+    }
+}
+
+void
+EventCalendar::replaceTop(Event *old_top, Event *new_top)
+{
+    unsigned bucket = bucketOf(window(old_top));
+    if (!occupied(bucket))
+        return;
+
+    Bucket &b = buckets[bucket];
+    if (b.first == old_top)
+        b.first = new_top;
+    if (b.last == old_top)
+        b.last = new_top;
+}
+
+void
+EventCalendar::removeBin(Event *top, Event *prev, Event *next)
+{
+    unsigned bucket = bucketOf(window(top));
+    if (!occupied(bucket))
+        return;
+
+    // Replace the bin with one of its neighbours in the same window
+    Bucket &b = buckets[bucket];
+    Event *same_prev = prev && window(prev) == b.window ? prev : nullptr;
+    Event *same_next = next && window(next) == b.window ? next : nullptr;
+    if (b.first == top)
+        b.first = same_next ? same_next : same_prev;
+    if (b.last == top)
+        b.last = same_prev ? same_prev : same_next;
+
+    if (!b.first || !b.last)
+        occupancy[bucket / 64] &= ~(1ULL << (bucket % 64));
+}
+
+void
+EventCalendar::clear()
 {
+    std::fill(occupancy.begin(), occupancy.end(), 0);
 }
 
 void
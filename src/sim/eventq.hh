@@ -38,11 +38,16 @@
 #include <algorithm>
 #include <cassert>
 #include <climits>
+#include <deque>
 #include <functional>
 #include <iosfwd>
 #include <list>
+#include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "base/debug.hh"
 #include "base/flags.hh"
@@ -85,6 +90,15 @@ extern bool inParallelMode;
 //! is with in bounds.
 EventQueue *getEventQueue(uint32_t index);
 
+//! Index the bins of the main event queues, those allocated and those
+//! yet to be, with calendars of num_buckets buckets of bucket_width
+//! ticks, or stop indexing them if num_buckets is 0.
+void useEventCalendars(Tick bucket_width, unsigned num_buckets);
+
+//! Measure the host time the main event queues, those allocated and
+//! those yet to be, spend processing each event.
+void profileEventQueues();
+
 inline EventQueue *curEventQueue() { return _curEventQueue; }
 inline void curEventQueue(EventQueue *q);
 
@@ -581,6 +595,122 @@ operator!=(const Event &l, const Event &r)
     return l.when() != r.when() || l.priority() != r.priority();
 }
 
+/**
+ * An index of the bins of an event queue by time, for queues holding
+ * many distinct ticks.  Finding where an event goes in the sorted list
+ * of bins otherwise means walking it from the head.
+ *
+ * The calendar is a wheel of buckets, each covering bucketWidth ticks
+ * (a window), which together cover the numBuckets windows from the
+ * current tick's.  Each bucket remembers up to two bins of its window,
+ * the first and last it knows of, and a bitmap of the buckets holding
+ * any lets a lookup skip the empty ones.  Bins beyond the wheel are not
+ * indexed, so are found by walking from the last bin that is.
+ *
+ * The bins the calendar points to are only starting points for walks
+ * along the list, which stays the authority on the order of events, so
+ * the calendar can be cleared, or miss bins, at any time.  It must
+ * however be told whenever a bin it may point to stops being the top of
+ * its bin, as only the tops have valid nextBin pointers.
+ */
+class EventCalendar
+{
+  public:
+    EventCalendar(Tick bucket_width, unsigned num_buckets);
+
+    /**
+     * A bin to start walking from to find where event goes: a bin before
+     * event's, as late as the calendar knows of, or nullptr if it knows
+     * of none.
+     */
+    Event *binBefore(const Event *event, Tick cur_tick) const;
+
+    /** Index a new bin, whose top is top */
+    void addBin(Event *top, Tick cur_tick);
+
+    /** The top of a bin changed from old_top to new_top */
+    void replaceTop(Event *old_top, Event *new_top);
+
+    /** The bin whose top was top, between the bins prev and next (which
+     *  may be nullptr), has gone */
+    void removeBin(Event *top, Event *prev, Event *next);
+
+    /** Forget all the bins */
+    void clear();
+
+  private:
+    struct Bucket
+    {
+        /** The window the bins are in, when divided by bucketWidth */
+        Tick window;
+        Event *first;
+        Event *last;
+    };
+
+    Tick window(const Event *event) const
+    {
+        return event->when() / bucketWidth;
+    }
+
+    unsigned bucketOf(Tick window) const { return window & bucketMask; }
+
+    bool occupied(unsigned bucket) const
+    {
+        return occupancy[bucket / 64] & (1ULL << (bucket % 64));
+    }
+
+    /** The occupied bucket closest before or at bucket, looking at no
+     *  more than count buckets, or -1 if there is none */
+    int lastOccupied(unsigned bucket, unsigned count) const;
+
+    const Tick bucketWidth;
+    const unsigned numBuckets;
+    const unsigned bucketMask;
+
+    std::vector<Bucket> buckets;
+    std::vector<uint64_t> occupancy;
+};
+
+/**
+ * The host time an event queue spent processing its events, and the
+ * number it processed, by event.  Events are told apart by name and
+ * description, which are looked up the first time an event is seen.
+ * Managed events, e.g. those deleted once processed, are only told apart
+ * by description, as there may be one per packet or instruction.
+ */
+class EventProfile
+{
+  public:
+    struct Record
+    {
+        /** Empty for managed events */
+        std::string name;
+        std::string description;
+
+        Counter count = 0;
+        uint64_t hostNs = 0;
+    };
+
+    /** The record to charge event to */
+    Record &record(const Event *event);
+
+    /** Clear the counts */
+    void reset();
+
+    const std::deque<Record> &records() const { return _records; }
+
+  private:
+    /** A deque, so records stay in place as more are added */
+    std::deque<Record> _records;
+
+    /** The records of the events seen so far, and their descriptions to
+     *  tell if an event has been replaced by another at the same address */
+    std::unordered_map<const Event *, std::pair<const char *, Record *>>
+        byEvent;
+    std::unordered_map<const char *, Record *> byDescription;
+    std::map<std::pair<std::string, std::string>, Record *> byName;
+};
+
 /**
  * Queue of events sorted in time order
  *
@@ -628,6 +758,17 @@ class EventQueue
     Event *head;
     Tick _curTick;
 
+    //! Index of the bins, if enabled.
+    std::unique_ptr<EventCalendar> calendar;
+
+    //! Counts of schedule calls by the owning thread and calls to
+    //! scheduleBy() needing none.
+    Counter numScheduled;
+    Counter numCoalesced;
+
+    //! Host time spent on each event, if profiling.
+    std::unique_ptr<EventProfile> profile;
+
     //! Mutex to protect async queue.
     UncontendedMutex async_queue_mutex;
 
@@ -755,6 +896,25 @@ class EventQueue
     void name(const std::string &st) { objName = st; }
     /** @}*/ //end of api_eventq group
 
+    /**
+     * Index the bins with a calendar of num_buckets buckets of
+     * bucket_width ticks, or stop indexing them if num_buckets is 0.
+     * Can be changed while events are scheduled.
+     *
+     * @see EventCalendar
+     */
+    void useCalendar(Tick bucket_width, unsigned num_buckets);
+
+    /**
+     * Start measuring the host time spent processing each event.
+     *
+     * @see EventProfile
+     */
+    void startProfiling();
+
+    /** The host time spent on each event, or nullptr if not profiling */
+    EventProfile *getProfile() const { return profile.get(); }
+
     /**
      * Schedule the given event on this queue. Safe to call from any thread.
      *
@@ -780,6 +940,7 @@ class EventQueue
             asyncInsert(event);
         } else {
             insert(event);
+            numScheduled++;
         }
         event->flags.set(Event::Scheduled);
         event->acquire();
@@ -833,6 +994,7 @@ class EventQueue
 
         event->setWhen(when, this);
         insert(event);
+        numScheduled++;
         event->flags.clear(Event::Squashed);
         event->flags.set(Event::Scheduled);
 
@@ -840,6 +1002,35 @@ class EventQueue
             event->trace("rescheduled");
     }
 
+    /**
+     * Make sure the specified event happens no later than when, for
+     * objects asking to be woken at a tick when they may already be.  An
+     * event already scheduled at or before when is left alone, saving a
+     * reschedule, and one scheduled later is moved to when.  Should be
+     * called only from the owning thread.
+     *
+     * @return true if the event was scheduled or moved.
+     *
+     * @ingroup api_eventq
+     */
+    bool
+    scheduleBy(Event *event, Tick when)
+    {
+        if (event->scheduled() && !event->squashed() &&
+            event->when() <= when) {
+            numCoalesced++;
+            return false;
+        }
+
+        reschedule(event, when, true);
+        return true;
+    }
+
+    /** Events scheduled on this queue by its own thread */
+    Counter scheduledCount() const { return numScheduled; }
+    /** Calls to scheduleBy() left to an event already scheduled */
+    Counter coalescedCount() const { return numCoalesced; }
+
     Tick nextTick() const { return head->when(); }
     void setCurTick(Tick newVal) { _curTick = newVal; }
 
@@ -1039,6 +1230,15 @@ class EventManager
         eventq->reschedule(&event, when, always);
     }
 
+    /**
+     * @ingroup api_eventq
+     */
+    bool
+    scheduleBy(Event &event, Tick when)
+    {
+        return eventq->scheduleBy(&event, when);
+    }
+
     /**
      * @ingroup api_eventq
      */
@@ -0,0 +1,142 @@
+/**
+ * @file
+ * Measures the rate at which an event queue schedules, deschedules and
+ * services events when many distinct ticks are pending, with the bins
+ * kept in a plain sorted list and indexed by a calendar.  Also checks
+ * the two service events in the same order.
+ */
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+const Tick calendarBucketWidth = 1000;
+const unsigned calendarBuckets = 4096;
+
+/**
+ * An event which, like a busy clocked object, reschedules itself some
+ * cycles ahead each time it is processed.
+ */
+class HoldEvent : public Event
+{
+  public:
+    HoldEvent(EventQueue &_eq, std::mt19937 &_rng, int _id, Priority p,
+              std::vector<int> *_serviced)
+        : Event(p), eq(_eq), rng(_rng), id(_id), serviced(_serviced)
+    {}
+
+    /** Between 1 and 2000 500 tick cycles */
+    static Tick delay(std::mt19937 &rng) { return (1 + rng() % 2000) * 500; }
+
+    void
+    process() override
+    {
+        if (serviced)
+            serviced->push_back(id);
+        eq.schedule(this, eq.getCurTick() + delay(rng));
+    }
+
+  private:
+    EventQueue &eq;
+    std::mt19937 &rng;
+    const int id;
+    std::vector<int> *serviced;
+};
+
+struct Rates
+{
+    double reschedules;
+    double services;
+};
+
+double
+perSecond(unsigned ops, std::chrono::steady_clock::time_point start)
+{
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return ops / elapsed.count();
+}
+
+/**
+ * Keep pending events scheduled, then move ops random ones elsewhere
+ * and service ops events.  The ids of the events serviced are appended
+ * to serviced if it isn't nullptr.
+ */
+Rates
+run(bool use_calendar, unsigned pending, unsigned ops,
+    std::vector<int> *serviced = nullptr)
+{
+    EventQueue eq("eventqtime");
+    if (use_calendar)
+        eq.useCalendar(calendarBucketWidth, calendarBuckets);
+    curEventQueue(&eq);
+
+    std::mt19937 rng(1);
+    std::vector<HoldEvent *> events;
+    for (unsigned i = 0; i < pending; i++) {
+        // Some events share ticks, but not priorities
+        Event::Priority p = Event::Default_Pri + (int)(rng() % 3) - 1;
+        events.push_back(new HoldEvent(eq, rng, i, p, serviced));
+        eq.schedule(events.back(), HoldEvent::delay(rng));
+    }
+
+    Rates rates;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < ops; i++) {
+        HoldEvent *event = events[rng() % pending];
+        eq.deschedule(event);
+        eq.schedule(event, eq.getCurTick() + HoldEvent::delay(rng));
+    }
+    rates.reschedules = perSecond(ops, start);
+
+    start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < ops; i++)
+        eq.serviceOne();
+    rates.services = perSecond(ops, start);
+
+    while (!eq.empty())
+        eq.deschedule(eq.getHead());
+    for (HoldEvent *event : events)
+        delete event;
+    curEventQueue(nullptr);
+
+    return rates;
+}
+
+} // anonymous namespace
+
+int
+main()
+{
+    const unsigned ops = 200000;
+
+    for (unsigned pending : {16, 256, 4096, 16384}) {
+        std::vector<int> list_order, calendar_order;
+        run(false, pending, ops / 10, &list_order);
+        run(true, pending, ops / 10, &calendar_order);
+        if (list_order != calendar_order) {
+            cprintf("%d pending: the calendar serviced events out of order\n",
+                    pending);
+            return 1;
+        }
+
+        for (bool use_calendar : {false, true}) {
+            Rates rates = run(use_calendar, pending, ops);
+            cprintf("%6d pending, %-8s: %10d reschedules/s, "
+                    "%10d services/s\n", pending,
+                    use_calendar ? "calendar" : "list",
+                    (uint64_t)rates.reschedules, (uint64_t)rates.services);
+        }
+    }
+
+    return 0;
+}
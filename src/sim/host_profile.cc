@@ -0,0 +1,192 @@
+#include "sim/host_profile.hh"
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <utility>
+
+#include "base/output.hh"
+#include "base/statistics.hh"
+#include "sim/eventq.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+namespace host_profile
+{
+
+namespace
+{
+
+OutputStream *reportFile = nullptr;
+
+/** The SimObject with the longest name which prefixes name, if any */
+std::string
+owner(const std::string &name)
+{
+    std::string prefix = name;
+    while (!SimObject::find(prefix.c_str())) {
+        auto dot = prefix.rfind('.');
+        if (dot == std::string::npos)
+            return std::string();
+        prefix.resize(dot);
+    }
+    return prefix;
+}
+
+void
+sortByHostTime(std::vector<Entry> &entries)
+{
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry &a, const Entry &b) {
+                  return a.hostNs > b.hostNs;
+              });
+}
+
+void
+dumpReport()
+{
+    report(*reportFile->stream());
+    reportFile->stream()->flush();
+}
+
+void
+resetProfiles()
+{
+    for (uint32_t i = 0; i < numMainEventQueues; ++i) {
+        if (EventProfile *profile = mainEventQueue[i]->getProfile())
+            profile->reset();
+    }
+}
+
+void
+writeTable(std::ostream &os, const std::vector<Entry> &entries,
+           bool by_event)
+{
+    uint64_t total_ns = 0;
+    for (const auto &entry : entries)
+        total_ns += entry.hostNs;
+
+    os << std::setw(12) << "host_seconds" << std::setw(8) << "%host"
+       << std::setw(14) << "events" << std::setw(10) << "ns/event"
+       << "  " << (by_event ? "simobject: event" : "simobject") << "\n";
+
+    for (const auto &entry : entries) {
+        if (!entry.count)
+            continue;
+        os << std::fixed << std::setprecision(6) << std::setw(12)
+           << entry.hostNs / 1e9
+           << std::setprecision(2) << std::setw(8)
+           << (total_ns ? 100.0 * entry.hostNs / total_ns : 0.0)
+           << std::setw(14) << entry.count
+           << std::setprecision(1) << std::setw(10)
+           << (double)entry.hostNs / entry.count << "  "
+           << (entry.simObject.empty() ? "(unowned)" : entry.simObject);
+        if (by_event)
+            os << ": " << entry.event;
+        os << "\n";
+    }
+}
+
+} // anonymous namespace
+
+void
+start(const std::string &file_name)
+{
+    if (reportFile)
+        return;
+
+    profileEventQueues();
+
+    reportFile = simout.create(file_name);
+    statistics::registerDumpCallback(dumpReport);
+    statistics::registerResetCallback(resetProfiles);
+}
+
+bool
+enabled()
+{
+    return reportFile != nullptr;
+}
+
+std::vector<Entry>
+byEvent()
+{
+    // Events of the same owner and description on different queues, or
+    // with different names, are merged
+    std::map<std::pair<std::string, std::string>, Entry> merged;
+    std::map<std::string, std::string> owners;
+    for (uint32_t i = 0; i < numMainEventQueues; ++i) {
+        const EventProfile *profile = mainEventQueue[i]->getProfile();
+        if (!profile)
+            continue;
+        for (const auto &record : profile->records()) {
+            std::string sim_object;
+            if (!record.name.empty()) {
+                auto found = owners.find(record.name);
+                if (found == owners.end()) {
+                    found = owners.emplace(record.name,
+                                           owner(record.name)).first;
+                }
+                sim_object = found->second;
+            }
+
+            Entry &entry = merged[{sim_object, record.description}];
+            entry.simObject = sim_object;
+            entry.event = record.description;
+            entry.count += record.count;
+            entry.hostNs += record.hostNs;
+        }
+    }
+
+    std::vector<Entry> entries;
+    for (auto &kv : merged)
+        entries.push_back(std::move(kv.second));
+    sortByHostTime(entries);
+    return entries;
+}
+
+std::vector<Entry>
+bySimObject()
+{
+    std::map<std::string, Entry> merged;
+    for (const auto &event : byEvent()) {
+        Entry &entry = merged[event.simObject];
+        entry.simObject = event.simObject;
+        entry.count += event.count;
+        entry.hostNs += event.hostNs;
+    }
+
+    std::vector<Entry> entries;
+    for (auto &kv : merged)
+        entries.push_back(std::move(kv.second));
+    sortByHostTime(entries);
+    return entries;
+}
+
+void
+report(std::ostream &os)
+{
+    std::vector<Entry> events = byEvent();
+    std::vector<Entry> sim_objects = bySimObject();
+
+    Counter count = 0;
+    uint64_t host_ns = 0;
+    for (const auto &entry : sim_objects) {
+        count += entry.count;
+        host_ns += entry.hostNs;
+    }
+
+    os << "\n---------- Begin Host Profile ----------\n"
+       << "Processed " << count << " events in " << std::fixed
+       << std::setprecision(6) << host_ns / 1e9 << " host seconds\n\n";
+    writeTable(os, sim_objects, false);
+    os << "\n";
+    writeTable(os, events, true);
+    os << "\n---------- End Host Profile ----------\n";
+}
+
+} // namespace host_profile
+
+} // namespace gem5
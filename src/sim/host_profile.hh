@@ -0,0 +1,67 @@
+/**
+ * @file
+ * Reports of the host time spent processing the events of each SimObject.
+ */
+
+#ifndef __SIM_HOST_PROFILE_HH__
+#define __SIM_HOST_PROFILE_HH__
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * Host profiling charges the host time each event takes to process to the
+ * SimObject which owns it, and to the event itself, to tell which parts
+ * of a simulation it is slow to simulate.  The owner of an event is the
+ * SimObject with the longest name which prefixes the event's name.
+ * Managed events, e.g. those created for each packet and deleted once
+ * processed, are only told apart by description.  They have no owner.
+ *
+ * The profile is reset with the stats, and a report is written each time
+ * the stats are dumped.
+ */
+namespace host_profile
+{
+
+/** The host time spent on one event, or on the events of a SimObject */
+struct Entry
+{
+    /** The owning SimObject, empty if the event has none */
+    std::string simObject;
+    /** The event's description, empty for the total of a SimObject */
+    std::string event;
+
+    Counter count = 0;
+    uint64_t hostNs = 0;
+};
+
+/**
+ * Profile the event queues from now on, and write a report to file_name
+ * in the output directory each time the stats are dumped.
+ */
+void start(const std::string &file_name);
+
+/** Whether the event queues are being profiled */
+bool enabled();
+
+/** The totals of each SimObject, most host time first */
+std::vector<Entry> bySimObject();
+
+/** The time spent on each event, most host time first */
+std::vector<Entry> byEvent();
+
+/** Write the tables of both to os */
+void report(std::ostream &os);
+
+} // namespace host_profile
+
+} // namespace gem5
+
+#endif // __SIM_HOST_PROFILE_HH__
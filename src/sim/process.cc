@@ -364,6 +364,7 @@ Process::replicatePage(Addr vaddr, Addr new_paddr, ThreadContext *old_tc,
 bool
 Process::fixupFault(Addr vaddr)
 {
+    SEWorkload::EmulationGuard guard(*seWorkload);
     return memState->fixupFault(vaddr);
 }
 
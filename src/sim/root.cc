@@ -43,10 +43,14 @@
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/TimeSync.hh"
+#include "mem/packet.hh"
+#include "mem/request.hh"
 #include "sim/core.hh"
 #include "sim/cur_tick.hh"
+#include "sim/event_pool.hh"
 #include "sim/eventq.hh"
 #include "sim/full_system.hh"
+#include "sim/host_profile.hh"
 #include "sim/root.hh"
 
 namespace gem5
@@ -75,9 +79,43 @@ Root::RootStats::RootStats()
              "The number of ticks simulated per host second (ticks/s)"),
     ADD_STAT(hostMemory, statistics::units::Byte::get(),
              "Number of bytes of host memory used"),
+    ADD_STAT(hostEventsScheduled, statistics::units::Count::get(),
+             "Number of events scheduled, or rescheduled, by the threads "
+             "running the event queues"),
+    ADD_STAT(hostEventsCoalesced, statistics::units::Count::get(),
+             "Number of requests for an event to happen by a tick that "
+             "found it already scheduled by then"),
+    ADD_STAT(hostEventPoolAllocations, statistics::units::Count::get(),
+             "Number of pooled events allocated"),
+    ADD_STAT(hostEventPoolReuses, statistics::units::Count::get(),
+             "Number of pooled events allocated by reusing a freed one"),
+    ADD_STAT(hostPacketPoolAllocations, statistics::units::Count::get(),
+             "Number of packets allocated"),
+    ADD_STAT(hostPacketPoolReuses, statistics::units::Count::get(),
+             "Number of packets allocated by reusing a freed one"),
+    ADD_STAT(hostPacketDataPoolAllocations, statistics::units::Count::get(),
+             "Number of packet data buffers allocated, as the data didn't "
+             "fit in the packet"),
+    ADD_STAT(hostPacketDataPoolReuses, statistics::units::Count::get(),
+             "Number of packet data buffers allocated by reusing a freed "
+             "one"),
+    ADD_STAT(hostRequestPoolAllocations, statistics::units::Count::get(),
+             "Number of pooled requests allocated"),
+    ADD_STAT(hostRequestPoolReuses, statistics::units::Count::get(),
+             "Number of pooled requests allocated by reusing a freed one"),
 
     statTime(true),
-    startTick(0)
+    startTick(0),
+    startEventsScheduled(0),
+    startEventsCoalesced(0),
+    startEventPoolAllocations(0),
+    startEventPoolReuses(0),
+    startPacketPoolAllocations(0),
+    startPacketPoolReuses(0),
+    startPacketDataPoolAllocations(0),
+    startPacketDataPoolReuses(0),
+    startRequestPoolAllocations(0),
+    startRequestPoolReuses(0)
 {
     simFreq.scalar(sim_clock::Frequency);
     simTicks.functor([this]() { return curTick() - startTick; });
@@ -99,6 +137,39 @@ Root::RootStats::RootStats()
 
     hostTickRate.precision(0);
 
+    hostEventsScheduled.functor([this]() {
+            return eventsScheduled() - startEventsScheduled;
+        });
+    hostEventsCoalesced.functor([this]() {
+            return eventsCoalesced() - startEventsCoalesced;
+        });
+    hostEventPoolAllocations.functor([this]() {
+            return event_pool::allocations() - startEventPoolAllocations;
+        });
+    hostEventPoolReuses.functor([this]() {
+            return event_pool::reuses() - startEventPoolReuses;
+        });
+    hostPacketPoolAllocations.functor([this]() {
+            return Packet::pool().allocations() - startPacketPoolAllocations;
+        });
+    hostPacketPoolReuses.functor([this]() {
+            return Packet::pool().reuses() - startPacketPoolReuses;
+        });
+    hostPacketDataPoolAllocations.functor([this]() {
+            return Packet::dataPool().allocations() -
+                startPacketDataPoolAllocations;
+        });
+    hostPacketDataPoolReuses.functor([this]() {
+            return Packet::dataPool().reuses() - startPacketDataPoolReuses;
+        });
+    hostRequestPoolAllocations.functor([this]() {
+            return Request::pool().allocations() -
+                startRequestPoolAllocations;
+        });
+    hostRequestPoolReuses.functor([this]() {
+            return Request::pool().reuses() - startRequestPoolReuses;
+        });
+
     simSeconds = simTicks / simFreq;
     hostTickRate = simTicks / hostSeconds;
 }
@@ -108,10 +179,38 @@ Root::RootStats::resetStats()
 {
     statTime.setTimer();
     startTick = curTick();
+    startEventsScheduled = eventsScheduled();
+    startEventsCoalesced = eventsCoalesced();
+    startEventPoolAllocations = event_pool::allocations();
+    startEventPoolReuses = event_pool::reuses();
+    startPacketPoolAllocations = Packet::pool().allocations();
+    startPacketPoolReuses = Packet::pool().reuses();
+    startPacketDataPoolAllocations = Packet::dataPool().allocations();
+    startPacketDataPoolReuses = Packet::dataPool().reuses();
+    startRequestPoolAllocations = Request::pool().allocations();
+    startRequestPoolReuses = Request::pool().reuses();
 
     statistics::Group::resetStats();
 }
 
+Counter
+Root::RootStats::eventsScheduled()
+{
+    Counter total = 0;
+    for (uint32_t i = 0; i < numMainEventQueues; ++i)
+        total += mainEventQueue[i]->scheduledCount();
+    return total;
+}
+
+Counter
+Root::RootStats::eventsCoalesced()
+{
+    Counter total = 0;
+    for (uint32_t i = 0; i < numMainEventQueues; ++i)
+        total += mainEventQueue[i]->coalescedCount();
+    return total;
+}
+
 /*
  * This function is called periodically by an event in M5 and ensures that
  * at least as much real time has passed between invocations as simulated time.
@@ -188,6 +287,14 @@ Root::Root(const RootParams &p, int)
 
     simQuantum = p.sim_quantum;
 
+    if (p.eventq_calendar_buckets) {
+        useEventCalendars(p.eventq_calendar_bucket_width,
+                          p.eventq_calendar_buckets);
+    }
+
+    if (!p.host_profile.empty())
+        host_profile::start(p.host_profile);
+
     // Some of the statistics are global and need to be accessed by
     // stat formulas. The most convenient way to implement that is by
     // having a single global stat group for global stats. Merge that
@@ -110,6 +110,17 @@ class Root : public SimObject
         statistics::Formula hostTickRate;
         statistics::Value hostMemory;
 
+        statistics::Value hostEventsScheduled;
+        statistics::Value hostEventsCoalesced;
+        statistics::Value hostEventPoolAllocations;
+        statistics::Value hostEventPoolReuses;
+        statistics::Value hostPacketPoolAllocations;
+        statistics::Value hostPacketPoolReuses;
+        statistics::Value hostPacketDataPoolAllocations;
+        statistics::Value hostPacketDataPoolReuses;
+        statistics::Value hostRequestPoolAllocations;
+        statistics::Value hostRequestPoolReuses;
+
         static RootStats instance;
 
       private:
@@ -120,6 +131,23 @@ class Root : public SimObject
 
         Time statTime;
         Tick startTick;
+
+        /** The event counts at the last reset */
+        Counter startEventsScheduled;
+        Counter startEventsCoalesced;
+        Counter startEventPoolAllocations;
+        Counter startEventPoolReuses;
+
+        /** The memory system pool counts at the last reset */
+        Counter startPacketPoolAllocations;
+        Counter startPacketPoolReuses;
+        Counter startPacketDataPoolAllocations;
+        Counter startPacketDataPoolReuses;
+        Counter startRequestPoolAllocations;
+        Counter startRequestPoolReuses;
+
+        static Counter eventsScheduled();
+        static Counter eventsCoalesced();
     };
 
   public:
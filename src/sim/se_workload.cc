@@ -29,6 +29,7 @@
 
 #include "cpu/thread_context.hh"
 #include "params/SEWorkload.hh"
+#include "sim/eventq.hh"
 #include "sim/process.hh"
 #include "sim/system.hh"
 
@@ -65,6 +66,15 @@ SEWorkload::unserialize(CheckpointIn &cp)
     memPools.unserialize(cp);
 }
 
+SEWorkload::EmulationGuard::EmulationGuard(const SEWorkload &workload)
+    : lock(workload.emulationMutex, std::defer_lock)
+{
+    if (!lock.try_lock()) {
+        EventQueue::ScopedRelease release(curEventQueue());
+        lock.lock();
+    }
+}
+
 void
 SEWorkload::syscall(ThreadContext *tc)
 {
@@ -74,6 +84,7 @@ SEWorkload::syscall(ThreadContext *tc)
 Addr
 SEWorkload::allocPhysPages(int npages, int pool_id)
 {
+    EmulationGuard guard(*this);
     return memPools.allocPhysPages(npages, pool_id);
 }
 
@@ -86,6 +97,7 @@ SEWorkload::memSize(int pool_id) const
 Addr
 SEWorkload::freeMemSize(int pool_id) const
 {
+    EmulationGuard guard(*this);
     return memPools.freeMemSize(pool_id);
 }
 
@@ -28,6 +28,8 @@
 #ifndef __SIM_SE_WORKLOAD_HH__
 #define __SIM_SE_WORKLOAD_HH__
 
+#include <mutex>
+
 #include "params/SEWorkload.hh"
 #include "sim/mem_pool.hh"
 #include "sim/workload.hh"
@@ -41,6 +43,14 @@ class SEWorkload : public Workload
     /** Memory allocation objects for all physical memories in the system. */
     MemPools memPools;
 
+    /**
+     * Serializes the accesses to the emulated OS, e.g. its memory pools
+     * and the processes' page tables and file descriptors, made by CPUs
+     * simulated by different event queue threads.  Only taken through an
+     * EmulationGuard.
+     */
+    mutable std::recursive_mutex emulationMutex;
+
   public:
     using Params = SEWorkloadParams;
 
@@ -89,6 +99,24 @@ class SEWorkload : public Workload
     // For now, assume the only type of events are system calls.
     void event(ThreadContext *tc) override { syscall(tc); }
 
+    /**
+     * Holds the emulation lock of a workload for its lifetime.
+     *
+     * The holder may make functional accesses that migrate to the event
+     * queues of other threads, e.g. to snoop their CPUs' caches, so a
+     * thread never waits for the lock with its event queue locked.  It
+     * releases its queue while it waits and takes it back once it has
+     * the lock, which keeps the locks in the same order in every thread.
+     */
+    class EmulationGuard
+    {
+      public:
+        EmulationGuard(const SEWorkload &workload);
+
+      private:
+        std::unique_lock<std::recursive_mutex> lock;
+    };
+
     Addr allocPhysPages(int npages, int pool_id=0);
     Addr memSize(int pool_id=0) const;
     Addr freeMemSize(int pool_id=0) const;
@@ -31,6 +31,8 @@
 
 #include "base/types.hh"
 #include "sim/eventq.hh"
+#include "sim/process.hh"
+#include "sim/se_workload.hh"
 #include "sim/syscall_debug_macros.hh"
 
 namespace gem5
@@ -41,6 +43,10 @@ class ThreadContext;
 void
 SyscallDesc::doSyscall(ThreadContext *tc)
 {
+    // The threads of a process, and the processes, may be simulated by
+    // different event queue threads
+    SEWorkload::EmulationGuard guard(*tc->getProcessPtr()->seWorkload);
+
     DPRINTF_SYSCALL(Base, "Calling %s...\n", dumper(name(), tc));
 
     SyscallReturn retval = executor(this, tc);
@@ -60,6 +66,8 @@ SyscallDesc::doSyscall(ThreadContext *tc)
 void
 SyscallDesc::retrySyscall(ThreadContext *tc)
 {
+    SEWorkload::EmulationGuard guard(*tc->getProcessPtr()->seWorkload);
+
     DPRINTF_SYSCALL(Base, "Retrying %s...\n", dumper(name(), tc));
 
     SyscallReturn retval = executor(this, tc);
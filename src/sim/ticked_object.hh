@@ -106,8 +106,7 @@ class Ticked : public Serializable
     start()
     {
         if (!running) {
-            if (!event.scheduled())
-                object.schedule(event, object.clockEdge(Cycles(1)));
+            object.scheduleBy(event, object.clockEdge(Cycles(1)));
             running = true;
             numCycles += cyclesSinceLastStopped();
             countCycles(cyclesSinceLastStopped());
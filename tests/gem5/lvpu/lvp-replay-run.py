@@ -0,0 +1,83 @@
+# Replays a hand written LVP trace in which a load becomes Constant and a
+# store to its address then demotes it.  Whatever the policy, a training
+# LVPU keeps the CVT, so the store must find and invalidate the entry.
+# Exits non-zero if it does not.
+
+import argparse
+import os
+import struct
+
+import m5
+from m5.objects import *
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--lvpu_policy", default="no_constants")
+args = parser.parse_args()
+
+LOAD, STORE = 0, 1
+load_pc = 0x1000
+load_addr = 0x8000
+max_vec_bytes = 16
+
+def varint(value):
+    encoded = b""
+    while True:
+        byte = value & 0x7f
+        value >>= 7
+        if value:
+            encoded += bytes([byte | 0x80])
+        else:
+            return encoded + bytes([byte])
+
+def field(number, wire_type, payload):
+    return varint(number << 3 | wire_type) + payload
+
+def delimited(number, payload):
+    return field(number, 2, varint(len(payload)) + payload)
+
+def record(kind, addr, size, pc=None, values=()):
+    msg = field(1, 0, varint(kind)) + field(2, 0, varint(addr)) + \
+        field(3, 0, varint(size))
+    if pc is not None:
+        msg += field(4, 0, varint(pc))
+    if values:
+        msg += delimited(5, b"".join(varint(v) for v in values))
+    return msg
+
+# Same layout as ProtoOutputStream: the magic number, then each message
+# prefixed by its size
+header = delimited(1, b"lvpu_test") + field(3, 0, varint(max_vec_bytes))
+messages = [ header ]
+# The load returns the same value until its counter saturates
+messages += [ record(LOAD, load_addr, 8, load_pc, [42]) for _ in range(4) ]
+messages.append(record(STORE, load_addr, 8))
+messages.append(record(LOAD, load_addr, 8, load_pc, [43]))
+
+trace_file = os.path.join(m5.options.outdir, "lvp_trace.pb")
+with open(trace_file, "wb") as f:
+    f.write(struct.pack("<I", 0x356d6567))
+    for msg in messages:
+        f.write(varint(len(msg)) + msg)
+
+replayer = LVPTraceReplayer(trace_file = trace_file,
+                            lvpt_max_vec_bytes = max_vec_bytes,
+                            lvpu_policy = args.lvpu_policy)
+root = Root(full_system = False, replayer = replayer)
+
+m5.instantiate()
+m5.simulate()
+
+def stat_value(group, name):
+    group.preDumpStats()
+    for stat in group.getStats():
+        if stat.name == name:
+            stat.prepare()
+            return stat.value
+    raise KeyError(name)
+
+lvpu_stats = replayer.getStatGroups()["lvpu"]
+invalidations = stat_value(lvpu_stats, "cvt_store_invalidations")
+if invalidations != 1:
+    print("The store invalidated %d CVT entries, expected 1" % invalidations)
+    exit(1)
+print("The store demoted the constant load")
@@ -0,0 +1,16 @@
+'''
+Checks that stores demote Constant loads under every LVPU policy that
+trains, including those that never bypass memory for constants
+'''
+
+from testlib import *
+
+for policy in ('none', 'constant_only', 'no_constants'):
+    gem5_verify_config(
+        name='lvpu_store_demotes_constant_' + policy,
+        verifiers=(), # No need for verfiers this will return non-zero on fail
+        config=joinpath(getcwd(), 'lvp-replay-run.py'),
+        config_args=['--lvpu_policy', policy],
+        valid_isas=(constants.arm_tag,),
+        length=constants.quick_tag,
+    )
@@ -0,0 +1,137 @@
+# Regression test of the functional warming of caches
+#
+# Memory testers run through a hierarchy of caches in two processes
+# forked from one another. In one the caches are in use and the system is
+# in atomic mode; in the other they are bypassed, and functionally warmed
+# with the requests of the testers. Both then carry on in atomic mode with
+# the caches in use. The tags of the caches after warming, and the stats
+# of the caches after that, must match those of the atomic run.
+
+import json
+import os
+import sys
+
+import m5
+import _m5.stats
+from m5.objects import *
+m5.util.addToPath('../../../configs/')
+from common.Caches import *
+
+# Ticks each of the two phases runs for
+phase_ticks = 200000000
+
+nb_cores = 4
+cpus = [MemTest(max_loads = 1e9, progress_interval = 1e9,
+                percent_functional = 0, percent_uncacheable = 0)
+        for i in range(nb_cores) ]
+
+system = System(cpu = cpus,
+                physmem = SimpleMemory(),
+                membus = SystemXBar())
+system.voltage_domain = VoltageDomain()
+system.clk_domain = SrcClockDomain(clock = '1GHz',
+                                   voltage_domain = system.voltage_domain)
+system.cpu_clk_domain = SrcClockDomain(clock = '2GHz',
+                                       voltage_domain = system.voltage_domain)
+
+# Caches much smaller than the testers' footprint, for them to evict
+# lines and keep each other's copies coherent
+system.toL2Bus = L2XBar(clk_domain = system.cpu_clk_domain)
+system.l2c = L2Cache(clk_domain = system.cpu_clk_domain, size='32kB', assoc=8)
+system.l2c.cpu_side = system.toL2Bus.mem_side_ports
+system.l2c.mem_side = system.membus.cpu_side_ports
+
+for cpu in cpus:
+    cpu.clk_domain = system.cpu_clk_domain
+    # The warmer sees the requests of the tester through the monitor
+    cpu.monitor = CommMonitor()
+    cpu.monitor.cpu_side_port = cpu.port
+    cpu.l1c = L1Cache(size = '4kB', assoc = 4)
+    cpu.l1c.cpu_side = cpu.monitor.mem_side_port
+    cpu.l1c.mem_side = system.toL2Bus.cpu_side_ports
+    cpu.warmer = CacheWarmer(manager = cpu.monitor, dcache = cpu.l1c)
+
+system.system_port = system.membus.cpu_side_ports
+system.physmem.port = system.membus.mem_side_ports
+
+caches = [ cpu.l1c for cpu in cpus ] + [ system.l2c ]
+
+def stat_values(group, prefix=""):
+    """The values of the stats of a group and its subgroups by name, NaNs
+    as None"""
+    values = {}
+    group.preDumpStats()
+    for stat in group.getStats():
+        stat.prepare()
+        if isinstance(stat, _m5.stats.ScalarInfo):
+            value = [ stat.value ]
+        elif isinstance(stat, _m5.stats.VectorInfo):
+            value = list(stat.result)
+        else:
+            continue
+        values[prefix + stat.name] = [ v if v == v else None for v in value ]
+    for name, child in group.getStatGroups().items():
+        values.update(stat_values(child, prefix + name + "."))
+    return values
+
+def set_mem_mode(name):
+    system.setMemoryMode(m5.params.allEnums["MemoryMode"](name).getValue())
+
+# -----------------------
+# run simulation
+# -----------------------
+
+root = Root( full_system = False, system = system )
+root.system.mem_mode = 'atomic'
+
+# Forking needs the listeners disabled
+m5.disableAllListeners()
+m5.instantiate()
+
+# Forking drains the system
+pid = m5.fork("%(parent)s/warm")
+warm = pid == 0
+
+if warm:
+    set_mem_mode('atomic_noncaching')
+m5.simulate(phase_ticks)
+
+# The occupancies are counted from the blocks in the tags
+results = { "tags" : { cache.path() : { "occupanciesTaskId" :
+                stat_values(cache.tags)["occupanciesTaskId"] }
+                       for cache in caches } }
+
+m5.drain()
+if warm:
+    set_mem_mode('atomic')
+m5.stats.reset()
+m5.simulate(phase_ticks)
+
+results["stats"] = { cache.path() : stat_values(cache) for cache in caches }
+
+if warm:
+    with open(os.path.join(m5.options.outdir, "caches.json"), "w") as f:
+        json.dump(results, f)
+    sys.exit(0)
+
+_, status = os.waitpid(pid, 0)
+if status != 0:
+    print("The warmed run failed")
+    exit(1)
+
+with open(os.path.join(m5.options.outdir, "warm", "caches.json")) as f:
+    warm_results = json.load(f)
+
+mismatches = 0
+for kind in ("tags", "stats"):
+    for cache, values in results[kind].items():
+        warm_values = warm_results[kind][cache]
+        for name, value in values.items():
+            if warm_values.get(name) != value:
+                print("%s %s.%s: atomic %s, warmed %s" %
+                      (kind, cache, name, value, warm_values.get(name)))
+                mismatches += 1
+
+if mismatches:
+    exit(1)
+print("The warmed caches match the atomic run")
@@ -67,6 +67,14 @@ gem5_verify_config(
     valid_isas=(constants.null_tag,),
 )
 
+gem5_verify_config(
+    name='cache_warm',
+    verifiers=(), # No need for verfiers this will return non-zero on fail
+    config=joinpath(getcwd(), 'cache-warm-run.py'),
+    config_args = [],
+    valid_isas=(constants.null_tag,),
+)
+
 null_tests = [
     ('garnet_synth_traffic', None, ['--sim-cycles', '5000000']),
     ('memcheck', None, ['--maxtick', '2000000000', '--prefetchers']),
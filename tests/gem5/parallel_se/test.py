@@ -0,0 +1,37 @@
+'''
+Runs several SE processes on their own cores, each simulated by its own
+host thread (--parallel).  The processes make syscalls and take page
+faults at the same time, so the threads contend for the emulated OS
+while making functional accesses that snoop each other's caches.  A
+deadlock shows up as the test timing out.
+'''
+import re
+
+from testlib import *
+
+binary = joinpath(config.base_dir, 'tests', 'test-progs', 'hello', 'bin',
+                  'x86', 'linux', 'hello')
+
+num_cores = 4
+
+verifiers = (
+    verifier.MatchRegex(re.compile(r'Hello world!')),
+    verifier.MatchRegex(re.compile(
+        r'Exiting @ tick \d+ because exiting with last active thread '
+        r'context')),
+)
+
+for cpu in ('AtomicSimpleCPU', 'TimingSimpleCPU'):
+    gem5_verify_config(
+        name='parallel-se-' + cpu,
+        verifiers=verifiers,
+        fixtures=(),
+        config=joinpath(config.base_dir, 'configs', 'example', 'se.py'),
+        config_args=['--cpu-type', cpu,
+                     '--num-cpus', str(num_cores),
+                     '--caches', '--l2cache', '--parallel',
+                     '--cmd', ';'.join([binary] * num_cores)],
+        valid_isas=(constants.vega_x86_tag,),
+        valid_hosts=(constants.host_x86_64_tag,),
+        length=constants.quick_tag,
+    )
@@ -0,0 +1,66 @@
+import unittest
+
+from m5 import partition
+from m5.objects import Cache, L2XBar, MemTest, System, SystemXBar
+
+def _cache():
+    return Cache(size='4kB', assoc=4, tag_latency=1, data_latency=1,
+                 response_latency=1, mshrs=4, tgts_per_mshr=8)
+
+class PartitionTestSuite(unittest.TestCase):
+    """Test cases for the partitioning of systems by core"""
+
+    def _system(self, num_cpus, private_buses):
+        """A system of num_cpus MemTests with L1 caches.  The L1s share an
+        L2XBar, or have private_buses of their own to a shared cache"""
+        system = System()
+        system.membus = SystemXBar()
+        system.cpu = [MemTest() for i in range(num_cpus)]
+        if private_buses:
+            system.l3 = _cache()
+            system.l3.mem_side = system.membus.cpu_side_ports
+        else:
+            system.l2bus = L2XBar()
+            system.l2bus.mem_side_ports = system.membus.cpu_side_ports
+        for cpu in system.cpu:
+            cpu.l1 = _cache()
+            cpu.port = cpu.l1.cpu_side
+            if private_buses:
+                cpu.l2bus = L2XBar()
+                cpu.l1.mem_side = cpu.l2bus.cpu_side_ports
+                cpu.l2bus.mem_side_ports = system.l3.cpu_side
+            else:
+                cpu.l1.mem_side = system.l2bus.cpu_side_ports
+        return system
+
+    def test_shared_xbar(self):
+        system = self._system(2, False)
+        self.assertEqual(partition.partition_cores(system, [system.cpu]), 3)
+
+        for i, cpu in enumerate(system.cpu):
+            self.assertEqual(partition.eventq_index(cpu.l1), i + 1)
+        self.assertEqual(partition.eventq_index(system.l2bus), 0)
+
+        # The channels take over the latencies of the crossbar
+        channels = system.l2bus.partition_channels
+        self.assertEqual(len(channels), 2)
+        for channel in channels:
+            self.assertEqual(int(channel.delay), 1)
+            self.assertEqual(int(channel.response_delay), 1)
+            self.assertEqual(int(channel.mem_side_eventq), 0)
+        self.assertEqual(int(system.l2bus.frontend_latency), 0)
+        self.assertEqual(int(system.l2bus.response_latency), 0)
+
+    def test_zero_latency(self):
+        # An L2XBar's forward latency is 0, which would leave the channels
+        # leaving it without a lookahead
+        system = self._system(2, True)
+        partition.partition_cores(system, [system.cpu])
+
+        for i, cpu in enumerate(system.cpu):
+            channels = cpu.l2bus.partition_channels
+            self.assertEqual(len(channels), 1)
+            self.assertEqual(int(channels[0].delay), 1)
+            self.assertEqual(int(channels[0].response_delay), 1)
+            self.assertEqual(int(channels[0].cpu_side_eventq), i + 1)
+        self.assertEqual(int(system.cpu[0].l2bus.frontend_latency), 1)